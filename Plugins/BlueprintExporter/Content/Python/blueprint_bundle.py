@@ -0,0 +1,125 @@
+"""
+Blueprint Exporter - bundle reader
+Reads the blueprints.ndjson bundle written with the Bundle Export setting.
+
+    import blueprint_bundle
+    with blueprint_bundle.Bundle("Saved/BlueprintExports") as bundle:
+        player = bundle.get("/Game/BP_Player.BP_Player")
+        for asset_path, data in bundle.items():
+            ...
+
+    python blueprint_bundle.py <ExportDirectory|bundle.ndjson> [AssetPath]
+
+The index gives each record's byte offset, so get() reads one line of the memory-mapped
+bundle without parsing the others. See JSON-SCHEMA.md for the format. Runs inside and
+outside the editor.
+"""
+
+import base64
+import json
+import mmap
+import os
+import sys
+import zlib
+from typing import Any, Dict, Iterator, List, Optional, Tuple
+
+DEFAULT_BUNDLE = "blueprints.ndjson"
+
+
+def index_path_for(bundle_path: str) -> str:
+    """blueprints.ndjson -> blueprints.index.json"""
+    return os.path.splitext(bundle_path)[0] + ".index.json"
+
+
+def decode_record(line: bytes) -> Dict[str, Any]:
+    """Parse one bundle line, inflating it if it is a compressed wrapper"""
+    data = json.loads(line)
+    if data.get("compression") == "zlib" and "data" in data:
+        raw = zlib.decompress(base64.b64decode(data["data"]))
+        if len(raw) != data.get("raw_length", len(raw)):
+            raise ValueError(f"Corrupt compressed record: {data.get('path')}")
+        return json.loads(raw)
+    return data
+
+
+class Bundle:
+    """A bundle and its index; use as a context manager or call close()"""
+
+    def __init__(self, path: str):
+        bundle_path = os.path.join(path, DEFAULT_BUNDLE) if os.path.isdir(path) else path
+        with open(index_path_for(bundle_path), 'r', encoding='utf-8') as f:
+            index = json.load(f)
+
+        self.path = bundle_path
+        self.records: List[Dict[str, Any]] = index["records"]
+        self._by_path = {record["path"]: record for record in self.records}
+
+        self._file = open(bundle_path, 'rb')
+        # mmap can't map an empty file
+        self._data = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ) if os.path.getsize(bundle_path) else b""
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def close(self):
+        if isinstance(self._data, mmap.mmap):
+            self._data.close()
+        self._file.close()
+
+    def __len__(self) -> int:
+        return len(self.records)
+
+    def __contains__(self, asset_path: str) -> bool:
+        return asset_path in self._by_path
+
+    def paths(self) -> List[str]:
+        """Asset paths in bundle order"""
+        return [record["path"] for record in self.records]
+
+    def get(self, asset_path: str) -> Optional[Dict[str, Any]]:
+        """One blueprint, as json.load would return its .json file, or None"""
+        record = self._by_path.get(asset_path)
+        if record is None:
+            return None
+        return decode_record(self._line(record))
+
+    def items(self) -> Iterator[Tuple[str, Dict[str, Any]]]:
+        """(asset path, blueprint) for every record, in bundle order"""
+        for record in self.records:
+            yield record["path"], decode_record(self._line(record))
+
+    def _line(self, record: Dict[str, Any]) -> bytes:
+        offset, length = record["offset"], record["length"]
+        return self._data[offset:offset + length]
+
+
+def load_all(path: str) -> Dict[str, Dict[str, Any]]:
+    """Every blueprint in a bundle, by asset path"""
+    with Bundle(path) as bundle:
+        return dict(bundle.items())
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(f"Usage: {sys.argv[0]} <ExportDirectory|bundle.ndjson> [AssetPath]")
+        return 2
+
+    with Bundle(sys.argv[1]) as bundle:
+        if len(sys.argv) > 2:
+            data = bundle.get(sys.argv[2])
+            if data is None:
+                print(f"{sys.argv[2]} is not in {bundle.path}")
+                return 1
+            json.dump(data, sys.stdout, indent=2, ensure_ascii=False)
+            sys.stdout.write("\n")
+        else:
+            for asset_path in bundle.paths():
+                print(asset_path)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,250 @@
+"""
+Blueprint Exporter - compact schema converter
+Converts exports written with the Compact Schema setting (schema 3) back to the
+verbose schema (1 or 2), and verbose exports to the compact schema.
+
+    python blueprint_compact_schema.py <Input.json|.msgpack> [Output.json] [--schema 1|2]
+    python blueprint_compact_schema.py --compact <Input.json> [Output.json]
+
+In code:
+
+    import blueprint_compact_schema
+    data = blueprint_compact_schema.expand(compact_data)
+
+See JSON-SCHEMA.md for the format. Runs inside and outside the editor.
+"""
+
+import argparse
+import json
+import os
+import sys
+from typing import Any, Dict, List
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import blueprint_msgpack  # noqa: E402
+
+COMPACT_SCHEMA_VERSION = 3
+
+# Fields before "graphs", in the exporter's order
+HEADER_FIELDS = ("name", "path", "class_type", "parent_class", "generated_class", "hash")
+
+
+# ============================================================================
+# COMPACT -> VERBOSE
+# ============================================================================
+
+def expand(data: Dict[str, Any], schema: int = 1) -> Dict[str, Any]:
+    """Convert a schema 3 blueprint to schema 1 (functions embed their graph) or schema 2"""
+    if data.get("schema_version") != COMPACT_SCHEMA_VERSION:
+        return data
+
+    strings = data["strings"]
+    graphs = [_expand_graph(graph, strings, schema) for graph in data["graphs"]]
+    graphs_by_id = {graph["id"]: graph for graph in data["graphs"]}
+
+    result = {}
+    if schema == 2:
+        result["schema_version"] = 2
+    for field in HEADER_FIELDS:
+        if field in data:
+            result[field] = data[field]
+    result["graphs"] = graphs
+
+    result["variables"] = data.get("variables", [])
+
+    functions = []
+    for function in data.get("functions", []):
+        expanded = {"name": function["name"], "parameters": function["parameters"]}
+        if "graph_id" in function:
+            if schema == 2:
+                expanded["graph_id"] = function["graph_id"]
+            else:
+                graph = _expand_graph(graphs_by_id[function["graph_id"]], strings, 1)
+                expanded["graph"] = graph
+        functions.append(expanded)
+    result["functions"] = functions
+
+    result["components"] = data.get("components", [])
+    result["dependencies"] = data.get("dependencies", [])
+    return result
+
+
+def _expand_graph(graph: Dict[str, Any], strings: List[str], schema: int) -> Dict[str, Any]:
+    nodes = graph["nodes"]
+    result = {"id": graph["id"]} if schema == 2 else {}
+    result["name"] = graph["name"]
+    if "hash" in graph:
+        result["hash"] = graph["hash"]
+    result["nodes"] = [_expand_node(node, nodes, strings) for node in nodes]
+    return result
+
+
+def _expand_node(node: List[Any], nodes: List[List[Any]], strings: List[str]) -> Dict[str, Any]:
+    # Exports before format version 4 have no hash
+    node_id, node_type, title, pins = node[:4]
+    result = {
+        "id": strings[node_id],
+        "type": strings[node_type],
+        "title": strings[title],
+    }
+    if len(node) > 4:
+        result["hash"] = node[4]
+    result["pins"] = [_expand_pin(pin, nodes, strings) for pin in pins]
+    return result
+
+
+def _expand_pin(pin: List[Any], nodes: List[List[Any]], strings: List[str]) -> Dict[str, Any]:
+    result = {
+        "name": strings[pin[0]],
+        "direction": "input" if pin[1] == 0 else "output",
+        "type": strings[pin[2]],
+    }
+
+    if len(pin) > 3 and pin[3] != 0:
+        result["default_value"] = strings[pin[3]]
+
+    if len(pin) > 4:
+        links = pin[4]
+        connections = []
+        for index in range(0, len(links), 2):
+            node_index, pin_index = links[index], links[index + 1]
+            if node_index >= 0:
+                target = nodes[node_index]
+                connections.append({"node": strings[target[0]], "pin": strings[target[3][pin_index][0]]})
+            else:
+                # Link that couldn't be resolved in this graph: string indices
+                connections.append({"node": strings[-1 - node_index], "pin": strings[pin_index]})
+        result["to"] = connections
+
+    return result
+
+
+# ============================================================================
+# VERBOSE -> COMPACT
+# ============================================================================
+
+def compact(data: Dict[str, Any]) -> Dict[str, Any]:
+    """Convert a schema 1 or 2 blueprint to schema 3, as the exporter writes it"""
+    if data.get("schema_version") == COMPACT_SCHEMA_VERSION:
+        return data
+
+    # Same collection order as FBlueprintStringTable
+    strings = [""]
+    indices = {"": 0}
+
+    def intern(value: str) -> int:
+        if value not in indices:
+            indices[value] = len(strings)
+            strings.append(value)
+        return indices[value]
+
+    for graph in data.get("graphs", []):
+        for node in graph["nodes"]:
+            intern(node["id"])
+            intern(node["type"])
+            intern(node["title"])
+            for pin in node["pins"]:
+                intern(pin["name"])
+                intern(pin["type"])
+                intern(pin.get("default_value", ""))
+                for connection in pin.get("to", []):
+                    intern(connection["node"])
+                    intern(connection["pin"])
+
+    graphs = []
+    for graph in data.get("graphs", []):
+        node_indices = {node["id"]: index for index, node in enumerate(graph["nodes"])}
+        nodes = []
+        for node in graph["nodes"]:
+            pins = [_compact_pin(pin, graph["nodes"], node_indices, indices) for pin in node["pins"]]
+            compacted = [indices[node["id"]], indices[node["type"]], indices[node["title"]], pins]
+            if "hash" in node:
+                compacted.append(node["hash"])
+            nodes.append(compacted)
+        compacted_graph = {"id": graph.get("id", graph["name"]), "name": graph["name"]}
+        if "hash" in graph:
+            compacted_graph["hash"] = graph["hash"]
+        compacted_graph["nodes"] = nodes
+        graphs.append(compacted_graph)
+
+    result = {"schema_version": COMPACT_SCHEMA_VERSION}
+    for field in HEADER_FIELDS:
+        if field in data:
+            result[field] = data[field]
+    result["strings"] = strings
+    result["graphs"] = graphs
+    result["variables"] = data.get("variables", [])
+
+    functions = []
+    for function in data.get("functions", []):
+        compacted = {"name": function["name"], "parameters": function["parameters"]}
+        if "graph_id" in function:
+            compacted["graph_id"] = function["graph_id"]
+        elif "graph" in function:
+            compacted["graph_id"] = function["graph"]["name"]
+        functions.append(compacted)
+    result["functions"] = functions
+
+    result["components"] = data.get("components", [])
+    result["dependencies"] = data.get("dependencies", [])
+    return result
+
+
+def _compact_pin(pin: Dict[str, Any], nodes: List[Dict[str, Any]], node_indices: Dict[str, int], indices: Dict[str, int]) -> List[Any]:
+    result = [indices[pin["name"]], 0 if pin["direction"] == "input" else 1, indices[pin["type"]]]
+    default_value = pin.get("default_value", "")
+
+    if default_value or "to" in pin:
+        result.append(indices[default_value])
+
+    if "to" in pin:
+        links = []
+        for connection in pin["to"]:
+            node_index = node_indices.get(connection["node"])
+            pin_index = None
+            if node_index is not None:
+                pin_index = next((index for index, target in enumerate(nodes[node_index]["pins"])
+                                  if target["name"] == connection["pin"]), None)
+            if pin_index is not None:
+                links += [node_index, pin_index]
+            else:
+                links += [-1 - indices[connection["node"]], indices[connection["pin"]]]
+        result.append(links)
+
+    return result
+
+
+# ============================================================================
+# COMMAND LINE
+# ============================================================================
+
+def load(path: str) -> Dict[str, Any]:
+    """Read a .json or .msgpack export"""
+    if path.endswith('.msgpack'):
+        return blueprint_msgpack.load(path)
+    with open(path, 'r', encoding='utf-8') as f:
+        return json.load(f)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert between the compact and verbose blueprint schemas")
+    parser.add_argument("input", help="Exported blueprint (.json or .msgpack)")
+    parser.add_argument("output", nargs="?", help="Output .json (default: standard output)")
+    parser.add_argument("--schema", type=int, choices=(1, 2), default=1, help="Verbose schema to write")
+    parser.add_argument("--compact", action="store_true", help="Convert a verbose export to the compact schema instead")
+    args = parser.parse_args()
+
+    data = load(args.input)
+    converted = compact(data) if args.compact else expand(data, args.schema)
+
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8') as f:
+            json.dump(converted, f, indent=2, ensure_ascii=False)
+    else:
+        json.dump(converted, sys.stdout, indent=2, ensure_ascii=False)
+        sys.stdout.write("\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
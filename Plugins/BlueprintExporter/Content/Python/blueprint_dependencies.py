@@ -0,0 +1,150 @@
+"""
+Blueprint Exporter - dependency graph queries
+Reads the dependency_graph.json written by every bulk export and answers
+"what depends on X" and "what does X depend on", directly or transitively.
+
+    import blueprint_dependencies
+    graph = blueprint_dependencies.load("Exported/Blueprints")
+    graph.dependents("/Script/Engine.Actor")                        # direct
+    graph.dependents("/Game/BP_Weapon.BP_Weapon", transitive=True)  # any depth
+    graph.dependencies("/Game/BP_Player.BP_Player", transitive=True)
+
+    python blueprint_dependencies.py <ExportDirectory> dependents|dependencies <Path> [--direct]
+
+Paths are asset paths (/Game/BP.BP), blueprint generated class paths (/Game/BP.BP_C,
+resolved to the blueprint) or any class or object path a blueprint depends on.
+Loading parses the file once; each query is a walk over integer adjacency lists.
+See JSON-SCHEMA.md for the format. Runs inside and outside the editor.
+"""
+
+import argparse
+import glob
+import json
+import os
+import sys
+from collections import deque
+from typing import Dict, List
+
+INDEX_PATTERN = "dependency_graph*.json"
+
+
+class DependencyGraph:
+    """Forward and reverse adjacency over sorted node paths"""
+
+    def __init__(self, nodes: List[str], forward: List[List[int]], reverse: List[List[int]],
+                 blueprint_nodes: List[int], aliases: Dict[str, int]):
+        self.nodes = nodes
+        self.forward = forward
+        self.reverse = reverse
+        self.blueprint_nodes = sorted(blueprint_nodes)
+        self._indices = {node: index for index, node in enumerate(nodes)}
+        self._indices.update(aliases)
+
+    def __contains__(self, path: str) -> bool:
+        return path in self._indices
+
+    def blueprints(self) -> List[str]:
+        """Asset paths of every exported blueprint"""
+        return [self.nodes[index] for index in self.blueprint_nodes]
+
+    def dependents(self, path: str, transitive: bool = False) -> List[str]:
+        """Blueprints that depend on path, sorted"""
+        return self._walk(path, self.reverse, transitive)
+
+    def dependencies(self, path: str, transitive: bool = False) -> List[str]:
+        """What the blueprint at path depends on, sorted"""
+        return self._walk(path, self.forward, transitive)
+
+    def _walk(self, path: str, edges: List[List[int]], transitive: bool) -> List[str]:
+        start = self._indices.get(path)
+        if start is None:
+            return []
+
+        # The start node is only reported if a cycle leads back to it
+        visited = set(edges[start])
+        queue = deque(edges[start])
+        while transitive and queue:
+            for next_node in edges[queue.popleft()]:
+                if next_node not in visited:
+                    visited.add(next_node)
+                    queue.append(next_node)
+
+        # Node indices follow path order
+        return [self.nodes[index] for index in sorted(visited)]
+
+
+def load(export_dir: str) -> DependencyGraph:
+    """Load the dependency index of an export directory, merging shards"""
+    paths = sorted(glob.glob(os.path.join(export_dir, INDEX_PATTERN)))
+    if not paths:
+        raise FileNotFoundError(f"No {INDEX_PATTERN} in {export_dir}")
+
+    if len(paths) == 1:
+        with open(paths[0], 'r', encoding='utf-8') as f:
+            data = json.load(f)
+        aliases = {blueprint["class"]: blueprint["node"] for blueprint in data["blueprints"] if blueprint.get("class")}
+        blueprint_nodes = [blueprint["node"] for blueprint in data["blueprints"]]
+        return DependencyGraph(data["nodes"], data["forward"], data["reverse"], blueprint_nodes, aliases)
+
+    # Shards: merge the blueprints' forward edges, then rebuild as the exporter does
+    blueprint_edges: Dict[str, List[str]] = {}
+    classes: Dict[str, str] = {}
+    for path in paths:
+        with open(path, 'r', encoding='utf-8') as f:
+            data = json.load(f)
+        nodes = data["nodes"]
+        for blueprint in data["blueprints"]:
+            asset_path = nodes[blueprint["node"]]
+            blueprint_edges[asset_path] = [nodes[index] for index in data["forward"][blueprint["node"]]]
+            if blueprint.get("class"):
+                classes[blueprint["class"]] = asset_path
+    return build(blueprint_edges, classes)
+
+
+def build(blueprint_edges: Dict[str, List[str]], classes: Dict[str, str]) -> DependencyGraph:
+    """Graph from each blueprint's dependencies; dependencies on generated classes resolve to their blueprint"""
+    resolved = {asset_path: sorted({classes.get(dependency, dependency) for dependency in dependencies} - {asset_path})
+                for asset_path, dependencies in blueprint_edges.items()}
+
+    node_set = set(resolved)
+    for dependencies in resolved.values():
+        node_set.update(dependencies)
+    nodes = sorted(node_set)
+    indices = {node: index for index, node in enumerate(nodes)}
+
+    forward: List[List[int]] = [[] for _ in nodes]
+    reverse: List[List[int]] = [[] for _ in nodes]
+    for asset_path, dependencies in resolved.items():
+        node = indices[asset_path]
+        forward[node] = sorted(indices[dependency] for dependency in dependencies)
+        for dependency_node in forward[node]:
+            reverse[dependency_node].append(node)
+    for edges in reverse:
+        edges.sort()
+
+    aliases = {class_path: indices[asset_path] for class_path, asset_path in classes.items() if asset_path in indices}
+    blueprint_nodes = [indices[asset_path] for asset_path in resolved]
+    return DependencyGraph(nodes, forward, reverse, blueprint_nodes, aliases)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Query the blueprint dependency graph of an export")
+    parser.add_argument("export_dir", help="Export directory containing dependency_graph.json")
+    parser.add_argument("query", choices=("dependents", "dependencies"))
+    parser.add_argument("path", help="Asset, blueprint class or class path")
+    parser.add_argument("--direct", action="store_true", help="Only direct dependents/dependencies")
+    args = parser.parse_args()
+
+    graph = load(args.export_dir)
+    if args.path not in graph:
+        print(f"{args.path} is not in the dependency graph", file=sys.stderr)
+        return 1
+
+    query = graph.dependents if args.query == "dependents" else graph.dependencies
+    for path in query(args.path, transitive=not args.direct):
+        print(path)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -50,6 +50,28 @@ def ensure_output_dir():
     return output_path
 
 
+def write_if_changed(path: str, content: str) -> bool:
+    """
+    Write a UTF-8 text file unless it already holds this content; returns True if written
+    Unchanged files keep their timestamps, so file watchers and source control ignore them.
+    New content goes to a temporary file that is renamed over the old one.
+    """
+    encoded = content.encode('utf-8')
+    try:
+        if os.path.getsize(path) == len(encoded):
+            with open(path, 'rb') as f:
+                if f.read() == encoded:
+                    return False
+    except OSError:
+        pass
+
+    temp_path = path + ".tmp"
+    with open(temp_path, 'wb') as f:
+        f.write(encoded)
+    os.replace(temp_path, path)
+    return True
+
+
 def get_output_path(blueprint_path: str, blueprint_name: str, extension: str) -> str:
     """
     Convert blueprint path to output file path
@@ -176,22 +198,31 @@ def extract_blueprint_data_full(blueprint: unreal.Blueprint) -> Dict[str, Any]:
 # MARKDOWN GENERATION
 # ============================================================================
 
+def get_linked_node_ids(node: Dict[str, Any], exec_only: bool = False) -> List[str]:
+    """Ids of the nodes linked from a node's output pins, in pin order, without repeats"""
+    linked = []
+    for pin in node.get('pins', []):
+        if pin.get('direction') != 'output' or (exec_only and pin.get('type') != 'exec'):
+            continue
+        for link in pin.get('to', []):
+            if link['node'] not in linked:
+                linked.append(link['node'])
+    return linked
+
+
 def generate_detailed_node_graph(nodes: List[Dict[str, Any]]) -> str:
     """Generate detailed node-by-node breakdown showing execution and data flow"""
     md = ""
 
-    # Build connection map for easier lookup
+    # Execution successors of each node
     connection_map = {}
     for node in nodes:
-        node_id = node.get('id', '')
-        connections = node.get('connections', [])
-        connection_map[node_id] = connections
+        connection_map[node.get('id', '')] = get_linked_node_ids(node, exec_only=True)
 
     # Categorize nodes by type
     event_nodes = [n for n in nodes if 'Event' in n.get('type', '')]
     function_nodes = [n for n in nodes if 'CallFunction' in n.get('type', '')]
     variable_nodes = [n for n in nodes if 'Variable' in n.get('type', '')]
-    other_nodes = [n for n in nodes if n not in event_nodes + function_nodes + variable_nodes]
 
     # Show execution flow starting from events
     if event_nodes:
@@ -271,7 +302,7 @@ def generate_execution_chain(start_node: Dict[str, Any], all_nodes: List[Dict[st
         md += "\n"
 
         # Find next node in execution chain (follow exec output pins)
-        connections = current_node.get('connections', [])
+        connections = connection_map.get(node_id, [])
         next_node = None
         if connections:
             # Try to find the next connected node
@@ -335,14 +366,12 @@ def generate_node_detail(node: Dict[str, Any], index: int) -> str:
     title = node.get('title', 'Unknown').replace('\n', ' → ')
     node_type = node.get('type', 'Unknown')
     category = node.get('category', '')
-    position = node.get('position', {})
 
     md = f"**Node {index}: {title}**\n"
     md += f"- Type: `{node_type}`\n"
     if category:
         md += f"- Category: `{category}`\n"
     md += f"- ID: `{node_id}`\n"
-    md += f"- Position: ({position.get('x', 0)}, {position.get('y', 0)})\n"
 
     # Show all pins
     pins = node.get('pins', [])
@@ -360,7 +389,7 @@ def generate_node_detail(node: Dict[str, Any], index: int) -> str:
             md += pin_str + "\n"
 
     # Show connections
-    connections = node.get('connections', [])
+    connections = get_linked_node_ids(node)
     if connections:
         md += f"- Connected to: {', '.join([f'`{c}`' for c in connections])}\n"
 
@@ -369,16 +398,16 @@ def generate_node_detail(node: Dict[str, Any], index: int) -> str:
 
 
 def generate_markdown(data: Dict[str, Any]) -> str:
-    """Generate human-readable Markdown from blueprint data"""
-
-    exported_time = data.get('exported_at', datetime.now().isoformat())
+    """
+    Generate human-readable Markdown from blueprint data
+    The C++ exporter renders the same Markdown (FBlueprintMarkdownWriter); keep the two in step
+    """
 
     md = f"""# {data['name']}
 
 **Type:** {data.get('class_type', 'Blueprint')}
 **Path:** `{data.get('path', 'Unknown')}`
 **Parent Class:** {data.get('parent_class', 'None')}
-**Exported:** {exported_time}
 
 """
 
@@ -457,19 +486,15 @@ def export_blueprint(blueprint: unreal.Blueprint) -> bool:
 
         # Save JSON
         json_path = get_output_path(blueprint_path, blueprint_name, ".json")
-        with open(json_path, 'w', encoding='utf-8') as f:
-            json.dump(data, f, indent=2, ensure_ascii=False)
-
-        unreal.log(f"Exported JSON: {json_path}")
+        if write_if_changed(json_path, json.dumps(data, indent=2, ensure_ascii=False)):
+            unreal.log(f"Exported JSON: {json_path}")
 
         # Generate and save Markdown
         if GENERATE_MARKDOWN:
             md_content = generate_markdown(data)
             md_path = get_output_path(blueprint_path, blueprint_name, ".md")
-            with open(md_path, 'w', encoding='utf-8') as f:
-                f.write(md_content)
-
-            unreal.log(f"Exported Markdown: {md_path}")
+            if write_if_changed(md_path, md_content):
+                unreal.log(f"Exported Markdown: {md_path}")
 
         return True
 
@@ -482,6 +507,10 @@ def export_all_blueprints() -> int:
     """Export all blueprints in the project"""
     unreal.log("Starting blueprint export...")
 
+    # The C++ batch export writes every file natively; no JSON passes through Python
+    if INCLUDE_GRAPH_NODES and hasattr(unreal.BlueprintExporterLibrary, "export_blueprints_in_paths"):
+        return export_all_blueprints_native()
+
     # Get asset registry
     asset_registry = unreal.AssetRegistryHelpers.get_asset_registry()
 
@@ -507,8 +536,61 @@ def export_all_blueprints() -> int:
     return exported_count
 
 
+def make_native_config():
+    """Export configuration for the C++ batch export"""
+    config = unreal.BlueprintExportConfig()
+    config.output_directory = OUTPUT_DIR
+    config.generate_markdown = GENERATE_MARKDOWN
+    return config
+
+
+def export_blueprints_native(asset_paths: List[str]) -> List[Dict[str, Any]]:
+    """Export the given blueprints with the C++ batch export; returns one status dict per asset"""
+    results = unreal.BlueprintExporterLibrary.export_blueprint_batch(asset_paths, make_native_config())
+    return [result_to_dict(result) for result in results]
+
+
+def export_all_blueprints_native() -> int:
+    """Export all blueprints with the C++ batch export"""
+    results = [result_to_dict(result) for result in
+               unreal.BlueprintExporterLibrary.export_blueprints_in_paths(["/Game"], True, make_native_config())]
+
+    counts = {"exported": 0, "unchanged": 0, "failed": 0}
+    for result in results:
+        counts[result["status"]] += 1
+        if result["status"] == "failed":
+            unreal.log_warning(f"Failed to export {result['asset_path']}")
+
+    capture_ms = sum(result["load_ms"] + result["capture_ms"] for result in results)
+    write_ms = sum(result["write_ms"] for result in results)
+
+    # The C++ export also writes index.md, index.json and export_profile.json
+
+    unreal.log(f"Export complete! Exported {counts['exported']} blueprints to {OUTPUT_DIR} "
+               f"({counts['unchanged']} unchanged, {counts['failed']} failed; "
+               f"load+capture {capture_ms:.0f} ms, write {write_ms:.0f} ms)")
+    return counts["exported"] + counts["unchanged"]
+
+
+def result_to_dict(result) -> Dict[str, Any]:
+    """Convert an unreal.BlueprintExportResult to a plain dict"""
+    return {
+        "asset_path": result.asset_path,
+        "status": str(result.status.name).lower(),
+        "output_path": result.output_path,
+        "load_ms": result.load_ms,
+        "capture_ms": result.capture_ms,
+        "write_ms": result.write_ms,
+        "node_count": result.node_count,
+        "output_bytes": result.output_bytes,
+    }
+
+
 def generate_index():
-    """Generate an index file listing all exported blueprints"""
+    """
+    Generate an index file listing all exported blueprints
+    Only for the Python export; the C++ export writes index.md and index.json itself
+    """
     output_root = ensure_output_dir()
     index_path = os.path.join(output_root, "index.md")
 
@@ -546,12 +628,57 @@ def generate_index():
         content += f"- [{bp_name}]({bp_file})\n"
 
     # Write index
-    with open(index_path, 'w', encoding='utf-8') as f:
-        f.write(content)
+    write_if_changed(index_path, content)
 
     unreal.log(f"Generated index: {index_path}")
 
 
+# ============================================================================
+# AUTO EXPORT (C++ plugin)
+# ============================================================================
+
+def get_auto_export_subsystem():
+    """Get the C++ auto-export service"""
+    return unreal.get_editor_subsystem(unreal.BlueprintAutoExportSubsystem)
+
+
+def start_auto_export():
+    """Re-export blueprints in the background whenever they are saved"""
+    get_auto_export_subsystem().start()
+    unreal.log("Auto-export started")
+
+
+def stop_auto_export():
+    """Stop re-exporting blueprints on save"""
+    get_auto_export_subsystem().stop()
+    unreal.log("Auto-export stopped")
+
+
+def pause_auto_export():
+    """Keep collecting saves but don't export until resumed"""
+    get_auto_export_subsystem().pause()
+
+
+def resume_auto_export():
+    """Export everything collected while paused"""
+    get_auto_export_subsystem().resume()
+
+
+def get_auto_export_stats() -> Dict[str, Any]:
+    """Statistics for the current auto-export session"""
+    stats = get_auto_export_subsystem().get_stats()
+    return {
+        "events_received": stats.events_received,
+        "events_coalesced": stats.events_coalesced,
+        "exported": stats.exported_count,
+        "failed": stats.failed_count,
+        "pending": stats.pending_count,
+        "total_capture_ms": stats.total_capture_ms,
+        "max_capture_ms": stats.max_capture_ms,
+        "last_exported": stats.last_exported_blueprint,
+    }
+
+
 # ============================================================================
 # MAIN EXECUTION
 # ============================================================================
@@ -0,0 +1,198 @@
+"""
+Blueprint Exporter - MessagePack reader
+Reads the .msgpack files written with the MessagePack data format.
+
+The files hold the same schema as the JSON export (see JSON-SCHEMA.md), so
+load() returns the same dicts and lists json.load() returns for the .json file.
+
+Pure Python with no dependencies, so it runs inside and outside the editor. If the
+msgpack package is installed, its (much faster) C decoder is used instead.
+"""
+
+import struct
+from typing import Any, Tuple
+
+try:
+    import msgpack as _msgpack
+except ImportError:
+    _msgpack = None
+
+
+# ============================================================================
+# READING
+# ============================================================================
+
+def load(path: str) -> Any:
+    """Read a .msgpack export file"""
+    with open(path, 'rb') as f:
+        return loads(f.read())
+
+
+def loads(data: bytes) -> Any:
+    """Decode one MessagePack value"""
+    if _msgpack is not None:
+        return _msgpack.unpackb(data, raw=False)
+    return loads_pure(data)
+
+
+def loads_pure(data: bytes) -> Any:
+    """Decode one MessagePack value without the msgpack package"""
+    value, offset = _decode(data, 0)
+    if offset != len(data):
+        raise ValueError(f"Trailing data after MessagePack value at byte {offset}")
+    return value
+
+
+def _decode(data: bytes, offset: int) -> Tuple[Any, int]:
+    """Decode the value starting at offset; returns the value and the offset after it"""
+    tag = data[offset]
+    offset += 1
+
+    # Fixed-size forms
+    if tag <= 0x7f:
+        return tag, offset
+    if tag >= 0xe0:
+        return tag - 0x100, offset
+    if 0xa0 <= tag <= 0xbf:
+        return _decode_str(data, offset, tag & 0x1f)
+    if 0x90 <= tag <= 0x9f:
+        return _decode_array(data, offset, tag & 0x0f)
+    if 0x80 <= tag <= 0x8f:
+        return _decode_map(data, offset, tag & 0x0f)
+
+    if tag == 0xc0:
+        return None, offset
+    if tag == 0xc2:
+        return False, offset
+    if tag == 0xc3:
+        return True, offset
+
+    if tag in _INTEGER_FORMATS:
+        fmt = _INTEGER_FORMATS[tag]
+        return struct.unpack_from(fmt, data, offset)[0], offset + struct.calcsize(fmt)
+    if tag == 0xca:
+        return struct.unpack_from('>f', data, offset)[0], offset + 4
+    if tag == 0xcb:
+        return struct.unpack_from('>d', data, offset)[0], offset + 8
+
+    if tag in _LENGTH_FORMATS:
+        kind, fmt = _LENGTH_FORMATS[tag]
+        length = struct.unpack_from(fmt, data, offset)[0]
+        offset += struct.calcsize(fmt)
+        if kind == 'str':
+            return _decode_str(data, offset, length)
+        if kind == 'bin':
+            return bytes(data[offset:offset + length]), offset + length
+        if kind == 'array':
+            return _decode_array(data, offset, length)
+        return _decode_map(data, offset, length)
+
+    raise ValueError(f"Unsupported MessagePack type 0x{tag:02x} at byte {offset - 1}")
+
+
+def _decode_str(data: bytes, offset: int, length: int) -> Tuple[str, int]:
+    end = offset + length
+    return data[offset:end].decode('utf-8'), end
+
+
+def _decode_array(data: bytes, offset: int, count: int) -> Tuple[list, int]:
+    items = []
+    for _ in range(count):
+        item, offset = _decode(data, offset)
+        items.append(item)
+    return items, offset
+
+
+def _decode_map(data: bytes, offset: int, count: int) -> Tuple[dict, int]:
+    result = {}
+    for _ in range(count):
+        key, offset = _decode(data, offset)
+        value, offset = _decode(data, offset)
+        result[key] = value
+    return result, offset
+
+
+_INTEGER_FORMATS = {
+    0xcc: '>B', 0xcd: '>H', 0xce: '>I', 0xcf: '>Q',
+    0xd0: '>b', 0xd1: '>h', 0xd2: '>i', 0xd3: '>q',
+}
+
+_LENGTH_FORMATS = {
+    0xd9: ('str', '>B'), 0xda: ('str', '>H'), 0xdb: ('str', '>I'),
+    0xc4: ('bin', '>B'), 0xc5: ('bin', '>H'), 0xc6: ('bin', '>I'),
+    0xdc: ('array', '>H'), 0xdd: ('array', '>I'),
+    0xde: ('map', '>H'), 0xdf: ('map', '>I'),
+}
+
+
+# ============================================================================
+# WRITING
+# ============================================================================
+
+def dumps(value: Any) -> bytes:
+    """
+    Encode a value the way the exporter does (minimal headers, keys in dict order)
+    Converting a .json export gives the bytes the MessagePack format would have written.
+    """
+    out = bytearray()
+    _encode(value, out)
+    return bytes(out)
+
+
+def _encode(value: Any, out: bytearray):
+    if value is None:
+        out.append(0xc0)
+    elif value is True:
+        out.append(0xc3)
+    elif value is False:
+        out.append(0xc2)
+    elif isinstance(value, int):
+        _encode_int(value, out)
+    elif isinstance(value, float):
+        out.append(0xcb)
+        out += struct.pack('>d', value)
+    elif isinstance(value, str):
+        encoded = value.encode('utf-8')
+        _encode_header(len(encoded), out, 0xa0, 32, 0xd9, 0xda, 0xdb)
+        out += encoded
+    elif isinstance(value, (list, tuple)):
+        _encode_header(len(value), out, 0x90, 16, None, 0xdc, 0xdd)
+        for item in value:
+            _encode(item, out)
+    elif isinstance(value, dict):
+        _encode_header(len(value), out, 0x80, 16, None, 0xde, 0xdf)
+        for key, item in value.items():
+            _encode(key, out)
+            _encode(item, out)
+    else:
+        raise TypeError(f"Cannot encode {type(value).__name__} as MessagePack")
+
+
+def _encode_header(length: int, out: bytearray, fix_tag: int, fix_limit: int, tag8, tag16: int, tag32: int):
+    if length < fix_limit:
+        out.append(fix_tag | length)
+    elif tag8 is not None and length <= 0xff:
+        out += struct.pack('>BB', tag8, length)
+    elif length <= 0xffff:
+        out += struct.pack('>BH', tag16, length)
+    else:
+        out += struct.pack('>BI', tag32, length)
+
+
+def _encode_int(value: int, out: bytearray):
+    if 0 <= value < 128:
+        out.append(value)
+    elif -32 <= value < 0:
+        out.append(value + 0x100)
+    elif value > 0:
+        for tag, fmt, limit in ((0xcc, '>BB', 0xff), (0xcd, '>BH', 0xffff), (0xce, '>BI', 0xffffffff)):
+            if value <= limit:
+                out += struct.pack(fmt, tag, value)
+                return
+        out += struct.pack('>BQ', 0xcf, value)
+    else:
+        for tag, fmt, limit in ((0xd0, '>Bb', -0x80), (0xd1, '>Bh', -0x8000), (0xd2, '>Bi', -0x80000000)):
+            if value >= limit:
+                out += struct.pack(fmt, tag, value)
+                return
+        out += struct.pack('>Bq', 0xd3, value)
@@ -0,0 +1,232 @@
+"""
+Blueprint Exporter - symbol queries
+Reads the symbol_index.bin written by every bulk export and answers "which
+blueprints call function X, read or write variable Y, or spawn class Z" without
+opening a single blueprint export.
+
+    import blueprint_symbols
+    index = blueprint_symbols.load("Exported/Blueprints")
+    index.calls("K2_DestroyActor")                          # any owner class
+    index.calls("K2_DestroyActor", "/Script/Engine.Actor")  # exact
+    index.reads("Health")
+    index.writes("Health", "/Game/BP_Player.BP_Player_C")
+    index.spawns("/Game/BP_Projectile.BP_Projectile_C")
+    index.lookup("call:PrintString@/Script/Engine.KismetSystemLibrary")
+
+    python blueprint_symbols.py <ExportDirectory> calls|reads|writes|spawns <Name> [--owner <ClassPath>]
+    python blueprint_symbols.py <ExportDirectory> symbols [<Prefix>]
+
+Symbols are "call:<Function>@<Class>", "get:<Variable>@<Class>", "set:<Variable>@<Class>"
+and "spawn:<Class>". Each query returns References (blueprint, graph, node), sorted.
+The file is memory-mapped and binary-searched in place, so opening it costs nothing
+however large the project. See JSON-SCHEMA.md for the format. Runs inside and
+outside the editor.
+"""
+
+import argparse
+import glob
+import mmap
+import os
+import struct
+import sys
+from typing import Dict, List, NamedTuple
+
+INDEX_PATTERN = "symbol_index*.bin"
+MAGIC = b"BPSI"
+# Version of the binary layout (SymbolIndexLayoutVersion), not the export format version
+LAYOUT_VERSION = 1
+
+_HEADER = struct.Struct("<4s5I")
+_UINT32 = struct.Struct("<I")
+_TRIPLE = struct.Struct("<3I")
+
+
+class Reference(NamedTuple):
+    """A node referring to a symbol"""
+    blueprint: str
+    graph: str
+    node: str
+
+
+class _Queries:
+    """Queries shared by a single index file and a set of shards"""
+
+    def lookup(self, symbol: str) -> List[Reference]:
+        raise NotImplementedError
+
+    def search(self, prefix: str) -> Dict[str, List[Reference]]:
+        raise NotImplementedError
+
+    def symbols(self, prefix: str = "") -> List[str]:
+        """Sorted symbols starting with prefix"""
+        return sorted(self.search(prefix))
+
+    def calls(self, function: str, owner: str = None) -> List[Reference]:
+        """Nodes calling function, on owner (a class path) or on any class"""
+        return self._member("call", function, owner)
+
+    def reads(self, variable: str, owner: str = None) -> List[Reference]:
+        """Nodes getting variable"""
+        return self._member("get", variable, owner)
+
+    def writes(self, variable: str, owner: str = None) -> List[Reference]:
+        """Nodes setting variable"""
+        return self._member("set", variable, owner)
+
+    def spawns(self, class_path: str) -> List[Reference]:
+        """Nodes spawning or constructing class_path"""
+        return self.lookup(f"spawn:{class_path}")
+
+    def _member(self, kind: str, name: str, owner: str) -> List[Reference]:
+        if owner is not None:
+            return self.lookup(f"{kind}:{name}@{owner}")
+        references = []
+        for symbol_references in self.search(f"{kind}:{name}@").values():
+            references.extend(symbol_references)
+        return sorted(references)
+
+
+class SymbolIndex(_Queries):
+    """One memory-mapped symbol_index.bin"""
+
+    def __init__(self, path: str):
+        self.path = path
+        with open(path, 'rb') as f:
+            self._data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) if os.fstat(f.fileno()).st_size else b""
+
+        if len(self._data) < _HEADER.size:
+            raise ValueError(f"{path}: not a symbol index")
+        magic, version, self._string_count, self._blueprint_count, self._symbol_count, self._posting_count = \
+            _HEADER.unpack_from(self._data, 0)
+        if magic != MAGIC:
+            raise ValueError(f"{path}: not a symbol index")
+        if version != LAYOUT_VERSION:
+            raise ValueError(f"{path}: layout version {version}, expected {LAYOUT_VERSION}")
+
+        self._offsets = _HEADER.size
+        self._blueprints = self._offsets + (self._string_count + 1) * 4
+        self._symbols = self._blueprints + self._blueprint_count * 4
+        self._postings = self._symbols + self._symbol_count * 12
+        self._string_data = self._postings + self._posting_count * 12
+
+    def _bytes(self, string: int) -> bytes:
+        begin, end = struct.unpack_from("<2I", self._data, self._offsets + string * 4)
+        return self._data[self._string_data + begin:self._string_data + end]
+
+    def _string(self, string: int) -> str:
+        return self._bytes(string).decode('utf-8')
+
+    def _symbol_key(self, symbol: int) -> bytes:
+        return self._bytes(_UINT32.unpack_from(self._data, self._symbols + symbol * 12)[0])
+
+    def _lower_bound(self, key: bytes) -> int:
+        """First symbol whose key is not less than key; keys sort bytewise"""
+        low, high = 0, self._symbol_count
+        while low < high:
+            middle = (low + high) // 2
+            if self._symbol_key(middle) < key:
+                low = middle + 1
+            else:
+                high = middle
+        return low
+
+    def _references(self, symbol: int) -> List[Reference]:
+        _, first, count = _TRIPLE.unpack_from(self._data, self._symbols + symbol * 12)
+        references = []
+        for posting in range(first, first + count):
+            blueprint, graph, node = _TRIPLE.unpack_from(self._data, self._postings + posting * 12)
+            references.append(Reference(self._string(blueprint), self._string(graph), self._string(node)))
+        return references
+
+    def __len__(self) -> int:
+        return self._symbol_count
+
+    def blueprints(self) -> List[str]:
+        """Asset paths of every indexed blueprint, sorted"""
+        return [self._string(_UINT32.unpack_from(self._data, self._blueprints + index * 4)[0])
+                for index in range(self._blueprint_count)]
+
+    def lookup(self, symbol: str) -> List[Reference]:
+        """Nodes referring to exactly this symbol"""
+        key = symbol.encode('utf-8')
+        index = self._lower_bound(key)
+        if index < self._symbol_count and self._symbol_key(index) == key:
+            return self._references(index)
+        return []
+
+    def search(self, prefix: str) -> Dict[str, List[Reference]]:
+        """References of every symbol starting with prefix"""
+        key = prefix.encode('utf-8')
+        results = {}
+        index = self._lower_bound(key)
+        while index < self._symbol_count:
+            symbol_key = self._symbol_key(index)
+            if not symbol_key.startswith(key):
+                break
+            results[symbol_key.decode('utf-8')] = self._references(index)
+            index += 1
+        return results
+
+
+class ShardedSymbolIndex(_Queries):
+    """The symbol indexes of a sharded export, queried together"""
+
+    def __init__(self, shards: List[SymbolIndex]):
+        self.shards = shards
+
+    def __len__(self) -> int:
+        return len(self.symbols())
+
+    def blueprints(self) -> List[str]:
+        return sorted({blueprint for shard in self.shards for blueprint in shard.blueprints()})
+
+    def lookup(self, symbol: str) -> List[Reference]:
+        return sorted(reference for shard in self.shards for reference in shard.lookup(symbol))
+
+    def search(self, prefix: str) -> Dict[str, List[Reference]]:
+        results: Dict[str, List[Reference]] = {}
+        for shard in self.shards:
+            for symbol, references in shard.search(prefix).items():
+                results.setdefault(symbol, []).extend(references)
+        return {symbol: sorted(references) for symbol, references in results.items()}
+
+
+def load(export_dir: str) -> _Queries:
+    """Open the symbol index of an export directory; shards are queried together"""
+    paths = sorted(glob.glob(os.path.join(export_dir, INDEX_PATTERN)))
+    if not paths:
+        raise FileNotFoundError(f"No {INDEX_PATTERN} in {export_dir}")
+    if len(paths) == 1:
+        return SymbolIndex(paths[0])
+    return ShardedSymbolIndex([SymbolIndex(path) for path in paths])
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Query the blueprint symbol index of an export")
+    parser.add_argument("export_dir", help="Export directory containing symbol_index.bin")
+    parser.add_argument("query", choices=("calls", "reads", "writes", "spawns", "symbols"))
+    parser.add_argument("name", nargs="?", default="", help="Function, variable or class path; a prefix for 'symbols'")
+    parser.add_argument("--owner", help="Class path owning the function or variable")
+    args = parser.parse_args()
+
+    index = load(args.export_dir)
+    if args.query == "symbols":
+        for symbol in index.symbols(args.name):
+            print(symbol)
+        return 0
+
+    if not args.name:
+        parser.error(f"'{args.query}' needs a name")
+
+    if args.query == "spawns":
+        references = index.spawns(args.name)
+    else:
+        references = getattr(index, args.query)(args.name, args.owner)
+
+    for reference in references:
+        print(f"{reference.blueprint}\t{reference.graph}\t{reference.node}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
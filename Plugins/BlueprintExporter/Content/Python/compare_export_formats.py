@@ -0,0 +1,107 @@
+"""
+Compare the JSON and MessagePack data formats on an existing export
+Reports total size and parse time of every blueprint in both formats.
+
+    python compare_export_formats.py <ExportDirectory> [--iterations N]
+
+Runs outside the editor. For each <Name>.json the <Name>.msgpack next to it is used
+if present (export once with each format into the same directory); otherwise the
+JSON is encoded with blueprint_msgpack.dumps, which produces the same bytes the
+exporter writes.
+"""
+
+import argparse
+import json
+import os
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import blueprint_msgpack  # noqa: E402
+
+# Files the exporter writes next to the blueprints
+NON_BLUEPRINT_PREFIXES = ("export_manifest", "export_summary", "index", "dependency_graph", "blueprints.")
+
+
+def find_blueprint_files(export_dir: str):
+    """Yield (json_path, msgpack_path or None) for every exported blueprint"""
+    for root, dirs, files in os.walk(export_dir):
+        dirs.sort()
+        for file in sorted(files):
+            if not file.endswith('.json') or file.startswith(NON_BLUEPRINT_PREFIXES):
+                continue
+            json_path = os.path.join(root, file)
+            msgpack_path = json_path[:-len('.json')] + '.msgpack'
+            yield json_path, (msgpack_path if os.path.exists(msgpack_path) else None)
+
+
+def time_parse(parse, data, iterations: int) -> float:
+    """Seconds per parse, best of iterations"""
+    best = float('inf')
+    for _ in range(iterations):
+        start = time.perf_counter()
+        parse(data)
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare JSON and MessagePack blueprint exports")
+    parser.add_argument("export_dir", help="Directory containing a JSON export")
+    parser.add_argument("--iterations", type=int, default=5, help="Parses per file (best time is kept)")
+    args = parser.parse_args()
+
+    totals = {"files": 0, "json_bytes": 0, "msgpack_bytes": 0,
+              "json_seconds": 0.0, "msgpack_seconds": 0.0, "msgpack_pure_seconds": 0.0}
+    mismatches = []
+
+    for json_path, msgpack_path in find_blueprint_files(args.export_dir):
+        with open(json_path, 'rb') as f:
+            json_bytes = f.read()
+        data = json.loads(json_bytes)
+
+        if msgpack_path:
+            with open(msgpack_path, 'rb') as f:
+                msgpack_bytes = f.read()
+            # Both files must carry the same data
+            if blueprint_msgpack.loads(msgpack_bytes) != data:
+                mismatches.append(msgpack_path)
+        else:
+            msgpack_bytes = blueprint_msgpack.dumps(data)
+
+        totals["files"] += 1
+        totals["json_bytes"] += len(json_bytes)
+        totals["msgpack_bytes"] += len(msgpack_bytes)
+        totals["json_seconds"] += time_parse(json.loads, json_bytes, args.iterations)
+        totals["msgpack_seconds"] += time_parse(blueprint_msgpack.loads, msgpack_bytes, args.iterations)
+        totals["msgpack_pure_seconds"] += time_parse(blueprint_msgpack.loads_pure, msgpack_bytes, args.iterations)
+
+    if totals["files"] == 0:
+        print(f"No exported blueprints found in {args.export_dir}")
+        return 1
+
+    def ratio(value, reference):
+        return f"{value / reference:.2f}x" if reference else "n/a"
+
+    print(f"Blueprints:        {totals['files']}")
+    print(f"JSON size:         {totals['json_bytes']:>12,} bytes")
+    print(f"MessagePack size:  {totals['msgpack_bytes']:>12,} bytes "
+          f"({ratio(totals['msgpack_bytes'], totals['json_bytes'])} of JSON)")
+    print(f"JSON parse:        {totals['json_seconds'] * 1000:>12.1f} ms (json.loads)")
+    if blueprint_msgpack._msgpack is not None:
+        print(f"MessagePack parse: {totals['msgpack_seconds'] * 1000:>12.1f} ms (msgpack package) "
+              f"({ratio(totals['msgpack_seconds'], totals['json_seconds'])} of JSON)")
+    print(f"MessagePack parse: {totals['msgpack_pure_seconds'] * 1000:>12.1f} ms (pure Python reader) "
+          f"({ratio(totals['msgpack_pure_seconds'], totals['json_seconds'])} of JSON)")
+    print("For native parse times run Tools/MsgPackReader/BlueprintMsgPackToJson --time N on the .msgpack files.")
+
+    if mismatches:
+        print(f"\n{len(mismatches)} MessagePack files don't match their JSON:")
+        for path in mismatches:
+            print(f"  {path}")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,312 @@
+// BlueprintAutoExportSubsystem.cpp
+
+#include "BlueprintAutoExportSubsystem.h"
+#include "BlueprintExporter.h"
+#include "BlueprintBulkExporter.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "UObject/Package.h"
+
+void UBlueprintAutoExportSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (!IsRunningCommandlet() && GetDefault<UBlueprintExporterSettings>()->bAutoExportOnSave)
+	{
+		Start();
+	}
+}
+
+void UBlueprintAutoExportSubsystem::Deinitialize()
+{
+	Stop();
+
+	Super::Deinitialize();
+}
+
+TStatId UBlueprintAutoExportSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBlueprintAutoExportSubsystem, STATGROUP_Tickables);
+}
+
+// ============================================================================
+// Controls
+// ============================================================================
+
+void UBlueprintAutoExportSubsystem::Start()
+{
+	if (bRunning)
+	{
+		return;
+	}
+
+	const UBlueprintExporterSettings* Settings = GetDefault<UBlueprintExporterSettings>();
+	OutputDirectory = FPaths::Combine(FPaths::ProjectDir(), Settings->OutputDirectory);
+
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddUObject(this, &UBlueprintAutoExportSubsystem::OnPackageSaved);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddUObject(this, &UBlueprintAutoExportSubsystem::OnAssetUpdated);
+
+	bRunning = true;
+	bPaused = false;
+
+	UE_LOG(LogBlueprintExporter, Log, TEXT("Auto-export started (debounce %.1fs, budget %.1fms) -> %s"),
+		Settings->AutoExportDebounceSeconds, Settings->AutoExportTickBudgetMs, *OutputDirectory);
+}
+
+void UBlueprintAutoExportSubsystem::Stop()
+{
+	if (!bRunning)
+	{
+		return;
+	}
+
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+	PackageSavedHandle.Reset();
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		AssetRegistryModule->Get().OnAssetUpdated().Remove(AssetUpdatedHandle);
+	}
+	AssetUpdatedHandle.Reset();
+
+	Debouncing.Reset();
+	ReadyQueue.Reset();
+	ReadySet.Reset();
+
+	bRunning = false;
+	bPaused = false;
+
+	UE_LOG(LogBlueprintExporter, Log, TEXT("Auto-export stopped (%d exported, %d failed)"), Stats.ExportedCount, Stats.FailedCount);
+}
+
+void UBlueprintAutoExportSubsystem::Pause()
+{
+	if (bRunning)
+	{
+		bPaused = true;
+	}
+}
+
+void UBlueprintAutoExportSubsystem::Resume()
+{
+	bPaused = false;
+}
+
+FBlueprintAutoExportStats UBlueprintAutoExportSubsystem::GetStats() const
+{
+	FBlueprintAutoExportStats Result = Stats;
+	Result.PendingCount = Debouncing.Num() + ReadyQueue.Num();
+	return Result;
+}
+
+void UBlueprintAutoExportSubsystem::ResetStats()
+{
+	Stats = FBlueprintAutoExportStats();
+}
+
+void UBlueprintAutoExportSubsystem::QueueBlueprint(const FString& PackageName)
+{
+	NotifyChanged(FName(*PackageName));
+}
+
+// ============================================================================
+// Events
+// ============================================================================
+
+void UBlueprintAutoExportSubsystem::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	// Ignore cooking and procedural saves; only user saves matter here
+	if (!Package || ObjectSaveContext.IsProceduralSave())
+	{
+		return;
+	}
+
+	// Cheap check without the asset registry: does the package contain a blueprint?
+	bool bHasBlueprint = false;
+	ForEachObjectWithPackage(Package, [&bHasBlueprint](UObject* Object)
+	{
+		bHasBlueprint = Object->IsA<UBlueprint>();
+		return !bHasBlueprint;
+	}, false);
+
+	if (bHasBlueprint)
+	{
+		NotifyChanged(Package->GetFName());
+	}
+}
+
+void UBlueprintAutoExportSubsystem::OnAssetUpdated(const FAssetData& AssetData)
+{
+	if (AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+	{
+		NotifyChanged(AssetData.PackageName);
+	}
+}
+
+void UBlueprintAutoExportSubsystem::NotifyChanged(FName PackageName)
+{
+	if (!bRunning || PackageName.IsNone())
+	{
+		return;
+	}
+
+	Stats.EventsReceived++;
+
+	// Already waiting: restart its debounce period instead of queueing twice
+	if (Debouncing.Contains(PackageName) || ReadySet.Contains(PackageName))
+	{
+		Stats.EventsCoalesced++;
+	}
+
+	if (!ReadySet.Contains(PackageName))
+	{
+		Debouncing.Add(PackageName, FPlatformTime::Seconds());
+	}
+}
+
+// ============================================================================
+// Tick
+// ============================================================================
+
+void UBlueprintAutoExportSubsystem::Tick(float DeltaTime)
+{
+	if (!bRunning || bPaused)
+	{
+		return;
+	}
+
+	PromoteDebounced(FPlatformTime::Seconds());
+	if (ReadyQueue.Num() == 0)
+	{
+		return;
+	}
+
+	// One batch per tick, so the manifest and indexes are read and written once: at least one
+	// blueprint, then as many as the average capture time so far fits into the budget
+	const float BudgetMs = GetDefault<UBlueprintExporterSettings>()->AutoExportTickBudgetMs;
+	const int32 CapturedCount = Stats.ExportedCount + Stats.FailedCount;
+	const float AverageCaptureMs = CapturedCount > 0 ? Stats.TotalCaptureMs / CapturedCount : BudgetMs;
+	const int32 BatchSize = FMath::Max(1, FMath::FloorToInt(BudgetMs / FMath::Max(AverageCaptureMs, 0.01f)));
+
+	TArray<FName> Batch;
+	while (ReadyQueue.Num() > 0 && Batch.Num() < BatchSize)
+	{
+		FReadyExport Next;
+		ReadyQueue.HeapPop(Next, FReadyExportPredicate());
+		ReadySet.Remove(Next.PackageName);
+		Batch.Add(Next.PackageName);
+	}
+
+	ExportPackages(Batch);
+}
+
+void UBlueprintAutoExportSubsystem::PromoteDebounced(double Now)
+{
+	const double DebounceSeconds = GetDefault<UBlueprintExporterSettings>()->AutoExportDebounceSeconds;
+
+	for (auto It = Debouncing.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value() < DebounceSeconds)
+		{
+			continue;
+		}
+
+		FReadyExport Ready;
+		Ready.PackageName = It.Key();
+		Ready.Priority = GetPriority(It.Key());
+		Ready.Sequence = NextSequence++;
+
+		ReadyQueue.HeapPush(Ready, FReadyExportPredicate());
+		ReadySet.Add(It.Key());
+		It.RemoveCurrent();
+	}
+}
+
+int32 UBlueprintAutoExportSubsystem::GetPriority(FName PackageName) const
+{
+	UPackage* Package = FindPackage(nullptr, *PackageName.ToString());
+	UAssetEditorSubsystem* AssetEditorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
+	if (!Package || !AssetEditorSubsystem)
+	{
+		return 0;
+	}
+
+	int32 Priority = 0;
+	ForEachObjectWithPackage(Package, [AssetEditorSubsystem, &Priority](UObject* Object)
+	{
+		if (Object->IsA<UBlueprint>() && AssetEditorSubsystem->FindEditorForAsset(Object, false))
+		{
+			Priority = 1;
+			return false;
+		}
+		return true;
+	}, false);
+
+	return Priority;
+}
+
+void UBlueprintAutoExportSubsystem::ExportPackages(const TArray<FName>& PackageNames)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	TArray<FAssetData> Assets;
+	for (const FName& PackageName : PackageNames)
+	{
+		TArray<FAssetData> PackageAssets;
+		AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets);
+		for (FAssetData& AssetData : PackageAssets)
+		{
+			if (AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+			{
+				Assets.Add(MoveTemp(AssetData));
+			}
+		}
+	}
+
+	if (Assets.Num() == 0)
+	{
+		return;
+	}
+
+	// A batch is a subset of the project: only deleted blueprints count as stale
+	TArray<FAssetData> ProjectAssets;
+	FBlueprintBulkExporter::GatherBlueprintAssets(ProjectAssets);
+
+	TSet<FName> ProjectPackageNames;
+	for (const FAssetData& AssetData : ProjectAssets)
+	{
+		ProjectPackageNames.Add(AssetData.PackageName);
+	}
+
+	// Saved blueprints are loaded already: no memory budget, so no garbage collection in the middle of editing
+	FBlueprintExportConfig Config = GetDefault<UBlueprintExporterSettings>()->ToExportConfig();
+	Config.MemoryBudgetMB = 0;
+
+	FBlueprintBulkExporter Exporter(OutputDirectory, Config);
+	Exporter.SetProjectPackageNames(MoveTemp(ProjectPackageNames));
+	Exporter.SetShowProgress(false);
+	Exporter.Run(Assets);
+
+	for (const FBlueprintExportResult& Result : Exporter.GetResults())
+	{
+		Stats.TotalCaptureMs += Result.CaptureMs;
+		Stats.MaxCaptureMs = FMath::Max(Stats.MaxCaptureMs, Result.CaptureMs);
+
+		if (Result.Status == EBlueprintExportStatus::Failed)
+		{
+			Stats.FailedCount++;
+		}
+		else
+		{
+			Stats.ExportedCount++;
+			Stats.LastExportedBlueprint = Result.AssetPath;
+		}
+	}
+}
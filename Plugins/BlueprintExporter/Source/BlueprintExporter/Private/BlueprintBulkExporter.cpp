@@ -0,0 +1,543 @@
+// BlueprintBulkExporter.cpp
+
+#include "BlueprintBulkExporter.h"
+#include "BlueprintPackagePrefetcher.h"
+#include "BlueprintSnapshotHash.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/Async.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Modules/ModuleManager.h"
+#include "PackageTools.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+FBlueprintBulkExporter::FBlueprintBulkExporter(const FString& InOutputDirectory, const FBlueprintExportConfig& InConfig)
+	: OutputDirectory(InOutputDirectory)
+	, Config(InConfig)
+	, Pipeline(FBlueprintExportPipeline::CreateDefault(InConfig))
+	, Manifest(InOutputDirectory)
+	, SettingsHash(FBlueprintExportManifest::ComputeSettingsHash(InConfig))
+	, DependencyIndex(InOutputDirectory)
+	, SymbolIndex(InOutputDirectory)
+	, ProjectIndex(InOutputDirectory)
+	, JsonOptions(FBlueprintExportPipeline::MakeJsonOptions(InConfig))
+{
+}
+
+FString FBlueprintBulkExporter::MakeShardSuffix(int32 ShardIndex, int32 ShardCount)
+{
+	return ShardCount > 1 ? FString::Printf(TEXT(".shard-%d-of-%d"), ShardIndex, ShardCount) : FString();
+}
+
+void FBlueprintBulkExporter::SetShard(int32 ShardIndex, int32 InShardCount)
+{
+	ShardCount = FMath::Max(InShardCount, 1);
+	const FString Suffix = MakeShardSuffix(ShardIndex, ShardCount);
+
+	Manifest = FBlueprintExportManifest(OutputDirectory, FPaths::GetBaseFilename(FBlueprintExportManifest::FileName) + Suffix + TEXT(".json"));
+	SetBundleFileName(FPaths::GetBaseFilename(FBlueprintBundleWriter::DefaultFileName) + Suffix + TEXT(".ndjson"));
+	SetDependencyIndexFileName(FPaths::GetBaseFilename(FBlueprintDependencyIndex::FileName) + Suffix + TEXT(".json"));
+	SetProjectIndexFileName(FBlueprintProjectIndex::BaseFileName + Suffix);
+	SetSymbolIndexFileName(FPaths::GetBaseFilename(FBlueprintSymbolIndex::FileName) + Suffix + TEXT(".bin"));
+	SetProfileFileName(FPaths::GetBaseFilename(FBlueprintExportProfile::FileName) + Suffix + TEXT(".json"));
+}
+
+void FBlueprintBulkExporter::GatherBlueprintAssets(TArray<FAssetData>& OutAssets)
+{
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), OutAssets);
+}
+
+int32 FBlueprintBulkExporter::Run(const TArray<FAssetData>& Assets)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(BlueprintExporter_Run);
+	const double RunStartTime = FPlatformTime::Seconds();
+	FBlueprintExportProfile::Reset();
+
+	const bool bParallel = Config.bParallelExport && FApp::ShouldUseThreadingForPerformance();
+	const int32 MaxInFlight = GetMaxInFlight();
+
+	if (!ProjectPackageNames.IsSet())
+	{
+		TSet<FName> LivePackageNames;
+		for (const FAssetData& AssetData : Assets)
+		{
+			LivePackageNames.Add(AssetData.PackageName);
+		}
+		ProjectPackageNames = MoveTemp(LivePackageNames);
+	}
+
+	// Full exports don't skip anything, but still keep the entries of blueprints outside this export
+	// and clean up after deleted ones, so the manifest stays complete for the next run
+	Manifest.Load();
+	RemovedCount = Manifest.RemoveStale(ProjectPackageNames.GetValue());
+
+	// Unchanged blueprints keep their entries, and exports of a subset keep everyone else's
+	DependencyIndex.Load();
+	DependencyIndex.RemoveStale(ProjectPackageNames.GetValue());
+	SymbolIndex.Load();
+	SymbolIndex.RemoveStale(ProjectPackageNames.GetValue());
+	ProjectIndex.Load();
+	ProjectIndex.RemoveStale(ProjectPackageNames.GetValue());
+
+	if (Config.bBundleExport)
+	{
+		// The previous bundle supplies unchanged records and those of blueprints outside this export
+		Bundle = MakeUnique<FBlueprintBundleWriter>(OutputDirectory, BundleFileName);
+		Bundle->LoadPrevious();
+		if (!Bundle->Open())
+		{
+			Results.SetNum(Assets.Num());
+			for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+			{
+				Results[AssetIndex].AssetPath = Assets[AssetIndex].GetSoftObjectPath().ToString();
+				Results[AssetIndex].Status = EBlueprintExportStatus::Failed;
+				FailedPackageNames.Add(Assets[AssetIndex].PackageName);
+			}
+			FailedCount = Assets.Num();
+			return 0;
+		}
+	}
+
+	// Decide what needs exporting before loading anything, so the prefetcher knows what comes next
+	TArray<const FAssetData*> ToExport;
+	TArray<int32> ResultIndices;
+	TArray<FString> SourceHashes;
+	TArray<FName> PackageNames;
+	Results.SetNum(Assets.Num());
+	for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+	{
+		const FAssetData& AssetData = Assets[AssetIndex];
+		Results[AssetIndex].AssetPath = AssetData.GetSoftObjectPath().ToString();
+
+		FString SourceHash = FBlueprintExportManifest::ComputeSourceHash(AssetData);
+
+		// Unchanged since the last export: skip without loading the package
+		if (Config.bIncrementalExport && Manifest.IsUpToDate(AssetData.PackageName, SourceHash, SettingsHash)
+			&& DependencyIndex.Contains(Results[AssetIndex].AssetPath)
+			&& SymbolIndex.Contains(Results[AssetIndex].AssetPath)
+			&& ProjectIndex.Contains(Results[AssetIndex].AssetPath)
+			&& (!Bundle.IsValid() || Bundle->HasPreviousRecord(Results[AssetIndex].AssetPath)))
+		{
+			SkippedCount++;
+			Results[AssetIndex].Status = EBlueprintExportStatus::Unchanged;
+			UnchangedIndices.Add(AssetIndex);
+			continue;
+		}
+
+		ToExport.Add(&AssetData);
+		ResultIndices.Add(AssetIndex);
+		SourceHashes.Add(MoveTemp(SourceHash));
+		PackageNames.Add(AssetData.PackageName);
+
+		// Packages the user already had loaded are never unloaded by the exporter
+		if (FindObjectFast<UPackage>(nullptr, AssetData.PackageName))
+		{
+			UserLoadedPackages.Add(AssetData.PackageName);
+		}
+	}
+
+	FScopedSlowTask Progress(ToExport.Num(), FText::FromString("Exporting Blueprints"));
+	if (bShowProgress)
+	{
+		Progress.MakeDialog();
+	}
+
+	FBlueprintPackagePrefetcher Prefetcher(Config.MaxPrefetchPackages, static_cast<int64>(Config.PrefetchMemoryBudgetMB) * 1024 * 1024);
+	Prefetcher.SetQueue(MoveTemp(PackageNames));
+
+	for (int32 Index = 0; Index < ToExport.Num(); ++Index)
+	{
+		const FAssetData& AssetData = *ToExport[Index];
+		Progress.EnterProgressFrame(1.0f, FText::FromString(FString::Printf(TEXT("Exporting %s"), *AssetData.AssetName.ToString())));
+
+		FPendingExport Pending;
+		Pending.PackageName = AssetData.PackageName;
+		Pending.ResultIndex = ResultIndices[Index];
+		Pending.SourceHash = MoveTemp(SourceHashes[Index]);
+		FBlueprintExportResult& Result = Results[Pending.ResultIndex];
+
+		// Keep the loader busy with the next packages while this one is captured and written
+		const double LoadStartTime = FPlatformTime::Seconds();
+		UBlueprint* Blueprint = nullptr;
+		{
+			BLUEPRINT_EXPORT_PHASE_SCOPE(Load);
+			Prefetcher.Pump(Index);
+			Prefetcher.WaitFor(Index);
+
+			// Game thread: load and capture (all UObject access happens here)
+			Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+		}
+		const double CaptureStartTime = FPlatformTime::Seconds();
+		FBlueprintSnapshot Snapshot;
+		const bool bCaptured = Blueprint && UBlueprintExporterLibrary::CaptureBlueprint(Blueprint, Snapshot);
+		Result.LoadMs = static_cast<float>((CaptureStartTime - LoadStartTime) * 1000.0);
+		Result.CaptureMs = static_cast<float>((FPlatformTime::Seconds() - CaptureStartTime) * 1000.0);
+		for (const FBlueprintGraphSnapshot& Graph : Snapshot.Graphs)
+		{
+			Result.NodeCount += Graph.Nodes.Num();
+		}
+
+		// Once captured, the package is no longer needed by the export
+		if (!UserLoadedPackages.Contains(Pending.PackageName))
+		{
+			PackagesToRelease.Add(Pending.PackageName);
+		}
+		EnforceMemoryBudget();
+
+		if (!bCaptured)
+		{
+			RecordResult(Pending, false);
+			continue;
+		}
+
+		{
+			BLUEPRINT_EXPORT_PHASE_SCOPE(UpdateIndexes);
+			DependencyIndex.Update(Snapshot);
+			SymbolIndex.Update(Snapshot);
+			ProjectIndex.Update(Snapshot);
+		}
+
+		Pending.ContentHash = FBlueprintSnapshotHash::ToString(Snapshot.Hash);
+
+		if (Bundle.IsValid())
+		{
+			Pending.BundleRecord = MakeShared<FBlueprintBundleRecord>();
+		}
+		else
+		{
+			Pending.BasePath = FBlueprintExportPipeline::MakeOutputBasePath(OutputDirectory, AssetData.PackageName.ToString(), Snapshot.Name);
+
+			// The files already hold exactly this content: don't format or compare them again
+			if (Config.bIncrementalExport && Manifest.HasContent(Pending.PackageName, Pending.ContentHash, SettingsHash))
+			{
+				// Same files as last time, so the size the index recorded for them still holds;
+				// only an index that lost the entry costs a stat per file
+				const TArray<FString> OutputPaths = Pipeline.GetOutputPaths(Pending.BasePath);
+				Result.OutputBytes = ProjectIndex.GetBytes(Result.AssetPath);
+				if (Result.OutputBytes <= 0)
+				{
+					for (const FString& OutputPath : OutputPaths)
+					{
+						Result.OutputBytes += FMath::Max<int64>(IFileManager::Get().FileSize(*OutputPath), 0);
+					}
+				}
+				ContentUnchangedCount++;
+				ContentUnchangedFileCount += OutputPaths.Num();
+				RecordResult(Pending, true);
+				continue;
+			}
+		}
+
+		if (!bParallel)
+		{
+			const double WriteStartTime = FPlatformTime::Seconds();
+			const bool bWritten = WriteExport(Snapshot, Pending.BasePath, Pending.BundleRecord.Get(), Result.OutputBytes);
+			Result.WriteMs = static_cast<float>((FPlatformTime::Seconds() - WriteStartTime) * 1000.0);
+			RecordResult(Pending, bWritten);
+			continue;
+		}
+
+		// Keep memory bounded: never hold more than MaxInFlight snapshots
+		while (InFlight.Num() >= MaxInFlight)
+		{
+			RetireOldest();
+		}
+
+		// Worker thread: format and write (the snapshot holds no UObject pointers)
+		// Result isn't read again until the future is retired
+		Pending.Result = Async(EAsyncExecution::TaskGraph,
+			[this, &Result, Snapshot = MoveTemp(Snapshot), BasePath = Pending.BasePath, BundleRecord = Pending.BundleRecord]()
+			{
+				const double WriteStartTime = FPlatformTime::Seconds();
+				const bool bWritten = WriteExport(Snapshot, BasePath, BundleRecord.Get(), Result.OutputBytes);
+				Result.WriteMs = static_cast<float>((FPlatformTime::Seconds() - WriteStartTime) * 1000.0);
+				return bWritten;
+			});
+		InFlight.Add(MoveTemp(Pending));
+	}
+
+	while (InFlight.Num() > 0)
+	{
+		RetireOldest();
+	}
+
+	if (Bundle.IsValid())
+	{
+		CopyUnchangedRecords(MAX_int32);
+		Bundle->CopyRemainingPrevious(ProjectPackageNames.GetValue());
+
+		// Nothing reached disk: the old bundle is still in place, so retry these next time
+		if (!Bundle->Close())
+		{
+			for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+			{
+				if (Results[AssetIndex].Status == EBlueprintExportStatus::Exported)
+				{
+					Results[AssetIndex].Status = EBlueprintExportStatus::Failed;
+					FailedPackageNames.Add(Assets[AssetIndex].PackageName);
+					Manifest.Remove(Assets[AssetIndex].PackageName);
+					ProjectIndex.Remove(Results[AssetIndex].AssetPath);
+				}
+			}
+			FailedCount += ExportedCount;
+			ExportedCount = 0;
+		}
+	}
+
+	if (Config.MemoryBudgetMB > 0)
+	{
+		ReleasePackages();
+	}
+	SampleMemory();
+
+	{
+		BLUEPRINT_EXPORT_PHASE_SCOPE(SaveIndexes);
+		Manifest.Save();
+		DependencyIndex.Save();
+		SymbolIndex.Save();
+		ProjectIndex.Save();
+	}
+	RemoveOtherShardLayouts();
+
+	FBlueprintExportProfile::Save(FPaths::Combine(OutputDirectory, ProfileFileName), Results, FPlatformTime::Seconds() - RunStartTime);
+
+	UE_LOG(LogBlueprintExporter, Log, TEXT("Exported %d blueprints to %s (%d unchanged, %d removed, %d failed, peak memory %llu MB)"),
+		ExportedCount, *OutputDirectory, SkippedCount, RemovedCount, FailedCount, PeakUsedPhysical / (1024 * 1024));
+	UE_LOG(LogBlueprintExporter, Log, TEXT("Files: %d written, %d already up to date (%d blueprints not rewritten: content hash unchanged)"),
+		GetWrittenFileCount(), GetUnchangedFileCount(), ContentUnchangedCount);
+	UE_LOG(LogBlueprintExporter, Verbose, TEXT("Prefetch: %d packages ready when needed, %d waited for"),
+		Prefetcher.GetHitCount(), Prefetcher.GetStallCount());
+	FBlueprintExportProfile::LogTotals();
+	return ExportedCount + SkippedCount;
+}
+
+int32 FBlueprintBulkExporter::GetWrittenFileCount() const
+{
+	return Bundle.IsValid() ? Bundle->GetWrittenFileCount() : Pipeline.GetWrittenFileCount();
+}
+
+int32 FBlueprintBulkExporter::GetUnchangedFileCount() const
+{
+	return Bundle.IsValid() ? Bundle->GetUnchangedFileCount() : Pipeline.GetUnchangedFileCount() + ContentUnchangedFileCount;
+}
+
+int32 FBlueprintBulkExporter::GetMaxInFlight() const
+{
+	if (Config.MaxInFlightExports > 0)
+	{
+		return Config.MaxInFlightExports;
+	}
+
+	return FMath::Max(2, FTaskGraphInterface::Get().GetNumWorkerThreads() * 2);
+}
+
+uint64 FBlueprintBulkExporter::SampleMemory()
+{
+	const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	PeakUsedPhysical = FMath::Max(PeakUsedPhysical, UsedPhysical);
+	return UsedPhysical;
+}
+
+void FBlueprintBulkExporter::EnforceMemoryBudget()
+{
+	const uint64 UsedPhysical = SampleMemory();
+	if (Config.MemoryBudgetMB <= 0 || UsedPhysical <= static_cast<uint64>(Config.MemoryBudgetMB) * 1024 * 1024)
+	{
+		return;
+	}
+
+	// Nothing of ours to free: collecting again would only stall every blueprint
+	if (PackagesToRelease.Num() == 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogBlueprintExporter, Verbose, TEXT("Memory budget exceeded (%llu MB used), releasing %d packages"),
+		UsedPhysical / (1024 * 1024), PackagesToRelease.Num());
+
+	ReleasePackages();
+	SampleMemory();
+}
+
+void FBlueprintBulkExporter::ReleasePackages()
+{
+	BLUEPRINT_EXPORT_PHASE_SCOPE(ReleasePackages);
+
+	// Finish outstanding prefetches first; their packages stay loaded for the blueprints that need them
+	FlushAsyncLoading();
+
+	TArray<UPackage*> Packages;
+	for (const FName& PackageName : PackagesToRelease)
+	{
+		if (UPackage* Package = FindObjectFast<UPackage>(nullptr, PackageName))
+		{
+			Packages.Add(Package);
+		}
+	}
+	PackagesToRelease.Reset();
+
+	if (Packages.Num() > 0)
+	{
+		// Unloads the packages and collects garbage
+		FText ErrorMessage;
+		if (!UPackageTools::UnloadPackages(Packages, ErrorMessage))
+		{
+			UE_LOG(LogBlueprintExporter, Warning, TEXT("Failed to unload exported packages: %s"), *ErrorMessage.ToString());
+		}
+	}
+	else
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	GarbageCollectionCount++;
+}
+
+/** The shard count a file of a per-shard family was written for: 1 for the plain name, 0 if it isn't one of the family */
+static int32 GetFileShardCount(const FString& FileName, const FString& BaseName, const FString& Extension)
+{
+	if (FileName.Equals(BaseName + Extension))
+	{
+		return 1;
+	}
+
+	// <BaseName>.shard-i-of-N<Extension>
+	const FString Prefix = BaseName + TEXT(".shard-");
+	if (!FileName.StartsWith(Prefix) || !FileName.EndsWith(Extension))
+	{
+		return 0;
+	}
+
+	FString IndexString;
+	FString CountString;
+	const FString Shard = FileName.Mid(Prefix.Len(), FileName.Len() - Prefix.Len() - Extension.Len());
+	if (!Shard.Split(TEXT("-of-"), &IndexString, &CountString) || !IndexString.IsNumeric() || !CountString.IsNumeric())
+	{
+		return 0;
+	}
+	return FCString::Atoi(*CountString);
+}
+
+void FBlueprintBulkExporter::RemoveOtherShardLayouts() const
+{
+	// Every file kept per shard: base name and extension
+	const FString BundleBaseName = FPaths::GetBaseFilename(FBlueprintBundleWriter::DefaultFileName);
+	const TPair<FString, FString> Families[] = {
+		{ FPaths::GetBaseFilename(FBlueprintExportManifest::FileName), TEXT(".json") },
+		{ BundleBaseName, TEXT(".ndjson") },
+		{ BundleBaseName, TEXT(".index.json") },
+		{ FPaths::GetBaseFilename(FBlueprintDependencyIndex::FileName), TEXT(".json") },
+		{ FBlueprintProjectIndex::BaseFileName, TEXT(".json") },
+		{ FBlueprintProjectIndex::BaseFileName, TEXT(".md") },
+		{ FPaths::GetBaseFilename(FBlueprintSymbolIndex::FileName), TEXT(".bin") },
+		{ FPaths::GetBaseFilename(FBlueprintExportProfile::FileName), TEXT(".json") },
+	};
+
+	IFileManager& FileManager = IFileManager::Get();
+	for (const TPair<FString, FString>& Family : Families)
+	{
+		TArray<FString> FileNames;
+		FileManager.FindFiles(FileNames, *FPaths::Combine(OutputDirectory, Family.Key + TEXT("*") + Family.Value), true, false);
+		for (const FString& FileName : FileNames)
+		{
+			const int32 FileShardCount = GetFileShardCount(FileName, Family.Key, Family.Value);
+			if (FileShardCount > 0 && FileShardCount != ShardCount)
+			{
+				UE_LOG(LogBlueprintExporter, Log, TEXT("Removing %s, written for another shard count"), *FileName);
+				FileManager.Delete(*FPaths::Combine(OutputDirectory, FileName), false, true, true);
+			}
+		}
+	}
+}
+
+void FBlueprintBulkExporter::RetireOldest()
+{
+	// Retire in submission order so results (and the manifest) are deterministic
+	FPendingExport Oldest = MoveTemp(InFlight[0]);
+	InFlight.RemoveAt(0);
+
+	// Let prefetched packages make progress instead of just blocking on the worker
+	while (!Oldest.Result.WaitFor(FTimespan::FromMilliseconds(1)))
+	{
+		FBlueprintPackagePrefetcher::Tick(0.002);
+	}
+
+	RecordResult(Oldest, Oldest.Result.Get());
+}
+
+void FBlueprintBulkExporter::RecordResult(const FPendingExport& Pending, bool bSuccess)
+{
+	FBlueprintExportResult& Result = Results[Pending.ResultIndex];
+
+	// Keep the bundle in asset order
+	if (bSuccess && Bundle.IsValid())
+	{
+		CopyUnchangedRecords(Pending.ResultIndex);
+		bSuccess = Bundle->Append(Result.AssetPath, Pending.PackageName, *Pending.BundleRecord);
+	}
+
+	if (bSuccess && Bundle.IsValid())
+	{
+		// Records aren't files of their own; an empty output list also removes files from earlier non-bundle exports
+		ExportedCount++;
+		Result.Status = EBlueprintExportStatus::Exported;
+		Result.OutputPath = Bundle->GetBundlePath();
+		Manifest.Update(Pending.PackageName, Pending.SourceHash, Pending.ContentHash, SettingsHash, TArray<FString>());
+		ProjectIndex.SetOutput(Result.AssetPath, FString(), Result.OutputBytes);
+	}
+	else if (bSuccess)
+	{
+		ExportedCount++;
+		const TArray<FString> OutputPaths = Pipeline.GetOutputPaths(Pending.BasePath);
+		Result.Status = EBlueprintExportStatus::Exported;
+		Result.OutputPath = OutputPaths.Num() > 0 ? OutputPaths[0] : FString();
+		Manifest.Update(Pending.PackageName, Pending.SourceHash, Pending.ContentHash, SettingsHash, OutputPaths);
+
+		// The index links the Markdown if there is any, the data file otherwise
+		const FString* Document = OutputPaths.FindByPredicate([](const FString& Path) { return Path.EndsWith(TEXT(".md")); });
+		ProjectIndex.SetOutput(Result.AssetPath, Document ? *Document : Result.OutputPath, Result.OutputBytes);
+	}
+	else
+	{
+		Result.Status = EBlueprintExportStatus::Failed;
+		// Drop the entry so the blueprint is retried next time
+		FailedCount++;
+		FailedPackageNames.Add(Pending.PackageName);
+		Manifest.Remove(Pending.PackageName);
+		ProjectIndex.Remove(Result.AssetPath);
+	}
+}
+
+bool FBlueprintBulkExporter::WriteExport(const FBlueprintSnapshot& Snapshot, const FString& BasePath, FBlueprintBundleRecord* BundleRecord, int64& OutBytes) const
+{
+	// Bundle mode: only format; the record is appended on the game thread, in order
+	if (BundleRecord)
+	{
+		BLUEPRINT_EXPORT_PHASE_SCOPE(EncodeBundleRecord);
+		*BundleRecord = FBlueprintBundleWriter::EncodeRecord(Snapshot, JsonOptions, Config.bCompressBundleRecords);
+		OutBytes = BundleRecord->Bytes.Num();
+		FBlueprintExportProfile::AddBytes(EBlueprintExportPhase::EncodeBundleRecord, OutBytes);
+		return true;
+	}
+
+	return Pipeline.WriteSnapshot(Snapshot, BasePath, &OutBytes);
+}
+
+void FBlueprintBulkExporter::CopyUnchangedRecords(int32 ResultIndex)
+{
+	while (UnchangedIndices.IsValidIndex(NextUnchanged) && UnchangedIndices[NextUnchanged] < ResultIndex)
+	{
+		Bundle->CopyPrevious(Results[UnchangedIndices[NextUnchanged]].AssetPath);
+		Results[UnchangedIndices[NextUnchanged]].OutputPath = Bundle->GetBundlePath();
+		NextUnchanged++;
+	}
+}
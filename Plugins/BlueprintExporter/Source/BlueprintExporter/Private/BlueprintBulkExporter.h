@@ -0,0 +1,195 @@
+// BlueprintBulkExporter.h
+// Project-wide export: game-thread capture, worker-thread formatting and writing
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "BlueprintExporter.h"
+#include "BlueprintExportManifest.h"
+#include "BlueprintExportPipeline.h"
+#include "BlueprintBundleWriter.h"
+#include "BlueprintDependencyIndex.h"
+#include "BlueprintExportProfile.h"
+#include "BlueprintProjectIndex.h"
+#include "BlueprintSymbolIndex.h"
+
+/**
+ * Exports a list of blueprint assets through the export pipeline
+ *
+ * UObject access (loading and capturing) always happens on the game thread.
+ * In parallel mode the captured snapshots are formatted and written on task-graph
+ * workers, with at most MaxInFlightExports snapshots alive at once.
+ *
+ * In incremental mode, blueprints whose saved package hash matches the manifest
+ * are skipped without being loaded, and exports of deleted blueprints are removed.
+ * Blueprints that do get captured are neither formatted nor written when their
+ * structural hash (FBlueprintSnapshot::Hash) matches the one recorded with their files,
+ * e.g. after a save that changed nothing exported. Bundle mode always re-encodes them.
+ *
+ * The packages of the next blueprints are loaded asynchronously (within a memory
+ * budget) while the current one is captured, so disk reads overlap with capture
+ * and formatting instead of each load blocking the game thread in turn.
+ *
+ * With a memory budget, packages loaded by the export (never ones the user already
+ * had loaded) are unloaded, with a garbage collection, whenever resident memory
+ * goes over the budget, and once more at the end.
+ *
+ * In bundle mode the workers only format records; they are appended to the bundle on
+ * the game thread in asset order, with unchanged blueprints copied from the previous bundle.
+ *
+ * Every run writes export_profile.json next to the manifest: per-phase time, counts and
+ * bytes, and the slowest assets (see FBlueprintExportProfile).
+ *
+ * An output directory holds one shard layout. Readers merge every shard's indexes, so a run
+ * deletes the manifests, indexes, bundles and profiles written for another shard count.
+ */
+class FBlueprintBulkExporter
+{
+public:
+	FBlueprintBulkExporter(const FString& InOutputDirectory, const FBlueprintExportConfig& InConfig);
+
+	/** All blueprint assets known to the asset registry */
+	static void GatherBlueprintAssets(TArray<FAssetData>& OutAssets);
+
+	/**
+	 * Export the given assets
+	 * @return Number of blueprints whose exports are up to date (written or skipped as unchanged)
+	 */
+	int32 Run(const TArray<FAssetData>& Assets);
+
+	/**
+	 * Packages that still exist in the project, for removing exports of deleted blueprints
+	 * Defaults to the assets passed to Run(); set it when exporting a subset of the project.
+	 */
+	void SetProjectPackageNames(TSet<FName> InPackageNames) { ProjectPackageNames = MoveTemp(InPackageNames); }
+
+	/** Bundle file name in bundle mode (the index is named after it) */
+	void SetBundleFileName(const FString& InFileName) { BundleFileName = InFileName; }
+
+	/** Dependency index file name (sharded exports keep one per shard) */
+	void SetDependencyIndexFileName(const FString& InFileName) { DependencyIndex = FBlueprintDependencyIndex(OutputDirectory, InFileName); }
+
+	/** Base name of index.json and index.md (sharded exports keep a pair per shard) */
+	void SetProjectIndexFileName(const FString& InBaseFileName) { ProjectIndex = FBlueprintProjectIndex(OutputDirectory, InBaseFileName); }
+
+	/** Symbol index file name (sharded exports keep one per shard) */
+	void SetSymbolIndexFileName(const FString& InFileName) { SymbolIndex = FBlueprintSymbolIndex(OutputDirectory, InFileName); }
+
+	/** Timing profile file name (sharded exports keep one per shard); see FBlueprintExportProfile */
+	void SetProfileFileName(const FString& InFileName) { ProfileFileName = InFileName; }
+
+	/**
+	 * Export shard ShardIndex of InShardCount: the manifest, indexes, bundle and profile are
+	 * named <name>.shard-i-of-N.<extension>. A single shard (the default) keeps the plain names.
+	 */
+	void SetShard(int32 ShardIndex, int32 InShardCount);
+
+	/** ".shard-i-of-N", or empty for a single shard */
+	static FString MakeShardSuffix(int32 ShardIndex, int32 ShardCount);
+
+	const FString& GetBundleFileName() const { return BundleFileName; }
+	const FString& GetProfileFileName() const { return ProfileFileName; }
+
+	/** Show the progress dialog (default); background exports turn it off */
+	void SetShowProgress(bool bInShowProgress) { bShowProgress = bInShowProgress; }
+
+	int32 GetExportedCount() const { return ExportedCount; }
+	int32 GetSkippedCount() const { return SkippedCount; }
+	int32 GetFailedCount() const { return FailedCount; }
+	int32 GetRemovedCount() const { return RemovedCount; }
+
+	/** Blueprints loaded and captured, but left unwritten because their content hash matched the manifest */
+	int32 GetContentUnchangedCount() const { return ContentUnchangedCount; }
+	const TArray<FName>& GetFailedPackageNames() const { return FailedPackageNames; }
+
+	/** Output files written (blueprint files, or the bundle and its index) */
+	int32 GetWrittenFileCount() const;
+
+	/** Output files left untouched because the export produced the same content */
+	int32 GetUnchangedFileCount() const;
+
+	/** Status and timing of each asset passed to Run(), in the same order */
+	const TArray<FBlueprintExportResult>& GetResults() const { return Results; }
+
+	/** Highest resident memory seen during the export */
+	uint64 GetPeakUsedPhysical() const { return PeakUsedPhysical; }
+	int32 GetGarbageCollectionCount() const { return GarbageCollectionCount; }
+
+private:
+	struct FPendingExport
+	{
+		FName PackageName;
+		int32 ResultIndex = INDEX_NONE;
+		FString SourceHash;
+		FString ContentHash;
+		FString BasePath;
+		// Bundle mode: filled in by the worker
+		TSharedPtr<FBlueprintBundleRecord> BundleRecord;
+		TFuture<bool> Result;
+	};
+
+	int32 GetMaxInFlight() const;
+
+	/** Wait for the oldest in-flight write and record its result */
+	void RetireOldest();
+
+	void RecordResult(const FPendingExport& Pending, bool bSuccess);
+
+	/** Write the files for a snapshot, or only format its bundle record (any thread); OutBytes receives the output size */
+	bool WriteExport(const FBlueprintSnapshot& Snapshot, const FString& BasePath, FBlueprintBundleRecord* BundleRecord, int64& OutBytes) const;
+
+	/** Copy the previous bundle's records of unchanged assets that come before ResultIndex */
+	void CopyUnchangedRecords(int32 ResultIndex);
+
+	/** Read resident memory and update the peak */
+	uint64 SampleMemory();
+
+	/** Release the export's packages if resident memory is over the budget */
+	void EnforceMemoryBudget();
+
+	/** Unload every package in PackagesToRelease and collect garbage */
+	void ReleasePackages();
+
+	/** Delete the per-shard files of other shard counts, which readers merging every shard would still pick up */
+	void RemoveOtherShardLayouts() const;
+
+	FString OutputDirectory;
+	FBlueprintExportConfig Config;
+	FBlueprintExportPipeline Pipeline;
+	FBlueprintExportManifest Manifest;
+	uint32 SettingsHash = 0;
+	FBlueprintDependencyIndex DependencyIndex;
+	FBlueprintSymbolIndex SymbolIndex;
+	FBlueprintProjectIndex ProjectIndex;
+
+	FString BundleFileName = FBlueprintBundleWriter::DefaultFileName;
+	FString ProfileFileName = FBlueprintExportProfile::FileName;
+	int32 ShardCount = 1;
+	bool bShowProgress = true;
+	TUniquePtr<FBlueprintBundleWriter> Bundle;
+	FBlueprintJsonOptions JsonOptions;
+	// Results indices of unchanged assets, in order, and the next one to copy
+	TArray<int32> UnchangedIndices;
+	int32 NextUnchanged = 0;
+
+	TArray<FPendingExport> InFlight;
+	int32 ExportedCount = 0;
+	int32 SkippedCount = 0;
+	int32 FailedCount = 0;
+	int32 RemovedCount = 0;
+	int32 ContentUnchangedCount = 0;
+	// Output files of the blueprints in ContentUnchangedCount
+	int32 ContentUnchangedFileCount = 0;
+	TArray<FName> FailedPackageNames;
+	// Sized once per run; workers write their own entry's WriteMs
+	TArray<FBlueprintExportResult> Results;
+	TOptional<TSet<FName>> ProjectPackageNames;
+
+	// Loaded before the export started; left alone
+	TSet<FName> UserLoadedPackages;
+	// Loaded by the export and already captured
+	TArray<FName> PackagesToRelease;
+	uint64 PeakUsedPhysical = 0;
+	int32 GarbageCollectionCount = 0;
+};
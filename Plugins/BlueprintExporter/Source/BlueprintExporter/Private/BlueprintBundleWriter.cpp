@@ -0,0 +1,303 @@
+// BlueprintBundleWriter.cpp
+
+#include "BlueprintBundleWriter.h"
+#include "BlueprintExporter.h"
+#include "BlueprintFileWriter.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Base64.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+
+const TCHAR* FBlueprintBundleWriter::DefaultFileName = TEXT("blueprints.ndjson");
+
+static const uint8 NewLine = '\n';
+
+FBlueprintBundleWriter::FBlueprintBundleWriter(const FString& InOutputDirectory, const FString& InBundleFileName)
+	: OutputDirectory(InOutputDirectory)
+	, BundleFileName(InBundleFileName)
+{
+}
+
+FBlueprintBundleWriter::~FBlueprintBundleWriter()
+{
+	// Not closed (e.g. the export was interrupted): drop the partial bundle, keep the old one
+	if (Bundle.IsValid())
+	{
+		Bundle.Reset();
+		IFileManager::Get().Delete(*FBlueprintFileWriter::GetTempPath(GetBundlePath()), false, true, true);
+	}
+}
+
+FString FBlueprintBundleWriter::GetIndexFileName(const FString& BundleFileName)
+{
+	return FPaths::GetBaseFilename(BundleFileName) + TEXT(".index.json");
+}
+
+void FBlueprintBundleWriter::LoadPrevious()
+{
+	PreviousRecords.Reset();
+	PreviousOrder.Reset();
+
+	const FString IndexPath = FPaths::Combine(OutputDirectory, GetIndexFileName(BundleFileName));
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *IndexPath))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	const TArray<TSharedPtr<FJsonValue>>* RecordValues;
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("records"), RecordValues))
+	{
+		UE_LOG(LogBlueprintExporter, Warning, TEXT("Ignoring unreadable bundle index: %s"), *IndexPath);
+		return;
+	}
+
+	// Records are only usable if they came from the same exporter format
+	int32 FormatVersion = 0;
+	if (!Root->TryGetNumberField(TEXT("format_version"), FormatVersion) || FormatVersion != BlueprintExporterFormatVersion)
+	{
+		return;
+	}
+
+	PreviousBundle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*GetBundlePath()));
+	if (!PreviousBundle.IsValid())
+	{
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& RecordValue : *RecordValues)
+	{
+		const TSharedPtr<FJsonObject> RecordObject = RecordValue->AsObject();
+		if (!RecordObject.IsValid())
+		{
+			continue;
+		}
+
+		FIndexEntry Entry;
+		Entry.AssetPath = RecordObject->GetStringField(TEXT("path"));
+		Entry.PackageName = FName(*RecordObject->GetStringField(TEXT("package")));
+		Entry.Offset = static_cast<int64>(RecordObject->GetNumberField(TEXT("offset")));
+		Entry.Length = static_cast<int64>(RecordObject->GetNumberField(TEXT("length")));
+		Entry.bCompressed = RecordObject->GetBoolField(TEXT("compressed"));
+
+		if (Entry.Offset < 0 || Entry.Length < 0 || Entry.Offset + Entry.Length > PreviousBundle->Size())
+		{
+			continue;
+		}
+
+		PreviousOrder.Add(Entry.AssetPath);
+		PreviousRecords.Add(Entry.AssetPath, MoveTemp(Entry));
+	}
+}
+
+bool FBlueprintBundleWriter::Open()
+{
+	Bundle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FBlueprintFileWriter::GetTempPath(GetBundlePath())));
+	if (!Bundle.IsValid())
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to create bundle: %s"), *FBlueprintFileWriter::GetTempPath(GetBundlePath()));
+		return false;
+	}
+
+	BundleSize = 0;
+	Records.Reset();
+	WrittenPaths.Reset();
+	bWriteFailed = false;
+	return true;
+}
+
+FBlueprintBundleRecord FBlueprintBundleWriter::EncodeRecord(const FBlueprintSnapshot& Snapshot, const FBlueprintJsonOptions& Options, bool bCompress)
+{
+	// Condensed JSON has no raw newlines, so it is one line
+	FBlueprintJsonOptions LineOptions = Options;
+	LineOptions.bPrettyPrint = false;
+
+	FString JsonString;
+	UBlueprintExporterLibrary::SnapshotToJsonString(Snapshot, LineOptions, JsonString);
+
+	FBlueprintBundleRecord Record;
+	const FTCHARToUTF8 Utf8(*JsonString, JsonString.Len());
+	const int32 RawLength = Utf8.Length();
+
+	if (bCompress)
+	{
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, RawLength);
+		TArray<uint8> Compressed;
+		Compressed.SetNumUninitialized(CompressedSize);
+
+		// Base64 adds a third, so only keep the compressed form when it is still smaller
+		if (FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Utf8.Get(), RawLength)
+			&& FBase64::GetEncodedDataSize(CompressedSize) < static_cast<uint32>(RawLength))
+		{
+			FString Wrapper;
+			TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Wrapper);
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("path"), Snapshot.Path);
+			Writer->WriteValue(TEXT("compression"), TEXT("zlib"));
+			Writer->WriteValue(TEXT("raw_length"), RawLength);
+			Writer->WriteValue(TEXT("data"), FBase64::Encode(Compressed.GetData(), CompressedSize));
+			Writer->WriteObjectEnd();
+			Writer->Close();
+
+			const FTCHARToUTF8 WrapperUtf8(*Wrapper, Wrapper.Len());
+			Record.Bytes.Append(reinterpret_cast<const uint8*>(WrapperUtf8.Get()), WrapperUtf8.Length());
+			Record.bCompressed = true;
+			return Record;
+		}
+	}
+
+	Record.Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), RawLength);
+	return Record;
+}
+
+bool FBlueprintBundleWriter::Append(const FString& AssetPath, FName PackageName, const FBlueprintBundleRecord& Record)
+{
+	FIndexEntry Entry;
+	Entry.AssetPath = AssetPath;
+	Entry.PackageName = PackageName;
+	Entry.bCompressed = Record.bCompressed;
+	return WriteLine(Record.Bytes.GetData(), Record.Bytes.Num(), MoveTemp(Entry));
+}
+
+bool FBlueprintBundleWriter::CopyPrevious(const FString& AssetPath)
+{
+	const FIndexEntry* Previous = PreviousRecords.Find(AssetPath);
+	if (!Previous || !PreviousBundle.IsValid())
+	{
+		return false;
+	}
+
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(Previous->Length);
+	if (!PreviousBundle->Seek(Previous->Offset) || !PreviousBundle->Read(Bytes.GetData(), Previous->Length))
+	{
+		UE_LOG(LogBlueprintExporter, Warning, TEXT("Failed to read %s from the previous bundle"), *AssetPath);
+		return false;
+	}
+
+	FIndexEntry Entry = *Previous;
+	return WriteLine(Bytes.GetData(), Bytes.Num(), MoveTemp(Entry));
+}
+
+void FBlueprintBundleWriter::CopyRemainingPrevious(const TSet<FName>& ProjectPackageNames)
+{
+	for (const FString& AssetPath : PreviousOrder)
+	{
+		if (!WrittenPaths.Contains(AssetPath) && ProjectPackageNames.Contains(PreviousRecords.FindChecked(AssetPath).PackageName))
+		{
+			CopyPrevious(AssetPath);
+		}
+	}
+}
+
+bool FBlueprintBundleWriter::WriteLine(const uint8* Data, int64 Length, FIndexEntry&& Entry)
+{
+	check(Bundle.IsValid());
+
+	if (WrittenPaths.Contains(Entry.AssetPath))
+	{
+		return true;
+	}
+
+	if (!Bundle->Write(Data, Length) || !Bundle->Write(&NewLine, 1))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to write %s to the bundle"), *Entry.AssetPath);
+		bWriteFailed = true;
+		return false;
+	}
+
+	Entry.Offset = BundleSize;
+	Entry.Length = Length;
+	BundleSize += Length + 1;
+
+	WrittenPaths.Add(Entry.AssetPath);
+	Records.Add(MoveTemp(Entry));
+	return true;
+}
+
+bool FBlueprintBundleWriter::SaveIndex(const FString& IndexPath) const
+{
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("format_version"), BlueprintExporterFormatVersion);
+	Writer->WriteValue(TEXT("bundle"), BundleFileName);
+	Writer->WriteArrayStart(TEXT("records"));
+	for (const FIndexEntry& Entry : Records)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("path"), Entry.AssetPath);
+		Writer->WriteValue(TEXT("package"), Entry.PackageName.ToString());
+		Writer->WriteValue(TEXT("offset"), Entry.Offset);
+		Writer->WriteValue(TEXT("length"), Entry.Length);
+		Writer->WriteValue(TEXT("compressed"), Entry.bCompressed);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	return FFileHelper::SaveStringToFile(JsonString, *IndexPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+bool FBlueprintBundleWriter::Close()
+{
+	if (!Bundle.IsValid())
+	{
+		return false;
+	}
+
+	const bool bFlushed = Bundle->Flush();
+	Bundle.Reset();
+	PreviousBundle.Reset();
+
+	const FString BundlePath = GetBundlePath();
+	const FString IndexPath = FPaths::Combine(OutputDirectory, GetIndexFileName(BundleFileName));
+	const FString BundleTempPath = FBlueprintFileWriter::GetTempPath(BundlePath);
+	const FString IndexTempPath = FBlueprintFileWriter::GetTempPath(IndexPath);
+
+	if (bWriteFailed || !bFlushed || !SaveIndex(IndexTempPath))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to write bundle: %s"), *BundlePath);
+		IFileManager::Get().Delete(*BundleTempPath, false, true, true);
+		IFileManager::Get().Delete(*IndexTempPath, false, true, true);
+		return false;
+	}
+
+	// Each file is replaced by a rename, so readers never see a partially written one
+	auto Replace = [this](const FString& FilePath, const FString& TempPath)
+	{
+		const EBlueprintFileWriteResult Result = FBlueprintFileWriter::ReplaceIfChanged(FilePath, TempPath);
+		if (Result == EBlueprintFileWriteResult::Written)
+		{
+			WrittenFileCount++;
+		}
+		else if (Result == EBlueprintFileWriteResult::Unchanged)
+		{
+			UnchangedFileCount++;
+		}
+		return Result != EBlueprintFileWriteResult::Failed;
+	};
+
+	if (!Replace(BundlePath, BundleTempPath))
+	{
+		IFileManager::Get().Delete(*IndexTempPath, false, true, true);
+		return false;
+	}
+	if (!Replace(IndexPath, IndexTempPath))
+	{
+		return false;
+	}
+
+	UE_LOG(LogBlueprintExporter, Log, TEXT("Wrote %d blueprints to bundle %s (%lld bytes)"), Records.Num(), *BundlePath, BundleSize);
+	return true;
+}
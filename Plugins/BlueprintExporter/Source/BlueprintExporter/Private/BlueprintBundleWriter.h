@@ -0,0 +1,115 @@
+// BlueprintBundleWriter.h
+// Single-file NDJSON export with a sidecar offset index
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintExportTypes.h"
+#include "BlueprintExportPipeline.h"
+#include "Misc/Paths.h"
+
+class IFileHandle;
+
+/**
+ * One encoded bundle line, without its newline
+ */
+struct FBlueprintBundleRecord
+{
+	TArray<uint8> Bytes;
+	bool bCompressed = false;
+};
+
+/**
+ * Writes every exported blueprint as one line of <OutputDirectory>/blueprints.ndjson
+ *
+ * Each line is the blueprint's condensed JSON. With compression enabled, records
+ * that shrink are instead written as
+ *   {"path":...,"compression":"zlib","raw_length":N,"data":"<base64 zlib stream>"}
+ * so the bundle stays valid NDJSON either way.
+ *
+ * The sidecar blueprints.index.json maps each asset path to the byte offset and length
+ * of its line (newline excluded) and whether it is compressed, so readers can
+ * memory-map the bundle and decode one blueprint without touching the rest.
+ *
+ * The new bundle is written to a temporary file and renamed over the old one on
+ * Close(), so readers never see a partial bundle; if it comes out identical the old
+ * files are kept untouched. Records of unchanged blueprints are copied from the
+ * previous bundle instead of being exported again.
+ */
+class FBlueprintBundleWriter
+{
+public:
+	static const TCHAR* DefaultFileName;
+
+	FBlueprintBundleWriter(const FString& InOutputDirectory, const FString& InBundleFileName = DefaultFileName);
+	~FBlueprintBundleWriter();
+
+	/** <Name>.index.json for <Name>.ndjson */
+	static FString GetIndexFileName(const FString& BundleFileName);
+
+	FString GetBundlePath() const { return FPaths::Combine(OutputDirectory, BundleFileName); }
+
+	/** Read the previous bundle's index; a missing or unreadable index means nothing can be copied */
+	void LoadPrevious();
+
+	/** True if the previous bundle has a record that can be copied for this asset */
+	bool HasPreviousRecord(const FString& AssetPath) const { return PreviousRecords.Contains(AssetPath); }
+
+	/** Start writing the new bundle */
+	bool Open();
+
+	/** Format one blueprint as a bundle line (any thread) */
+	static FBlueprintBundleRecord EncodeRecord(const FBlueprintSnapshot& Snapshot, const FBlueprintJsonOptions& Options, bool bCompress);
+
+	/** Append a freshly exported blueprint */
+	bool Append(const FString& AssetPath, FName PackageName, const FBlueprintBundleRecord& Record);
+
+	/** Append the previous bundle's record for an unchanged blueprint */
+	bool CopyPrevious(const FString& AssetPath);
+
+	/**
+	 * Carry over previous records of blueprints that weren't part of this export but are still
+	 * in the project (exports of a subset keep the rest of the bundle)
+	 */
+	void CopyRemainingPrevious(const TSet<FName>& ProjectPackageNames);
+
+	/** Finish the bundle, write the index and replace the previous files */
+	bool Close();
+
+	int32 GetRecordCount() const { return Records.Num(); }
+
+	/** Bundle and index files replaced by Close() */
+	int32 GetWrittenFileCount() const { return WrittenFileCount; }
+
+	/** Bundle and index files Close() left untouched because their content was the same */
+	int32 GetUnchangedFileCount() const { return UnchangedFileCount; }
+
+private:
+	struct FIndexEntry
+	{
+		FString AssetPath;
+		FName PackageName;
+		int64 Offset = 0;
+		int64 Length = 0;
+		bool bCompressed = false;
+	};
+
+	bool WriteLine(const uint8* Data, int64 Length, FIndexEntry&& Entry);
+	bool SaveIndex(const FString& IndexPath) const;
+
+	FString OutputDirectory;
+	FString BundleFileName;
+
+	TMap<FString, FIndexEntry> PreviousRecords;
+	TArray<FString> PreviousOrder;
+	TUniquePtr<IFileHandle> PreviousBundle;
+
+	TUniquePtr<IFileHandle> Bundle;
+	int64 BundleSize = 0;
+	TArray<FIndexEntry> Records;
+	TSet<FString> WrittenPaths;
+	bool bWriteFailed = false;
+
+	int32 WrittenFileCount = 0;
+	int32 UnchangedFileCount = 0;
+};
@@ -0,0 +1,222 @@
+// BlueprintDependencyIndex.cpp
+
+#include "BlueprintDependencyIndex.h"
+#include "BlueprintExporter.h"
+#include "BlueprintGraphAdapter.h"
+#include "BlueprintFileWriter.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+const TCHAR* FBlueprintDependencyIndex::FileName = TEXT("dependency_graph.json");
+
+// ============================================================================
+// Index
+// ============================================================================
+
+FBlueprintDependencyIndex::FBlueprintDependencyIndex(const FString& InOutputDirectory, const FString& InFileName)
+	: OutputDirectory(InOutputDirectory)
+	, IndexFileName(InFileName)
+{
+}
+
+void FBlueprintDependencyIndex::Load()
+{
+	Blueprints.Reset();
+	Graph.Reset();
+
+	const FString IndexPath = FPaths::Combine(OutputDirectory, IndexFileName);
+	if (FPaths::FileExists(IndexPath))
+	{
+		LoadFile(IndexPath);
+	}
+}
+
+bool FBlueprintDependencyIndex::LoadFile(const FString& FilePath)
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	const TArray<TSharedPtr<FJsonValue>>* NodeValues;
+	const TArray<TSharedPtr<FJsonValue>>* BlueprintValues;
+	const TArray<TSharedPtr<FJsonValue>>* ForwardValues;
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid()
+		|| !Root->TryGetArrayField(TEXT("nodes"), NodeValues)
+		|| !Root->TryGetArrayField(TEXT("blueprints"), BlueprintValues)
+		|| !Root->TryGetArrayField(TEXT("forward"), ForwardValues)
+		|| ForwardValues->Num() != NodeValues->Num())
+	{
+		UE_LOG(LogBlueprintExporter, Warning, TEXT("Ignoring unreadable dependency index: %s"), *FilePath);
+		return false;
+	}
+
+	TArray<FString> Nodes;
+	Nodes.Reserve(NodeValues->Num());
+	for (const TSharedPtr<FJsonValue>& NodeValue : *NodeValues)
+	{
+		Nodes.Add(NodeValue->AsString());
+	}
+
+	for (const TSharedPtr<FJsonValue>& BlueprintValue : *BlueprintValues)
+	{
+		const TSharedPtr<FJsonObject> BlueprintObject = BlueprintValue->AsObject();
+		int32 Node = INDEX_NONE;
+		if (!BlueprintObject.IsValid() || !BlueprintObject->TryGetNumberField(TEXT("node"), Node) || !Nodes.IsValidIndex(Node))
+		{
+			continue;
+		}
+
+		FEntry Entry;
+		Entry.PackageName = FName(*BlueprintObject->GetStringField(TEXT("package")));
+		Entry.ClassPath = BlueprintObject->GetStringField(TEXT("class"));
+		for (const TSharedPtr<FJsonValue>& Dependency : (*ForwardValues)[Node]->AsArray())
+		{
+			const int32 DependencyNode = static_cast<int32>(Dependency->AsNumber());
+			if (Nodes.IsValidIndex(DependencyNode))
+			{
+				Entry.Dependencies.Add(Nodes[DependencyNode]);
+			}
+		}
+
+		Blueprints.Add(Nodes[Node], MoveTemp(Entry));
+	}
+
+	Graph.Reset();
+	return true;
+}
+
+bool FBlueprintDependencyIndex::Save() const
+{
+	const BlueprintGraph::FDependencyGraph& SavedGraph = GetGraph();
+
+	auto WriteAdjacency = [](TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>& Writer, const TCHAR* Name, const std::vector<std::vector<int32_t>>& Edges)
+	{
+		Writer.WriteArrayStart(Name);
+		for (const std::vector<int32_t>& NodeEdges : Edges)
+		{
+			Writer.WriteArrayStart();
+			for (const int32 Node : NodeEdges)
+			{
+				Writer.WriteValue(Node);
+			}
+			Writer.WriteArrayEnd();
+		}
+		Writer.WriteArrayEnd();
+	};
+
+	// Condensed: the adjacency lists would take a line per edge otherwise
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("format_version"), BlueprintExporterFormatVersion);
+
+	TArray<FString> NodePaths;
+	NodePaths.Reserve(static_cast<int32>(SavedGraph.Nodes.size()));
+	Writer->WriteArrayStart(TEXT("nodes"));
+	for (const std::string& Node : SavedGraph.Nodes)
+	{
+		Writer->WriteValue(NodePaths.Add_GetRef(FBlueprintGraphAdapter::FromUtf8(Node)));
+	}
+	Writer->WriteArrayEnd();
+
+	// In node order, which is asset path order
+	Writer->WriteArrayStart(TEXT("blueprints"));
+	for (int32 Node = 0; Node < NodePaths.Num(); ++Node)
+	{
+		if (const FEntry* Entry = Blueprints.Find(NodePaths[Node]))
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("node"), Node);
+			Writer->WriteValue(TEXT("package"), Entry->PackageName.ToString());
+			Writer->WriteValue(TEXT("class"), Entry->ClassPath);
+			Writer->WriteObjectEnd();
+		}
+	}
+	Writer->WriteArrayEnd();
+
+	WriteAdjacency(*Writer, TEXT("forward"), SavedGraph.Forward);
+	WriteAdjacency(*Writer, TEXT("reverse"), SavedGraph.Reverse);
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	const FString IndexPath = FPaths::Combine(OutputDirectory, IndexFileName);
+	if (FBlueprintFileWriter::WriteIfChanged(IndexPath, JsonString) == EBlueprintFileWriteResult::Failed)
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to save dependency index: %s"), *IndexPath);
+		return false;
+	}
+
+	return true;
+}
+
+void FBlueprintDependencyIndex::Update(const FBlueprintSnapshot& Snapshot)
+{
+	FEntry Entry;
+	Entry.PackageName = FName(*Snapshot.PackageName);
+	if (!Snapshot.GeneratedClass.IsEmpty())
+	{
+		Entry.ClassPath = Snapshot.PackageName + TEXT(".") + Snapshot.GeneratedClass;
+	}
+	Entry.Dependencies = Snapshot.Dependencies;
+
+	Blueprints.Add(Snapshot.Path, MoveTemp(Entry));
+	Graph.Reset();
+}
+
+void FBlueprintDependencyIndex::RemoveStale(const TSet<FName>& LivePackageNames)
+{
+	const int32 NumBefore = Blueprints.Num();
+	for (auto It = Blueprints.CreateIterator(); It; ++It)
+	{
+		if (!LivePackageNames.Contains(It.Value().PackageName))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (Blueprints.Num() != NumBefore)
+	{
+		Graph.Reset();
+	}
+}
+
+const BlueprintGraph::FDependencyGraph& FBlueprintDependencyIndex::GetGraph() const
+{
+	if (!Graph.IsSet())
+	{
+		std::vector<BlueprintGraph::FDependencyEntry> Entries;
+		Entries.reserve(Blueprints.Num());
+		for (const TPair<FString, FEntry>& Pair : Blueprints)
+		{
+			BlueprintGraph::FDependencyEntry& Entry = Entries.emplace_back();
+			Entry.Path = FBlueprintGraphAdapter::ToUtf8(Pair.Key);
+			Entry.ClassPath = FBlueprintGraphAdapter::ToUtf8(Pair.Value.ClassPath);
+			Entry.Dependencies.reserve(Pair.Value.Dependencies.Num());
+			for (const FString& Dependency : Pair.Value.Dependencies)
+			{
+				Entry.Dependencies.push_back(FBlueprintGraphAdapter::ToUtf8(Dependency));
+			}
+		}
+		Graph.Emplace(BlueprintGraph::FDependencyGraph::Build(Entries));
+	}
+	return Graph.GetValue();
+}
+
+TArray<FString> FBlueprintDependencyIndex::Walk(const FString& Path, bool bReverse, bool bTransitive) const
+{
+	TArray<FString> Result;
+	for (const std::string& Node : GetGraph().Walk(FBlueprintGraphAdapter::ToUtf8(Path), bReverse, bTransitive))
+	{
+		Result.Add(FBlueprintGraphAdapter::FromUtf8(Node));
+	}
+	return Result;
+}
@@ -0,0 +1,68 @@
+// BlueprintDependencyIndex.h
+// Project-wide dependency graph with forward and reverse adjacency
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintExportTypes.h"
+#include "GraphCore/BlueprintGraphDependencies.h"
+
+/**
+ * Dependency index stored as <OutputDirectory>/dependency_graph.json
+ *
+ * Holds the forward dependencies of every exported blueprint (the "dependencies" of
+ * its JSON file). The saved file also carries the reverse adjacency, so "who depends
+ * on this" takes a graph walk instead of parsing every export. Exports update it
+ * incrementally: entries of unchanged blueprints are kept from the last save, those of
+ * re-exported blueprints replaced and those of deleted blueprints dropped.
+ *
+ * Game thread only, except for const queries on an index whose graph GetGraph has
+ * already built, which never change it.
+ */
+class FBlueprintDependencyIndex
+{
+public:
+	static const TCHAR* FileName;
+
+	explicit FBlueprintDependencyIndex(const FString& InOutputDirectory, const FString& InFileName = FileName);
+
+	/** Load this index's file; a missing or unreadable file simply means an empty index */
+	void Load();
+
+	/** Merge the blueprints of another index file (e.g. another shard's) into this one */
+	bool LoadFile(const FString& FilePath);
+
+	bool Save() const;
+
+	/** Record (or replace) a blueprint's dependencies */
+	void Update(const FBlueprintSnapshot& Snapshot);
+
+	/** True if the index has the blueprint */
+	bool Contains(const FString& AssetPath) const { return Blueprints.Contains(AssetPath); }
+
+	/** Drop blueprints that are no longer in the project */
+	void RemoveStale(const TSet<FName>& LivePackageNames);
+
+	/** The graph for queries (see BlueprintGraph::FDependencyGraph), rebuilt after updates */
+	const BlueprintGraph::FDependencyGraph& GetGraph() const;
+
+	/** Paths reachable from Path, sorted (see BlueprintGraph::FDependencyGraph::Walk) */
+	TArray<FString> Walk(const FString& Path, bool bReverse, bool bTransitive) const;
+
+private:
+	struct FEntry
+	{
+		FName PackageName;
+		// Path of the generated class, e.g. /Game/BP_Player.BP_Player_C
+		FString ClassPath;
+		TArray<FString> Dependencies;
+	};
+
+	FString OutputDirectory;
+	FString IndexFileName;
+
+	// Asset path -> entry
+	TMap<FString, FEntry> Blueprints;
+
+	mutable TOptional<BlueprintGraph::FDependencyGraph> Graph;
+};
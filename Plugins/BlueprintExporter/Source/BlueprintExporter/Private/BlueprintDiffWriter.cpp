@@ -0,0 +1,434 @@
+// BlueprintDiffWriter.cpp
+
+#include "BlueprintDiffWriter.h"
+#include "BlueprintSnapshotHash.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+using FDiffJsonWriter = TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>;
+
+/** Totals over every blueprint of a diff */
+struct FDiffTotals
+{
+	int32 Changed = 0;
+	int32 Added = 0;
+	int32 Removed = 0;
+	int32 NodesAdded = 0;
+	int32 NodesRemoved = 0;
+	int32 NodesChanged = 0;
+
+	explicit FDiffTotals(const FBlueprintExportDiff& Diff)
+	{
+		for (const FBlueprintDiff& Blueprint : Diff.Blueprints)
+		{
+			int32& Count = Blueprint.Change == EBlueprintDiffChange::Added ? Added : Blueprint.Change == EBlueprintDiffChange::Removed ? Removed : Changed;
+			++Count;
+
+			for (const FBlueprintGraphDiff& Graph : Blueprint.Graphs)
+			{
+				for (const FBlueprintNodeDiff& Node : Graph.Nodes)
+				{
+					int32& NodeCount = Node.Change == EBlueprintDiffChange::Added ? NodesAdded : Node.Change == EBlueprintDiffChange::Removed ? NodesRemoved : NodesChanged;
+					++NodeCount;
+				}
+			}
+		}
+	}
+};
+
+// ============================================================================
+// JSON
+// ============================================================================
+
+static void WriteFields(FDiffJsonWriter& Writer, const TArray<FBlueprintFieldChange>& Fields)
+{
+	if (Fields.Num() == 0)
+	{
+		return;
+	}
+
+	Writer.WriteArrayStart(TEXT("fields"));
+	for (const FBlueprintFieldChange& Field : Fields)
+	{
+		Writer.WriteObjectStart();
+		Writer.WriteValue(TEXT("field"), Field.Field);
+		Writer.WriteValue(TEXT("old"), Field.OldValue);
+		Writer.WriteValue(TEXT("new"), Field.NewValue);
+		Writer.WriteObjectEnd();
+	}
+	Writer.WriteArrayEnd();
+}
+
+static void WriteLinks(FDiffJsonWriter& Writer, const TCHAR* Identifier, const TArray<FBlueprintConnectionSnapshot>& Links)
+{
+	if (Links.Num() == 0)
+	{
+		return;
+	}
+
+	Writer.WriteArrayStart(Identifier);
+	for (const FBlueprintConnectionSnapshot& Link : Links)
+	{
+		Writer.WriteObjectStart();
+		Writer.WriteValue(TEXT("node"), Link.Node);
+		Writer.WriteValue(TEXT("pin"), Link.Pin);
+		Writer.WriteObjectEnd();
+	}
+	Writer.WriteArrayEnd();
+}
+
+static void WriteMembers(FDiffJsonWriter& Writer, const TCHAR* Identifier, const TArray<FBlueprintMemberDiff>& Members)
+{
+	if (Members.Num() == 0)
+	{
+		return;
+	}
+
+	Writer.WriteArrayStart(Identifier);
+	for (const FBlueprintMemberDiff& Member : Members)
+	{
+		Writer.WriteObjectStart();
+		Writer.WriteValue(TEXT("name"), Member.Name);
+		Writer.WriteValue(TEXT("change"), FBlueprintSnapshotDiff::GetChangeName(Member.Change));
+		WriteFields(Writer, Member.Fields);
+		Writer.WriteObjectEnd();
+	}
+	Writer.WriteArrayEnd();
+}
+
+static void WriteNode(FDiffJsonWriter& Writer, const FBlueprintNodeDiff& Node)
+{
+	Writer.WriteObjectStart();
+	Writer.WriteValue(TEXT("change"), FBlueprintSnapshotDiff::GetChangeName(Node.Change));
+	Writer.WriteValue(TEXT("id"), Node.Id);
+	Writer.WriteValue(TEXT("type"), Node.Type);
+	Writer.WriteValue(TEXT("title"), Node.Title);
+	WriteFields(Writer, Node.Fields);
+
+	if (Node.Pins.Num() > 0)
+	{
+		Writer.WriteArrayStart(TEXT("pins"));
+		for (const FBlueprintPinDiff& Pin : Node.Pins)
+		{
+			Writer.WriteObjectStart();
+			Writer.WriteValue(TEXT("name"), Pin.Name);
+			Writer.WriteValue(TEXT("direction"), Pin.bIsInput ? TEXT("input") : TEXT("output"));
+			Writer.WriteValue(TEXT("change"), FBlueprintSnapshotDiff::GetChangeName(Pin.Change));
+			WriteFields(Writer, Pin.Fields);
+			WriteLinks(Writer, TEXT("links_added"), Pin.LinksAdded);
+			WriteLinks(Writer, TEXT("links_removed"), Pin.LinksRemoved);
+			Writer.WriteObjectEnd();
+		}
+		Writer.WriteArrayEnd();
+	}
+
+	Writer.WriteObjectEnd();
+}
+
+static void WriteBlueprint(FDiffJsonWriter& Writer, const FBlueprintDiff& Blueprint)
+{
+	Writer.WriteObjectStart();
+	Writer.WriteValue(TEXT("name"), Blueprint.Name);
+	Writer.WriteValue(TEXT("path"), Blueprint.Path);
+	Writer.WriteValue(TEXT("change"), FBlueprintSnapshotDiff::GetChangeName(Blueprint.Change));
+	if (Blueprint.OldHash != 0)
+	{
+		Writer.WriteValue(TEXT("old_hash"), FBlueprintSnapshotHash::ToString(Blueprint.OldHash));
+	}
+	if (Blueprint.NewHash != 0)
+	{
+		Writer.WriteValue(TEXT("new_hash"), FBlueprintSnapshotHash::ToString(Blueprint.NewHash));
+	}
+	WriteFields(Writer, Blueprint.Fields);
+	WriteMembers(Writer, TEXT("variables"), Blueprint.Variables);
+	WriteMembers(Writer, TEXT("functions"), Blueprint.Functions);
+	WriteMembers(Writer, TEXT("components"), Blueprint.Components);
+
+	if (Blueprint.Graphs.Num() > 0)
+	{
+		Writer.WriteArrayStart(TEXT("graphs"));
+		for (const FBlueprintGraphDiff& Graph : Blueprint.Graphs)
+		{
+			Writer.WriteObjectStart();
+			Writer.WriteValue(TEXT("name"), Graph.Name);
+			Writer.WriteValue(TEXT("change"), FBlueprintSnapshotDiff::GetChangeName(Graph.Change));
+			Writer.WriteValue(TEXT("nodes"), Graph.NodeCount);
+			if (Graph.Change == EBlueprintDiffChange::Changed)
+			{
+				Writer.WriteValue(TEXT("unchanged_nodes"), Graph.UnchangedNodeCount);
+				Writer.WriteArrayStart(TEXT("node_changes"));
+				for (const FBlueprintNodeDiff& Node : Graph.Nodes)
+				{
+					WriteNode(Writer, Node);
+				}
+				Writer.WriteArrayEnd();
+			}
+			Writer.WriteObjectEnd();
+		}
+		Writer.WriteArrayEnd();
+	}
+
+	Writer.WriteObjectEnd();
+}
+
+FString FBlueprintDiffWriter::ToJson(const FBlueprintExportDiff& Diff)
+{
+	const FDiffTotals Totals(Diff);
+
+	FString JsonString;
+	TSharedRef<FDiffJsonWriter> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("format_version"), BlueprintExporterFormatVersion);
+	Writer->WriteValue(TEXT("old"), Diff.OldSource);
+	Writer->WriteValue(TEXT("new"), Diff.NewSource);
+
+	Writer->WriteObjectStart(TEXT("summary"));
+	Writer->WriteValue(TEXT("changed"), Totals.Changed);
+	Writer->WriteValue(TEXT("added"), Totals.Added);
+	Writer->WriteValue(TEXT("removed"), Totals.Removed);
+	Writer->WriteValue(TEXT("unchanged"), Diff.UnchangedCount);
+	Writer->WriteValue(TEXT("skipped"), Diff.Skipped.Num());
+	Writer->WriteValue(TEXT("nodes_added"), Totals.NodesAdded);
+	Writer->WriteValue(TEXT("nodes_removed"), Totals.NodesRemoved);
+	Writer->WriteValue(TEXT("nodes_changed"), Totals.NodesChanged);
+	Writer->WriteObjectEnd();
+
+	Writer->WriteArrayStart(TEXT("blueprints"));
+	for (const FBlueprintDiff& Blueprint : Diff.Blueprints)
+	{
+		WriteBlueprint(*Writer, Blueprint);
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteArrayStart(TEXT("skipped"));
+	for (const FString& Path : Diff.Skipped)
+	{
+		Writer->WriteValue(Path);
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+	return JsonString;
+}
+
+// ============================================================================
+// Markdown
+// ============================================================================
+
+/** A value as inline code on one line; "(none)" if empty */
+static void AppendCode(FString& Out, const FString& Value)
+{
+	if (Value.IsEmpty())
+	{
+		Out += TEXT("(none)");
+		return;
+	}
+
+	FString Line = Value.Replace(TEXT("\r\n"), TEXT(" ")).Replace(TEXT("\n"), TEXT(" "));
+	const bool bHasBacktick = Line.Contains(TEXT("`"));
+	Out += bHasBacktick ? TEXT("`` ") : TEXT("`");
+	Out += Line;
+	Out += bHasBacktick ? TEXT(" ``") : TEXT("`");
+}
+
+/** "field `old` → `new`, ..."; for something added, only the values that were set: "field `new`, ..." */
+static void AppendFields(FString& Out, const TArray<FBlueprintFieldChange>& Fields, bool bAdded)
+{
+	bool bFirst = true;
+	for (const FBlueprintFieldChange& Field : Fields)
+	{
+		Out += bFirst ? TEXT("") : TEXT(", ");
+		bFirst = false;
+		Out += Field.Field;
+		Out += TEXT(" ");
+		if (!bAdded)
+		{
+			AppendCode(Out, Field.OldValue);
+			Out += TEXT(" → ");
+		}
+		AppendCode(Out, Field.NewValue);
+	}
+}
+
+static void AppendLinks(FString& Out, const TCHAR* Label, const TArray<FBlueprintConnectionSnapshot>& Links)
+{
+	Out += Label;
+	for (int32 Index = 0; Index < Links.Num(); ++Index)
+	{
+		Out += Index > 0 ? TEXT(", ") : TEXT(" ");
+		AppendCode(Out, Links[Index].Node + TEXT(".") + Links[Index].Pin);
+	}
+}
+
+static void AppendPin(FString& Out, const FBlueprintPinDiff& Pin)
+{
+	Out += TEXT("  - ");
+	if (Pin.Change == EBlueprintDiffChange::Added)
+	{
+		Out += TEXT("Added pin ");
+	}
+	else if (Pin.Change == EBlueprintDiffChange::Removed)
+	{
+		Out += TEXT("Removed pin ");
+	}
+	AppendCode(Out, Pin.Name);
+	Out += Pin.bIsInput ? TEXT(" (input)") : TEXT(" (output)");
+
+	const TCHAR* Separator = TEXT(": ");
+	if (Pin.Fields.Num() > 0)
+	{
+		Out += Separator;
+		AppendFields(Out, Pin.Fields, Pin.Change == EBlueprintDiffChange::Added);
+		Separator = TEXT("; ");
+	}
+	if (Pin.LinksAdded.Num() > 0)
+	{
+		Out += Separator;
+		AppendLinks(Out, TEXT("linked to"), Pin.LinksAdded);
+		Separator = TEXT("; ");
+	}
+	if (Pin.LinksRemoved.Num() > 0)
+	{
+		Out += Separator;
+		AppendLinks(Out, TEXT("unlinked from"), Pin.LinksRemoved);
+	}
+	Out += TEXT("\n");
+}
+
+static void AppendNode(FString& Out, const FBlueprintNodeDiff& Node)
+{
+	Out += Node.Change == EBlueprintDiffChange::Added ? TEXT("- Added **") : Node.Change == EBlueprintDiffChange::Removed ? TEXT("- Removed **") : TEXT("- Changed **");
+	Out += Node.Title.Replace(TEXT("\r\n"), TEXT(" ")).Replace(TEXT("\n"), TEXT(" "));
+	Out += TEXT("** ");
+	AppendCode(Out, Node.Id);
+	Out += TEXT(" (");
+	Out += Node.Type;
+	Out += TEXT(")\n");
+
+	if (Node.Fields.Num() > 0)
+	{
+		Out += TEXT("  - ");
+		AppendFields(Out, Node.Fields, false);
+		Out += TEXT("\n");
+	}
+	for (const FBlueprintPinDiff& Pin : Node.Pins)
+	{
+		AppendPin(Out, Pin);
+	}
+}
+
+static void AppendMembers(FString& Out, const TCHAR* Heading, const TArray<FBlueprintMemberDiff>& Members)
+{
+	if (Members.Num() == 0)
+	{
+		return;
+	}
+
+	Out += TEXT("### ");
+	Out += Heading;
+	Out += TEXT("\n\n");
+	for (const FBlueprintMemberDiff& Member : Members)
+	{
+		Out += Member.Change == EBlueprintDiffChange::Added ? TEXT("- Added **") : Member.Change == EBlueprintDiffChange::Removed ? TEXT("- Removed **") : TEXT("- Changed **");
+		Out += Member.Name;
+		Out += TEXT("**");
+		if (Member.Fields.Num() > 0)
+		{
+			Out += TEXT(": ");
+			AppendFields(Out, Member.Fields, Member.Change == EBlueprintDiffChange::Added);
+		}
+		Out += TEXT("\n");
+	}
+	Out += TEXT("\n");
+}
+
+static void AppendBlueprint(FString& Out, const FBlueprintDiff& Blueprint)
+{
+	Out += TEXT("## ");
+	Out += Blueprint.Name;
+	if (Blueprint.Change != EBlueprintDiffChange::Changed)
+	{
+		Out += TEXT(" (");
+		Out += FBlueprintSnapshotDiff::GetChangeName(Blueprint.Change);
+		Out += TEXT(")");
+	}
+	Out += TEXT("\n\n`");
+	Out += Blueprint.Path;
+	Out += TEXT("`\n\n");
+
+	if (Blueprint.Fields.Num() > 0)
+	{
+		Out += TEXT("- ");
+		AppendFields(Out, Blueprint.Fields, false);
+		Out += TEXT("\n\n");
+	}
+
+	AppendMembers(Out, TEXT("Variables"), Blueprint.Variables);
+	AppendMembers(Out, TEXT("Functions"), Blueprint.Functions);
+	AppendMembers(Out, TEXT("Components"), Blueprint.Components);
+
+	for (const FBlueprintGraphDiff& Graph : Blueprint.Graphs)
+	{
+		Out += TEXT("### ");
+		Out += Graph.Name;
+		if (Graph.Change != EBlueprintDiffChange::Changed)
+		{
+			Out += FString::Printf(TEXT(" (%s, %d nodes)\n\n"), FBlueprintSnapshotDiff::GetChangeName(Graph.Change), Graph.NodeCount);
+			continue;
+		}
+
+		int32 Counts[3] = { 0, 0, 0 };
+		for (const FBlueprintNodeDiff& Node : Graph.Nodes)
+		{
+			++Counts[static_cast<int32>(Node.Change)];
+		}
+		Out += FString::Printf(TEXT("\n\n%d added, %d removed, %d changed, %d unchanged nodes\n\n"),
+			Counts[static_cast<int32>(EBlueprintDiffChange::Added)], Counts[static_cast<int32>(EBlueprintDiffChange::Removed)],
+			Counts[static_cast<int32>(EBlueprintDiffChange::Changed)], Graph.UnchangedNodeCount);
+
+		for (const FBlueprintNodeDiff& Node : Graph.Nodes)
+		{
+			AppendNode(Out, Node);
+		}
+		Out += TEXT("\n");
+	}
+}
+
+FString FBlueprintDiffWriter::ToMarkdown(const FBlueprintExportDiff& Diff)
+{
+	const FDiffTotals Totals(Diff);
+
+	FString Out;
+	Out += TEXT("# Blueprint Diff\n\n**Old:** `");
+	Out += Diff.OldSource;
+	Out += TEXT("`\n**New:** `");
+	Out += Diff.NewSource;
+	Out += TEXT("`\n\n");
+	Out += FString::Printf(TEXT("**Blueprints:** %d changed, %d added, %d removed, %d unchanged\n"),
+		Totals.Changed, Totals.Added, Totals.Removed, Diff.UnchangedCount);
+	Out += FString::Printf(TEXT("**Nodes:** %d added, %d removed, %d changed\n\n"), Totals.NodesAdded, Totals.NodesRemoved, Totals.NodesChanged);
+
+	if (Diff.Blueprints.Num() == 0 && Diff.Skipped.Num() == 0)
+	{
+		Out += TEXT("No changes.\n");
+		return Out;
+	}
+
+	for (const FBlueprintDiff& Blueprint : Diff.Blueprints)
+	{
+		AppendBlueprint(Out, Blueprint);
+	}
+
+	if (Diff.Skipped.Num() > 0)
+	{
+		Out += TEXT("## Not Compared\n\nChanged, but without a JSON export to compare:\n\n");
+		for (const FString& Path : Diff.Skipped)
+		{
+			Out += TEXT("- `");
+			Out += Path;
+			Out += TEXT("`\n");
+		}
+	}
+	return Out;
+}
@@ -0,0 +1,22 @@
+// BlueprintDiffWriter.h
+// The semantic diff as JSON for tools and as Markdown for code review
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintSnapshotDiff.h"
+
+/**
+ * Formats a diff of blueprint exports
+ *
+ * Both formats hold the same: totals, then per changed blueprint its class changes, variables,
+ * functions and components, and per graph the nodes added, removed and changed, down to
+ * their pins' values and links. See JSON-SCHEMA.md for the JSON.
+ */
+class FBlueprintDiffWriter
+{
+public:
+	static FString ToJson(const FBlueprintExportDiff& Diff);
+
+	static FString ToMarkdown(const FBlueprintExportDiff& Diff);
+};
@@ -0,0 +1,267 @@
+// BlueprintExportManifest.cpp
+
+#include "BlueprintExportManifest.h"
+#include "BlueprintExporter.h"
+#include "BlueprintFileWriter.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+
+const TCHAR* FBlueprintExportManifest::FileName = TEXT("export_manifest.json");
+
+FBlueprintExportManifest::FBlueprintExportManifest(const FString& InOutputDirectory, const FString& InFileName)
+	: OutputDirectory(InOutputDirectory)
+	, ManifestFileName(InFileName)
+{
+}
+
+void FBlueprintExportManifest::Load()
+{
+	Entries.Reset();
+
+	FString ManifestPath = FPaths::Combine(OutputDirectory, ManifestFileName);
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *ManifestPath))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		UE_LOG(LogBlueprintExporter, Warning, TEXT("Ignoring unreadable export manifest: %s"), *ManifestPath);
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>* AssetsObject;
+	if (!Root->TryGetObjectField(TEXT("assets"), AssetsObject))
+	{
+		return;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*AssetsObject)->Values)
+	{
+		const TSharedPtr<FJsonObject> EntryObject = Pair.Value->AsObject();
+		if (!EntryObject.IsValid())
+		{
+			continue;
+		}
+
+		FBlueprintManifestEntry Entry;
+		Entry.SourceHash = EntryObject->GetStringField(TEXT("source_hash"));
+		EntryObject->TryGetStringField(TEXT("content_hash"), Entry.ContentHash);
+		Entry.FormatVersion = static_cast<int32>(EntryObject->GetNumberField(TEXT("format_version")));
+		Entry.SettingsHash = static_cast<uint32>(EntryObject->GetNumberField(TEXT("settings_hash")));
+		EntryObject->TryGetStringArrayField(TEXT("outputs"), Entry.Outputs);
+
+		Entries.Add(FName(*Pair.Key), MoveTemp(Entry));
+	}
+}
+
+bool FBlueprintExportManifest::Save() const
+{
+	// Sort by package name so the manifest itself is deterministic
+	TArray<FName> PackageNames;
+	Entries.GetKeys(PackageNames);
+	PackageNames.Sort(FNameLexicalLess());
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("format_version"), BlueprintExporterFormatVersion);
+	Writer->WriteObjectStart(TEXT("assets"));
+	for (const FName& PackageName : PackageNames)
+	{
+		const FBlueprintManifestEntry& Entry = Entries.FindChecked(PackageName);
+		Writer->WriteObjectStart(PackageName.ToString());
+		Writer->WriteValue(TEXT("source_hash"), Entry.SourceHash);
+		if (!Entry.ContentHash.IsEmpty())
+		{
+			Writer->WriteValue(TEXT("content_hash"), Entry.ContentHash);
+		}
+		Writer->WriteValue(TEXT("format_version"), Entry.FormatVersion);
+		Writer->WriteValue(TEXT("settings_hash"), static_cast<int64>(Entry.SettingsHash));
+		Writer->WriteArrayStart(TEXT("outputs"));
+		for (const FString& Output : Entry.Outputs)
+		{
+			Writer->WriteValue(Output);
+		}
+		Writer->WriteArrayEnd();
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	FString ManifestPath = FPaths::Combine(OutputDirectory, ManifestFileName);
+	// Renamed into place, so an interrupted save never leaves a truncated manifest
+	if (FBlueprintFileWriter::WriteIfChanged(ManifestPath, JsonString) == EBlueprintFileWriteResult::Failed)
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to save export manifest: %s"), *ManifestPath);
+		return false;
+	}
+
+	return true;
+}
+
+bool FBlueprintExportManifest::IsUpToDate(FName PackageName, const FString& SourceHash, uint32 SettingsHash) const
+{
+	const FBlueprintManifestEntry* Entry = Entries.Find(PackageName);
+	if (!Entry || SourceHash.IsEmpty())
+	{
+		return false;
+	}
+
+	if (Entry->SourceHash != SourceHash)
+	{
+		return false;
+	}
+
+	// Unsaved edits aren't reflected in the package hash
+	if (UPackage* Package = FindPackage(nullptr, *PackageName.ToString()))
+	{
+		if (Package->IsDirty())
+		{
+			return false;
+		}
+	}
+
+	return HasOutputs(*Entry, SettingsHash);
+}
+
+bool FBlueprintExportManifest::HasContent(FName PackageName, const FString& ContentHash, uint32 SettingsHash) const
+{
+	const FBlueprintManifestEntry* Entry = Entries.Find(PackageName);
+	return Entry && !ContentHash.IsEmpty() && Entry->ContentHash == ContentHash && HasOutputs(*Entry, SettingsHash);
+}
+
+bool FBlueprintExportManifest::HasOutputs(const FBlueprintManifestEntry& Entry, uint32 SettingsHash) const
+{
+	if (Entry.FormatVersion != BlueprintExporterFormatVersion || Entry.SettingsHash != SettingsHash)
+	{
+		return false;
+	}
+
+	// Someone may have deleted files from the output directory
+	for (const FString& Output : Entry.Outputs)
+	{
+		if (!FPaths::FileExists(FPaths::Combine(OutputDirectory, Output)))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FBlueprintExportManifest::Update(FName PackageName, const FString& SourceHash, const FString& ContentHash, uint32 SettingsHash, const TArray<FString>& AbsoluteOutputs)
+{
+	const FString OutputRoot = FPaths::Combine(OutputDirectory, TEXT(""));
+
+	FBlueprintManifestEntry NewEntry;
+	NewEntry.SourceHash = SourceHash;
+	NewEntry.ContentHash = ContentHash;
+	NewEntry.FormatVersion = BlueprintExporterFormatVersion;
+	NewEntry.SettingsHash = SettingsHash;
+	for (FString Output : AbsoluteOutputs)
+	{
+		FPaths::MakePathRelativeTo(Output, *OutputRoot);
+		NewEntry.Outputs.Add(MoveTemp(Output));
+	}
+
+	// e.g. Markdown was switched off: remove the .md left over from the last export
+	if (const FBlueprintManifestEntry* OldEntry = Entries.Find(PackageName))
+	{
+		for (const FString& OldOutput : OldEntry->Outputs)
+		{
+			if (!NewEntry.Outputs.Contains(OldOutput))
+			{
+				DeleteOutput(OldOutput);
+			}
+		}
+	}
+
+	Entries.Add(PackageName, MoveTemp(NewEntry));
+}
+
+void FBlueprintExportManifest::Remove(FName PackageName)
+{
+	Entries.Remove(PackageName);
+}
+
+int32 FBlueprintExportManifest::RemoveStale(const TSet<FName>& LivePackageNames)
+{
+	int32 RemovedCount = 0;
+
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (LivePackageNames.Contains(It.Key()))
+		{
+			continue;
+		}
+
+		for (const FString& Output : It.Value().Outputs)
+		{
+			DeleteOutput(Output);
+		}
+
+		UE_LOG(LogBlueprintExporter, Log, TEXT("Removed exports of deleted blueprint: %s"), *It.Key().ToString());
+		It.RemoveCurrent();
+		RemovedCount++;
+	}
+
+	return RemovedCount;
+}
+
+void FBlueprintExportManifest::DeleteOutput(const FString& RelativePath) const
+{
+	const FString FullPath = FPaths::Combine(OutputDirectory, RelativePath);
+	if (FPaths::FileExists(FullPath) && !IFileManager::Get().Delete(*FullPath))
+	{
+		UE_LOG(LogBlueprintExporter, Warning, TEXT("Failed to delete stale export: %s"), *FullPath);
+	}
+}
+
+FString FBlueprintExportManifest::ComputeSourceHash(const FAssetData& AssetData)
+{
+	// Preferred: the hash the editor recorded when the package was saved
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(AssetData.PackageName);
+	if (PackageData.IsSet() && !PackageData->GetPackageSavedHash().IsZero())
+	{
+		return LexToString(PackageData->GetPackageSavedHash());
+	}
+
+	// Fallback: timestamp and size of the .uasset on disk
+	FString Filename;
+	if (FPackageName::TryConvertLongPackageNameToFilename(AssetData.PackageName.ToString(), Filename, FPackageName::GetAssetPackageExtension()))
+	{
+		const FFileStatData Stat = IFileManager::Get().GetStatData(*Filename);
+		if (Stat.bIsValid)
+		{
+			return FString::Printf(TEXT("ts:%lld:%lld"), Stat.ModificationTime.GetTicks(), Stat.FileSize);
+		}
+	}
+
+	// Unknown: always export
+	return FString();
+}
+
+uint32 FBlueprintExportManifest::ComputeSettingsHash(const FBlueprintExportConfig& Config)
+{
+	uint32 Hash = GetTypeHash(Config.bPrettyPrintJson);
+	Hash = HashCombine(Hash, GetTypeHash(Config.bGenerateMarkdown));
+	Hash = HashCombine(Hash, GetTypeHash(Config.bFunctionGraphsById));
+	Hash = HashCombine(Hash, GetTypeHash(Config.bCompactSchema));
+	Hash = HashCombine(Hash, GetTypeHash(Config.bBundleExport));
+	Hash = HashCombine(Hash, GetTypeHash(Config.bCompressBundleRecords));
+	Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Config.Format)));
+	return Hash;
+}
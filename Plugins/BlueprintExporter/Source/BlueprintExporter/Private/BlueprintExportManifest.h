@@ -0,0 +1,84 @@
+// BlueprintExportManifest.h
+// Persistent record of what was exported, used to skip unchanged blueprints
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+struct FBlueprintExportConfig;
+
+/**
+ * What the manifest knows about one exported blueprint
+ */
+struct FBlueprintManifestEntry
+{
+	// Package saved hash from the asset registry, or file timestamp and size as a fallback
+	FString SourceHash;
+	// Structural hash of what was exported (FBlueprintSnapshot::Hash), empty if unknown
+	FString ContentHash;
+	int32 FormatVersion = 0;
+	uint32 SettingsHash = 0;
+
+	// Files written for this blueprint, relative to the output directory
+	TArray<FString> Outputs;
+};
+
+/**
+ * Manifest stored as <OutputDirectory>/export_manifest.json
+ * (sharded exports keep one manifest per shard next to it)
+ */
+class FBlueprintExportManifest
+{
+public:
+	static const TCHAR* FileName;
+
+	explicit FBlueprintExportManifest(const FString& InOutputDirectory, const FString& InFileName = FileName);
+
+	/** Load the manifest; a missing or unreadable file simply means a full export */
+	void Load();
+	bool Save() const;
+
+	/**
+	 * True if the blueprint can be skipped without loading it
+	 * (same source hash, format version and settings, and every output still on disk)
+	 */
+	bool IsUpToDate(FName PackageName, const FString& SourceHash, uint32 SettingsHash) const;
+
+	/**
+	 * True if a captured blueprint would export to the files already on disk, e.g. after a
+	 * save without changes (same content hash, format version and settings, every output still there)
+	 */
+	bool HasContent(FName PackageName, const FString& ContentHash, uint32 SettingsHash) const;
+
+	/**
+	 * Record a successful export; output files from the previous export that were
+	 * not written this time are deleted
+	 */
+	void Update(FName PackageName, const FString& SourceHash, const FString& ContentHash, uint32 SettingsHash, const TArray<FString>& AbsoluteOutputs);
+
+	/** Forget a blueprint (e.g. its export failed), keeping its files */
+	void Remove(FName PackageName);
+
+	/**
+	 * Delete the outputs of every blueprint that is no longer in the project
+	 * @return Number of blueprints removed
+	 */
+	int32 RemoveStale(const TSet<FName>& LivePackageNames);
+
+	/** Hash identifying the saved state of an asset, without loading it */
+	static FString ComputeSourceHash(const FAssetData& AssetData);
+
+	/** Hash of every setting that changes the exported files */
+	static uint32 ComputeSettingsHash(const FBlueprintExportConfig& Config);
+
+private:
+	/** Same format version and settings, and every output still on disk */
+	bool HasOutputs(const FBlueprintManifestEntry& Entry, uint32 SettingsHash) const;
+
+	void DeleteOutput(const FString& RelativePath) const;
+
+	FString OutputDirectory;
+	FString ManifestFileName;
+	TMap<FName, FBlueprintManifestEntry> Entries;
+};
@@ -0,0 +1,276 @@
+// BlueprintExportPipeline.cpp
+
+#include "BlueprintExportPipeline.h"
+#include "BlueprintExporter.h"
+#include "BlueprintExportProfile.h"
+#include "BlueprintJsonWriter.h"
+#include "BlueprintMsgPackWriter.h"
+#include "BlueprintFileWriter.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+
+// ============================================================================
+// Sinks
+// ============================================================================
+
+bool IBlueprintExportSink::SaveOutput(const FString& FilePath, TArrayView<const uint8> Bytes, int64* OutBytes) const
+{
+	if (OutBytes)
+	{
+		*OutBytes = Bytes.Num();
+	}
+	return CountWrite(FBlueprintFileWriter::WriteIfChanged(FilePath, Bytes));
+}
+
+bool IBlueprintExportSink::SaveOutput(const FString& FilePath, FStringView Text, int64* OutBytes) const
+{
+	return CountWrite(FBlueprintFileWriter::WriteIfChanged(FilePath, Text, OutBytes));
+}
+
+bool IBlueprintExportSink::CountWrite(EBlueprintFileWriteResult Result) const
+{
+	switch (Result)
+	{
+	case EBlueprintFileWriteResult::Written:
+		WrittenFileCount.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	case EBlueprintFileWriteResult::Unchanged:
+		UnchangedFileCount.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool FBlueprintJsonSink::Write(const FBlueprintSnapshot& Snapshot, const FString& BasePath, int64& OutBytes)
+{
+	return WriteFile(Snapshot, GetOutputPath(BasePath), &OutBytes);
+}
+
+bool FBlueprintJsonSink::WriteFile(const FBlueprintSnapshot& Snapshot, const FString& FilePath, int64* OutBytes) const
+{
+	FString JsonString;
+	if (!UBlueprintExporterLibrary::SnapshotToJsonString(Snapshot, Options, JsonString))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to serialize JSON for: %s"), *Snapshot.Name);
+		return false;
+	}
+
+	if (SaveOutput(FilePath, JsonString, OutBytes))
+	{
+		UE_LOG(LogBlueprintExporter, Log, TEXT("Exported blueprint to: %s"), *FilePath);
+		return true;
+	}
+
+	UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to save file: %s"), *FilePath);
+	return false;
+}
+
+bool FBlueprintMsgPackSink::Write(const FBlueprintSnapshot& Snapshot, const FString& BasePath, int64& OutBytes)
+{
+	return WriteFile(Snapshot, GetOutputPath(BasePath), &OutBytes);
+}
+
+bool FBlueprintMsgPackSink::WriteFile(const FBlueprintSnapshot& Snapshot, const FString& FilePath, int64* OutBytes) const
+{
+	TArray<uint8> Bytes;
+	if (!SnapshotToBytes(Snapshot, Options, Bytes))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to serialize MessagePack for: %s"), *Snapshot.Name);
+		return false;
+	}
+
+	if (SaveOutput(FilePath, Bytes, OutBytes))
+	{
+		UE_LOG(LogBlueprintExporter, Log, TEXT("Exported blueprint to: %s"), *FilePath);
+		return true;
+	}
+
+	UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to save file: %s"), *FilePath);
+	return false;
+}
+
+bool FBlueprintMsgPackSink::SnapshotToBytes(const FBlueprintSnapshot& Snapshot, const FBlueprintJsonOptions& Options, TArray<uint8>& OutBytes)
+{
+	BLUEPRINT_EXPORT_PHASE_SCOPE(FormatMessagePack);
+
+	FBlueprintMsgPackWriter Writer(OutBytes);
+	TBlueprintSchemaWriter<FBlueprintMsgPackWriter>::WriteBlueprint(Writer, Snapshot, Options);
+	const bool bClosed = Writer.Close();
+	FBlueprintExportProfile::AddBytes(EBlueprintExportPhase::FormatMessagePack, OutBytes.Num());
+	return bClosed;
+}
+
+bool FBlueprintMarkdownSink::Write(const FBlueprintSnapshot& Snapshot, const FString& BasePath, int64& OutBytes)
+{
+	return WriteFile(Snapshot, GetOutputPath(BasePath), &OutBytes);
+}
+
+bool FBlueprintMarkdownSink::WriteFile(const FBlueprintSnapshot& Snapshot, const FString& FilePath, int64* OutBytes) const
+{
+	FString MarkdownContent = UBlueprintExporterLibrary::GenerateMarkdown(Snapshot);
+
+	if (SaveOutput(FilePath, MarkdownContent, OutBytes))
+	{
+		UE_LOG(LogBlueprintExporter, Log, TEXT("Exported markdown to: %s"), *FilePath);
+		return true;
+	}
+
+	UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to save markdown file: %s"), *FilePath);
+	return false;
+}
+
+// ============================================================================
+// Pipeline
+// ============================================================================
+
+FBlueprintExportPipeline FBlueprintExportPipeline::CreateDefault(bool bPrettyPrint, bool bGenerateMarkdown)
+{
+	FBlueprintExportPipeline Pipeline;
+	Pipeline.AddSink(MakeShared<FBlueprintJsonSink>(bPrettyPrint));
+
+	// Markdown failures are logged but don't fail the export
+	if (bGenerateMarkdown)
+	{
+		Pipeline.AddSink(MakeShared<FBlueprintMarkdownSink>(), false);
+	}
+
+	return Pipeline;
+}
+
+FBlueprintExportPipeline FBlueprintExportPipeline::CreateDefault(const FBlueprintExportConfig& Config)
+{
+	const FBlueprintJsonOptions JsonOptions = MakeJsonOptions(Config);
+
+	FBlueprintExportPipeline Pipeline;
+	if (Config.Format == EBlueprintExportFormat::MessagePack)
+	{
+		Pipeline.AddSink(MakeShared<FBlueprintMsgPackSink>(JsonOptions));
+	}
+	else
+	{
+		Pipeline.AddSink(MakeShared<FBlueprintJsonSink>(JsonOptions));
+	}
+
+	if (Config.bGenerateMarkdown)
+	{
+		Pipeline.AddSink(MakeShared<FBlueprintMarkdownSink>(), false);
+	}
+
+	return Pipeline;
+}
+
+FBlueprintJsonOptions FBlueprintExportPipeline::MakeJsonOptions(const FBlueprintExportConfig& Config)
+{
+	FBlueprintJsonOptions JsonOptions;
+	JsonOptions.bPrettyPrint = Config.bPrettyPrintJson;
+	JsonOptions.bFunctionGraphsById = Config.bFunctionGraphsById;
+	JsonOptions.bCompactSchema = Config.bCompactSchema;
+	return JsonOptions;
+}
+
+void FBlueprintExportPipeline::AddSink(const TSharedRef<IBlueprintExportSink>& Sink, bool bRequired)
+{
+	Sinks.Add({ Sink, bRequired });
+}
+
+bool FBlueprintExportPipeline::ExportBlueprint(UBlueprint* Blueprint, const FString& BasePath) const
+{
+	FBlueprintSnapshot Snapshot;
+	if (!UBlueprintExporterLibrary::CaptureBlueprint(Blueprint, Snapshot))
+	{
+		return false;
+	}
+
+	return WriteSnapshot(Snapshot, BasePath);
+}
+
+bool FBlueprintExportPipeline::WriteSnapshot(const FBlueprintSnapshot& Snapshot, const FString& BasePath, int64* OutBytes) const
+{
+	if (OutBytes)
+	{
+		*OutBytes = 0;
+	}
+
+	// Ensure the directory exists (once per blueprint, shared by all sinks)
+	FString Directory = FPaths::GetPath(BasePath);
+	if (!Directory.IsEmpty())
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		if (!PlatformFile.DirectoryExists(*Directory) && !PlatformFile.CreateDirectoryTree(*Directory))
+		{
+			UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to create directory: %s"), *Directory);
+			return false;
+		}
+	}
+
+	for (const FSinkEntry& Entry : Sinks)
+	{
+		int64 SinkBytes = 0;
+		if (Entry.Sink->Write(Snapshot, BasePath, SinkBytes))
+		{
+			if (OutBytes)
+			{
+				*OutBytes += SinkBytes;
+			}
+			continue;
+		}
+
+		if (Entry.bRequired)
+		{
+			return false;
+		}
+
+		UE_LOG(LogBlueprintExporter, Warning, TEXT("Failed to export %s for: %s"), Entry.Sink->GetFormatName(), *Snapshot.Name);
+	}
+
+	return true;
+}
+
+TArray<FString> FBlueprintExportPipeline::GetOutputPaths(const FString& BasePath) const
+{
+	TArray<FString> OutputPaths;
+	for (const FSinkEntry& Entry : Sinks)
+	{
+		OutputPaths.Add(Entry.Sink->GetOutputPath(BasePath));
+	}
+	return OutputPaths;
+}
+
+int32 FBlueprintExportPipeline::GetWrittenFileCount() const
+{
+	int32 Count = 0;
+	for (const FSinkEntry& Entry : Sinks)
+	{
+		Count += Entry.Sink->GetWrittenFileCount();
+	}
+	return Count;
+}
+
+int32 FBlueprintExportPipeline::GetUnchangedFileCount() const
+{
+	int32 Count = 0;
+	for (const FSinkEntry& Entry : Sinks)
+	{
+		Count += Entry.Sink->GetUnchangedFileCount();
+	}
+	return Count;
+}
+
+FString FBlueprintExportPipeline::MakeOutputBasePath(const FString& OutputDirectory, const FString& PackageName, const FString& AssetName)
+{
+	FString RelativePath = PackageName;
+
+	// Remove /Game/ prefix
+	RelativePath.RemoveFromStart(TEXT("/Game/"));
+
+	// Keep subdirectories, if any
+	FString Directory;
+	FString TargetDirectory = OutputDirectory;
+	if (RelativePath.Split(TEXT("/"), &Directory, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromEnd))
+	{
+		TargetDirectory = FPaths::Combine(OutputDirectory, Directory);
+	}
+
+	return FPaths::Combine(TargetDirectory, AssetName);
+}
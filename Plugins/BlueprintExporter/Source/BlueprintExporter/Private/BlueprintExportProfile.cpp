@@ -0,0 +1,169 @@
+// BlueprintExportProfile.cpp
+
+#include "BlueprintExportProfile.h"
+#include "BlueprintExporter.h"
+#include "BlueprintFileWriter.h"
+#include "Serialization/JsonWriter.h"
+
+#include <atomic>
+
+const TCHAR* FBlueprintExportProfile::FileName = TEXT("export_profile.json");
+
+DEFINE_STAT(STAT_BlueprintExporter_Load);
+DEFINE_STAT(STAT_BlueprintExporter_Capture);
+DEFINE_STAT(STAT_BlueprintExporter_ReadGraph);
+DEFINE_STAT(STAT_BlueprintExporter_CaptureGraph);
+DEFINE_STAT(STAT_BlueprintExporter_Knots);
+DEFINE_STAT(STAT_BlueprintExporter_Order);
+DEFINE_STAT(STAT_BlueprintExporter_Hash);
+DEFINE_STAT(STAT_BlueprintExporter_UpdateIndexes);
+DEFINE_STAT(STAT_BlueprintExporter_FormatJson);
+DEFINE_STAT(STAT_BlueprintExporter_FormatMessagePack);
+DEFINE_STAT(STAT_BlueprintExporter_FormatMarkdown);
+DEFINE_STAT(STAT_BlueprintExporter_EncodeBundleRecord);
+DEFINE_STAT(STAT_BlueprintExporter_WriteFile);
+DEFINE_STAT(STAT_BlueprintExporter_SaveIndexes);
+DEFINE_STAT(STAT_BlueprintExporter_ReleasePackages);
+
+static constexpr int32 PhaseCount = static_cast<int32>(EBlueprintExportPhase::Count);
+
+struct FPhaseTotals
+{
+	std::atomic<uint64> Cycles{ 0 };
+	std::atomic<int64> Count{ 0 };
+	std::atomic<int64> Bytes{ 0 };
+};
+
+static FPhaseTotals GPhaseTotals[PhaseCount];
+
+void FBlueprintExportProfile::Reset()
+{
+	for (FPhaseTotals& Totals : GPhaseTotals)
+	{
+		Totals.Cycles.store(0, std::memory_order_relaxed);
+		Totals.Count.store(0, std::memory_order_relaxed);
+		Totals.Bytes.store(0, std::memory_order_relaxed);
+	}
+}
+
+void FBlueprintExportProfile::AddTime(EBlueprintExportPhase Phase, uint64 Cycles)
+{
+	FPhaseTotals& Totals = GPhaseTotals[static_cast<int32>(Phase)];
+	Totals.Cycles.fetch_add(Cycles, std::memory_order_relaxed);
+	Totals.Count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FBlueprintExportProfile::AddBytes(EBlueprintExportPhase Phase, int64 Bytes)
+{
+	GPhaseTotals[static_cast<int32>(Phase)].Bytes.fetch_add(Bytes, std::memory_order_relaxed);
+}
+
+const TCHAR* FBlueprintExportProfile::GetPhaseName(EBlueprintExportPhase Phase)
+{
+	static const TCHAR* const Names[PhaseCount] =
+	{
+		TEXT("load"),
+		TEXT("capture"),
+		TEXT("read_graph"),
+		TEXT("node_title"),
+		TEXT("capture_graph"),
+		TEXT("knots"),
+		TEXT("order"),
+		TEXT("hash"),
+		TEXT("update_indexes"),
+		TEXT("format_json"),
+		TEXT("format_messagepack"),
+		TEXT("format_markdown"),
+		TEXT("encode_bundle_record"),
+		TEXT("write_file"),
+		TEXT("save_indexes"),
+		TEXT("release_packages"),
+	};
+	return Names[static_cast<int32>(Phase)];
+}
+
+void FBlueprintExportProfile::LogTotals()
+{
+	for (int32 Phase = 0; Phase < PhaseCount; ++Phase)
+	{
+		const FPhaseTotals& Totals = GPhaseTotals[Phase];
+		const int64 Count = Totals.Count.load(std::memory_order_relaxed);
+		if (Count > 0)
+		{
+			UE_LOG(LogBlueprintExporter, Log, TEXT("Phase %-20s %9.3f s %8lld calls %12lld bytes"), GetPhaseName(static_cast<EBlueprintExportPhase>(Phase)),
+				FPlatformTime::ToSeconds64(Totals.Cycles.load(std::memory_order_relaxed)), Count, Totals.Bytes.load(std::memory_order_relaxed));
+		}
+	}
+}
+
+bool FBlueprintExportProfile::Save(const FString& FilePath, const TArray<FBlueprintExportResult>& Results, double DurationSeconds)
+{
+	// Unchanged assets were never loaded, so only exported and failed ones can be slow
+	auto TotalMs = [](const FBlueprintExportResult& Result)
+	{
+		return Result.LoadMs + Result.CaptureMs + Result.WriteMs;
+	};
+
+	TArray<const FBlueprintExportResult*> Slowest;
+	for (const FBlueprintExportResult& Result : Results)
+	{
+		if (Result.Status != EBlueprintExportStatus::Unchanged)
+		{
+			Slowest.Add(&Result);
+		}
+	}
+	Slowest.Sort([&TotalMs](const FBlueprintExportResult& A, const FBlueprintExportResult& B)
+	{
+		return TotalMs(A) > TotalMs(B);
+	});
+	Slowest.SetNum(FMath::Min(Slowest.Num(), MaxSlowestAssets));
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("format_version"), BlueprintExporterFormatVersion);
+	Writer->WriteValue(TEXT("duration_seconds"), DurationSeconds);
+
+	Writer->WriteArrayStart(TEXT("phases"));
+	for (int32 Phase = 0; Phase < PhaseCount; ++Phase)
+	{
+		const FPhaseTotals& Totals = GPhaseTotals[Phase];
+		const double Seconds = FPlatformTime::ToSeconds64(Totals.Cycles.load(std::memory_order_relaxed));
+		const int64 Count = Totals.Count.load(std::memory_order_relaxed);
+
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("name"), GetPhaseName(static_cast<EBlueprintExportPhase>(Phase)));
+		Writer->WriteValue(TEXT("seconds"), Seconds);
+		Writer->WriteValue(TEXT("count"), Count);
+		Writer->WriteValue(TEXT("average_ms"), Count > 0 ? Seconds * 1000.0 / Count : 0.0);
+		Writer->WriteValue(TEXT("bytes"), Totals.Bytes.load(std::memory_order_relaxed));
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteArrayStart(TEXT("slowest_assets"));
+	for (const FBlueprintExportResult* Result : Slowest)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("path"), Result->AssetPath);
+		Writer->WriteValue(TEXT("status"), Result->Status == EBlueprintExportStatus::Exported ? TEXT("exported") : TEXT("failed"));
+		Writer->WriteValue(TEXT("total_ms"), TotalMs(*Result));
+		Writer->WriteValue(TEXT("load_ms"), Result->LoadMs);
+		Writer->WriteValue(TEXT("capture_ms"), Result->CaptureMs);
+		Writer->WriteValue(TEXT("write_ms"), Result->WriteMs);
+		Writer->WriteValue(TEXT("nodes"), Result->NodeCount);
+		Writer->WriteValue(TEXT("bytes"), Result->OutputBytes);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	if (FBlueprintFileWriter::WriteIfChanged(FilePath, JsonString) == EBlueprintFileWriteResult::Failed)
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to save export profile: %s"), *FilePath);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,133 @@
+// BlueprintExportProfile.h
+// Per-phase export timing: Unreal Insights scopes, cycle stats and export_profile.json
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+
+struct FBlueprintExportResult;
+
+/** Export phases; a nested phase is also counted in the phase around it */
+enum class EBlueprintExportPhase : uint8
+{
+	// Waiting for the package (prefetch) and GetAsset()
+	Load,
+	// CaptureBlueprint, everything below included
+	Capture,
+	// Reading a UEdGraph into the graph model (FBlueprintGraphAdapter::FillGraph)
+	ReadGraph,
+	// GetNodeTitle, within ReadGraph; summed per graph (one call each), profile totals only,
+	// without an Insights event or cycle stat
+	NodeTitle,
+	// Graph model to snapshot (CaptureGraph), knots, ordering and graph hashes included
+	CaptureGraph,
+	Knots,
+	Order,
+	// Structural hashes of the nodes, graphs and blueprint
+	Hash,
+	// Dependency, symbol and project index updates
+	UpdateIndexes,
+	FormatJson,
+	FormatMessagePack,
+	FormatMarkdown,
+	// Bundle record (its JSON included)
+	EncodeBundleRecord,
+	// Comparing with the existing file and writing it if changed
+	WriteFile,
+	// Manifest and index saves at the end
+	SaveIndexes,
+	// Unloading exported packages and collecting garbage
+	ReleasePackages,
+
+	Count
+};
+
+DECLARE_STATS_GROUP(TEXT("BlueprintExporter"), STATGROUP_BlueprintExporter, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Load"), STAT_BlueprintExporter_Load, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Capture"), STAT_BlueprintExporter_Capture, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Read Graph"), STAT_BlueprintExporter_ReadGraph, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Capture Graph"), STAT_BlueprintExporter_CaptureGraph, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Knots"), STAT_BlueprintExporter_Knots, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Order"), STAT_BlueprintExporter_Order, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hash"), STAT_BlueprintExporter_Hash, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Indexes"), STAT_BlueprintExporter_UpdateIndexes, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Format JSON"), STAT_BlueprintExporter_FormatJson, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Format MessagePack"), STAT_BlueprintExporter_FormatMessagePack, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Format Markdown"), STAT_BlueprintExporter_FormatMarkdown, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Encode Bundle Record"), STAT_BlueprintExporter_EncodeBundleRecord, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Write File"), STAT_BlueprintExporter_WriteFile, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Save Indexes"), STAT_BlueprintExporter_SaveIndexes, STATGROUP_BlueprintExporter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Release Packages"), STAT_BlueprintExporter_ReleasePackages, STATGROUP_BlueprintExporter, );
+
+/**
+ * Time, call count and output bytes of each export phase, summed process-wide
+ *
+ * Phases record from any thread (workers format and write in parallel mode), so the
+ * totals are CPU time, not wall time, and can add up to more than the export took.
+ * The bulk exporter resets them when it starts and saves them to export_profile.json,
+ * with its slowest assets, when it finishes. Exports outside a bulk export (the auto
+ * export, Python calls) are counted too and show up in the next bulk export's profile
+ * only if they run while it does.
+ */
+class FBlueprintExportProfile
+{
+public:
+	static const TCHAR* FileName;
+
+	/** Assets listed in the profile, slowest first */
+	static constexpr int32 MaxSlowestAssets = 25;
+
+	static void Reset();
+
+	static void AddTime(EBlueprintExportPhase Phase, uint64 Cycles);
+
+	/** Output of a phase: bytes for files, records and MessagePack, characters for JSON and Markdown */
+	static void AddBytes(EBlueprintExportPhase Phase, int64 Bytes);
+
+	/** Name in export_profile.json, e.g. "format_json" */
+	static const TCHAR* GetPhaseName(EBlueprintExportPhase Phase);
+
+	/** Log each phase that ran, with its total time, count and bytes */
+	static void LogTotals();
+
+	/**
+	 * Write the profile: per-phase totals and the slowest of the given assets
+	 * @param DurationSeconds - Wall time of the export, for comparison with the phase totals
+	 */
+	static bool Save(const FString& FilePath, const TArray<FBlueprintExportResult>& Results, double DurationSeconds);
+};
+
+/** Adds the time until it goes out of scope to a phase; see BLUEPRINT_EXPORT_PHASE_SCOPE */
+class FBlueprintExportPhaseScope
+{
+public:
+	explicit FBlueprintExportPhaseScope(EBlueprintExportPhase InPhase)
+		: Phase(InPhase)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FBlueprintExportPhaseScope()
+	{
+		FBlueprintExportProfile::AddTime(Phase, FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	UE_NONCOPYABLE(FBlueprintExportPhaseScope);
+
+private:
+	EBlueprintExportPhase Phase;
+	uint64 StartCycles;
+};
+
+/**
+ * Times the rest of the enclosing scope as an export phase: an Unreal Insights event
+ * (BlueprintExporter_<Phase>), a cycle stat ("stat BlueprintExporter") and the profile totals
+ */
+#define BLUEPRINT_EXPORT_PHASE_SCOPE(Phase) \
+	TRACE_CPUPROFILER_EVENT_SCOPE(BlueprintExporter_##Phase); \
+	SCOPE_CYCLE_COUNTER(STAT_BlueprintExporter_##Phase); \
+	const FBlueprintExportPhaseScope BlueprintExportPhaseScope_##Phase(EBlueprintExportPhase::Phase)
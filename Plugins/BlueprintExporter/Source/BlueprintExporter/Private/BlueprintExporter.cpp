@@ -1,20 +1,29 @@
 // BlueprintExporter.cpp
 
 #include "BlueprintExporter.h"
+#include "BlueprintExportPipeline.h"
+#include "BlueprintBulkExporter.h"
+#include "BlueprintDependencyIndex.h"
+#include "BlueprintDiffWriter.h"
+#include "BlueprintExportProfile.h"
+#include "BlueprintGraphAdapter.h"
+#include "BlueprintJsonWriter.h"
+#include "BlueprintMarkdownWriter.h"
+#include "BlueprintPinTypeNames.h"
+#include "BlueprintSnapshotDiff.h"
+#include "BlueprintSnapshotHash.h"
+#include "BlueprintSnapshotReader.h"
+#include "GraphCore/BlueprintGraphFormat.h"
+#include "GraphCore/BlueprintGraphKnots.h"
+#include "GraphCore/BlueprintGraphOrdering.h"
 #include "Modules/ModuleManager.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "K2Node.h"
-#include "K2Node_Event.h"
 #include "K2Node_FunctionEntry.h"
-#include "K2Node_CallFunction.h"
-#include "K2Node_VariableGet.h"
-#include "K2Node_VariableSet.h"
-#include "K2Node_Knot.h"
-#include "Dom/JsonObject.h"
-#include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
 #include "HAL/PlatformFileManager.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
@@ -23,6 +32,7 @@
 #include "ToolMenus.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
 #include "BlueprintEditorModule.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 
@@ -34,6 +44,30 @@
 // Define custom log category
 DEFINE_LOG_CATEGORY(LogBlueprintExporter);
 
+// ============================================================================
+// Settings
+// ============================================================================
+
+FBlueprintExportConfig UBlueprintExporterSettings::ToExportConfig() const
+{
+	FBlueprintExportConfig Config;
+	Config.OutputDirectory = OutputDirectory;
+	Config.bGenerateMarkdown = bGenerateMarkdown;
+	Config.bPrettyPrintJson = bPrettyPrintJson;
+	Config.Format = Format;
+	Config.bBundleExport = bBundleExport;
+	Config.bCompressBundleRecords = bCompressBundleRecords;
+	Config.bFunctionGraphsById = bFunctionGraphsById;
+	Config.bCompactSchema = bCompactSchema;
+	Config.bParallelExport = bParallelExport;
+	Config.MaxInFlightExports = MaxInFlightExports;
+	Config.bIncrementalExport = bIncrementalExport;
+	Config.MaxPrefetchPackages = MaxPrefetchPackages;
+	Config.PrefetchMemoryBudgetMB = PrefetchMemoryBudgetMB;
+	Config.MemoryBudgetMB = MemoryBudgetMB;
+	return Config;
+}
+
 // ============================================================================
 // Main Export Functions
 // ============================================================================
@@ -46,29 +80,15 @@ FString UBlueprintExporterLibrary::ExtractBlueprintData(UBlueprint* Blueprint, b
 		return TEXT("{}");
 	}
 
-	TSharedPtr<FJsonObject> JsonObject = SerializeBlueprint(Blueprint);
-	if (!JsonObject.IsValid())
+	FBlueprintSnapshot Snapshot;
+	if (!CaptureBlueprint(Blueprint, Snapshot))
 	{
 		UE_LOG(LogBlueprintExporter, Error, TEXT("ExtractBlueprintData: Failed to serialize blueprint"));
 		return TEXT("{}");
 	}
 
-	// Convert to string
 	FString OutputString;
-	bool bSuccess = false;
-
-	if (bPrettyPrint)
-	{
-		TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&OutputString);
-		bSuccess = FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
-	}
-	else
-	{
-		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutputString);
-		bSuccess = FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
-	}
-
-	if (!bSuccess)
+	if (!SnapshotToJsonString(Snapshot, bPrettyPrint, OutputString))
 	{
 		UE_LOG(LogBlueprintExporter, Error, TEXT("ExtractBlueprintData: Failed to serialize JSON to string"));
 		return TEXT("{}");
@@ -107,20 +127,41 @@ bool UBlueprintExporterLibrary::ExportBlueprintToFile(UBlueprint* Blueprint, con
 		}
 	}
 
-	FString JsonString = ExtractBlueprintData(Blueprint, bPrettyPrint);
-
-	// Save to file
-	if (FFileHelper::SaveStringToFile(JsonString, *FilePath))
+	FBlueprintSnapshot Snapshot;
+	if (!CaptureBlueprint(Blueprint, Snapshot))
 	{
-		UE_LOG(LogBlueprintExporter, Log, TEXT("Exported blueprint to: %s"), *FilePath);
-		return true;
+		return false;
 	}
 
-	UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to save file: %s"), *FilePath);
-	return false;
+	return FBlueprintJsonSink(bPrettyPrint).WriteFile(Snapshot, FilePath);
 }
 
 int32 UBlueprintExporterLibrary::ExportAllBlueprints(const FString& OutputDirectory, bool bPrettyPrint, bool bGenerateMarkdown)
+{
+	// Only the parameters count, never the project settings: a full export of JSON files per blueprint
+	FBlueprintExportConfig Config;
+	Config.bPrettyPrintJson = bPrettyPrint;
+	Config.bGenerateMarkdown = bGenerateMarkdown;
+	Config.bIncrementalExport = false;
+
+	return ExportAllBlueprintsToDirectory(OutputDirectory, Config);
+}
+
+int32 UBlueprintExporterLibrary::ExportAllBlueprintsWithSettings(const FString& OutputDirectory)
+{
+	const UBlueprintExporterSettings* Settings = GetDefault<UBlueprintExporterSettings>();
+	const FString Directory = OutputDirectory.IsEmpty() ? Settings->OutputDirectory : OutputDirectory;
+	return ExportAllBlueprintsToDirectory(FPaths::IsRelative(Directory) ? FPaths::Combine(FPaths::ProjectDir(), Directory) : Directory, Settings->ToExportConfig());
+}
+
+int32 UBlueprintExporterLibrary::ExportAllBlueprintsWithConfig(const FBlueprintExportConfig& Config)
+{
+	FString ProjectDir = FPaths::ProjectDir();
+	FString OutputDir = FPaths::Combine(ProjectDir, Config.OutputDirectory);
+	return ExportAllBlueprintsToDirectory(OutputDir, Config);
+}
+
+int32 UBlueprintExporterLibrary::ExportAllBlueprintsToDirectory(const FString& OutputDirectory, const FBlueprintExportConfig& Config)
 {
 	if (OutputDirectory.IsEmpty())
 	{
@@ -138,505 +179,460 @@ int32 UBlueprintExporterLibrary::ExportAllBlueprints(const FString& OutputDirect
 		}
 	}
 
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
 	TArray<FAssetData> AssetDataList;
-	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetDataList);
+	FBlueprintBulkExporter::GatherBlueprintAssets(AssetDataList);
 
-	FScopedSlowTask Progress(AssetDataList.Num(), FText::FromString("Exporting Blueprints"));
-	Progress.MakeDialog();
+	FBlueprintBulkExporter Exporter(OutputDirectory, Config);
+	return Exporter.Run(AssetDataList);
+}
 
-	int32 ExportedCount = 0;
-	int32 FailedCount = 0;
+TArray<FBlueprintExportResult> UBlueprintExporterLibrary::ExportBlueprintBatch(const TArray<FString>& AssetPaths, const FBlueprintExportConfig& Config)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
 
-	for (const FAssetData& AssetData : AssetDataList)
+	TArray<FAssetData> Assets;
+	TArray<int32> AssetIndices;
+	for (const FString& AssetPath : AssetPaths)
 	{
-		Progress.EnterProgressFrame(1.0f, FText::FromString(FString::Printf(TEXT("Exporting %s"), *AssetData.AssetName.ToString())));
-
-		UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
-		if (!Blueprint)
-		{
-			FailedCount++;
-			continue;
-		}
-
-		// Get asset path and convert to output path with folder structure
-		// e.g., /Game/Characters/BP_Player -> OutputDirectory/Characters/BP_Player.json
-		FString AssetPath = AssetData.PackageName.ToString();
-		FString RelativePath = AssetPath;
-
-		// Remove /Game/ prefix
-		if (RelativePath.StartsWith(TEXT("/Game/")))
+		// Accept package names as well as object paths
+		FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPath));
+		if (!AssetData.IsValid())
 		{
-			RelativePath = RelativePath.RightChop(6); // Remove "/Game/"
-		}
-
-		// Determine output path (with or without subdirectories)
-		FString Directory;
-		FString FileName = Blueprint->GetName();
-		FString TargetDirectory = OutputDirectory;
-
-		if (RelativePath.Split(TEXT("/"), &Directory, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromEnd))
-		{
-			// Has subdirectories
-			TargetDirectory = FPaths::Combine(OutputDirectory, Directory);
-			if (!PlatformFile.DirectoryExists(*TargetDirectory))
+			TArray<FAssetData> PackageAssets;
+			AssetRegistry.GetAssetsByPackageName(FName(*AssetPath), PackageAssets);
+			if (PackageAssets.Num() > 0)
 			{
-				PlatformFile.CreateDirectoryTree(*TargetDirectory);
+				AssetData = PackageAssets[0];
 			}
 		}
 
-		// Export JSON
-		FString JsonPath = FPaths::Combine(TargetDirectory, FileName + TEXT(".json"));
-		if (ExportBlueprintToFile(Blueprint, JsonPath, bPrettyPrint))
+		if (AssetData.IsValid() && AssetData.IsInstanceOf(UBlueprint::StaticClass()))
 		{
-			ExportedCount++;
+			AssetIndices.Add(Assets.Add(MoveTemp(AssetData)));
 		}
 		else
 		{
-			FailedCount++;
-			continue;
+			UE_LOG(LogBlueprintExporter, Warning, TEXT("ExportBlueprintBatch: No blueprint found at %s"), *AssetPath);
+			AssetIndices.Add(INDEX_NONE);
 		}
+	}
+
+	const TArray<FBlueprintExportResult> AssetResults = ExportAssetBatch(Assets, Config);
 
-		// Export Markdown if requested
-		if (bGenerateMarkdown)
+	// One result per path, in the caller's order
+	TArray<FBlueprintExportResult> Results;
+	Results.Reserve(AssetPaths.Num());
+	for (int32 Index = 0; Index < AssetPaths.Num(); ++Index)
+	{
+		if (AssetResults.IsValidIndex(AssetIndices[Index]))
 		{
-			FString MarkdownPath = FPaths::Combine(TargetDirectory, FileName + TEXT(".md"));
-			if (!ExportBlueprintToMarkdown(Blueprint, MarkdownPath))
-			{
-				UE_LOG(LogBlueprintExporter, Warning, TEXT("Failed to export markdown for: %s"), *FileName);
-			}
+			Results.Add(AssetResults[AssetIndices[Index]]);
+		}
+		else
+		{
+			FBlueprintExportResult& Result = Results.AddDefaulted_GetRef();
+			Result.AssetPath = AssetPaths[Index];
+			Result.Status = EBlueprintExportStatus::Failed;
 		}
 	}
-
-	UE_LOG(LogBlueprintExporter, Log, TEXT("Exported %d blueprints to %s (%d failed)"), ExportedCount, *OutputDirectory, FailedCount);
-	return ExportedCount;
+	return Results;
 }
 
-int32 UBlueprintExporterLibrary::ExportAllBlueprintsWithConfig(const FBlueprintExportConfig& Config)
+TArray<FBlueprintExportResult> UBlueprintExporterLibrary::ExportBlueprintsInPaths(const TArray<FString>& PackagePaths, bool bRecursive, const FBlueprintExportConfig& Config)
 {
-	FString ProjectDir = FPaths::ProjectDir();
-	FString OutputDir = FPaths::Combine(ProjectDir, Config.OutputDirectory);
-	return ExportAllBlueprints(OutputDir, Config.bPrettyPrintJson, Config.bGenerateMarkdown);
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursivePaths = bRecursive;
+	for (const FString& PackagePath : PackagePaths)
+	{
+		Filter.PackagePaths.Add(FName(*PackagePath));
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	return ExportAssetBatch(Assets, Config);
 }
 
-bool UBlueprintExporterLibrary::ExportBlueprintToMarkdown(UBlueprint* Blueprint, const FString& FilePath)
+TArray<FBlueprintExportResult> UBlueprintExporterLibrary::ExportAssetBatch(const TArray<FAssetData>& Assets, const FBlueprintExportConfig& Config)
 {
-	if (!Blueprint)
+	FString OutputDirectory = Config.OutputDirectory;
+	if (FPaths::IsRelative(OutputDirectory))
 	{
-		UE_LOG(LogBlueprintExporter, Error, TEXT("ExportBlueprintToMarkdown: Invalid blueprint"));
-		return false;
+		OutputDirectory = FPaths::Combine(FPaths::ProjectDir(), OutputDirectory);
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.DirectoryExists(*OutputDirectory) && !PlatformFile.CreateDirectoryTree(*OutputDirectory))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("ExportBlueprintBatch: Failed to create output directory: %s"), *OutputDirectory);
+
+		TArray<FBlueprintExportResult> Results;
+		for (const FAssetData& AssetData : Assets)
+		{
+			Results.AddDefaulted_GetRef().AssetPath = AssetData.GetSoftObjectPath().ToString();
+		}
+		return Results;
 	}
 
-	TSharedPtr<FJsonObject> JsonObject = SerializeBlueprint(Blueprint);
-	FString MarkdownContent = GenerateMarkdownFromJson(JsonObject, Blueprint);
+	// A batch is a subset of the project: only deleted blueprints count as stale
+	TArray<FAssetData> ProjectAssets;
+	FBlueprintBulkExporter::GatherBlueprintAssets(ProjectAssets);
 
-	// Save to file
-	if (FFileHelper::SaveStringToFile(MarkdownContent, *FilePath))
+	TSet<FName> ProjectPackageNames;
+	for (const FAssetData& AssetData : ProjectAssets)
 	{
-		UE_LOG(LogBlueprintExporter, Log, TEXT("Exported markdown to: %s"), *FilePath);
-		return true;
+		ProjectPackageNames.Add(AssetData.PackageName);
 	}
 
-	UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to save markdown file: %s"), *FilePath);
-	return false;
+	FBlueprintBulkExporter Exporter(OutputDirectory, Config);
+	Exporter.SetProjectPackageNames(MoveTemp(ProjectPackageNames));
+	Exporter.Run(Assets);
+	return Exporter.GetResults();
 }
 
-FString UBlueprintExporterLibrary::GenerateMarkdownFromJson(TSharedPtr<FJsonObject> JsonObject, UBlueprint* Blueprint)
+/**
+ * The dependency index of an export directory (every shard's file, merged)
+ * Kept between calls and reloaded when an index file changes, so repeated queries only walk the graph.
+ * Any thread may ask; the cache is swapped under a lock, and an index already handed out is never changed.
+ */
+static TSharedRef<const FBlueprintDependencyIndex> GetDependencyIndex(const FString& InOutputDirectory)
 {
-	FString Markdown;
-
-	// Header
-	FString Name = JsonObject->GetStringField(TEXT("name"));
-	FString ClassType = JsonObject->GetStringField(TEXT("class_type"));
-	FString Path = JsonObject->GetStringField(TEXT("path"));
-	FString ParentClass = JsonObject->HasField(TEXT("parent_class")) ? JsonObject->GetStringField(TEXT("parent_class")) : TEXT("None");
+	FString OutputDirectory = InOutputDirectory.IsEmpty() ? GetDefault<UBlueprintExporterSettings>()->OutputDirectory : InOutputDirectory;
+	if (FPaths::IsRelative(OutputDirectory))
+	{
+		OutputDirectory = FPaths::Combine(FPaths::ProjectDir(), OutputDirectory);
+	}
 
-	Markdown += FString::Printf(TEXT("# %s\n\n"), *Name);
-	Markdown += FString::Printf(TEXT("**Type:** %s  \n"), *ClassType);
-	Markdown += FString::Printf(TEXT("**Path:** `%s`  \n"), *Path);
-	Markdown += FString::Printf(TEXT("**Parent Class:** %s  \n\n"), *ParentClass);
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(OutputDirectory, FPaths::GetBaseFilename(FBlueprintDependencyIndex::FileName) + TEXT("*.json")), true, false);
+	FileNames.Sort();
 
-	// Components
-	const TArray<TSharedPtr<FJsonValue>>* ComponentsArray;
-	if (JsonObject->TryGetArrayField(TEXT("components"), ComponentsArray) && ComponentsArray->Num() > 0)
+	// Cache key: the directory and the name and time of every index file in it
+	FString Key = OutputDirectory;
+	for (const FString& FileName : FileNames)
 	{
-		Markdown += TEXT("## Components\n\n");
-		for (const TSharedPtr<FJsonValue>& ComponentValue : *ComponentsArray)
-		{
-			TSharedPtr<FJsonObject> ComponentObj = ComponentValue->AsObject();
-			FString CompName = ComponentObj->GetStringField(TEXT("name"));
-			FString CompClass = ComponentObj->GetStringField(TEXT("class"));
-			Markdown += FString::Printf(TEXT("- **%s** (%s)\n"), *CompName, *CompClass);
-		}
-		Markdown += TEXT("\n");
+		Key += FString::Printf(TEXT("|%s@%s"), *FileName, *IFileManager::Get().GetTimeStamp(*FPaths::Combine(OutputDirectory, FileName)).ToString());
 	}
 
-	// Variables
-	const TArray<TSharedPtr<FJsonValue>>* VariablesArray;
-	if (JsonObject->TryGetArrayField(TEXT("variables"), VariablesArray) && VariablesArray->Num() > 0)
+	static FCriticalSection CacheLock;
+	static FString CachedKey;
+	static TSharedPtr<FBlueprintDependencyIndex> CachedIndex;
+
+	FScopeLock Lock(&CacheLock);
+	if (!CachedIndex.IsValid() || CachedKey != Key)
 	{
-		Markdown += TEXT("## Variables\n\n");
-		Markdown += TEXT("| Name | Type | Category | Exposed |\n");
-		Markdown += TEXT("|------|------|----------|---------|\n");
-		for (const TSharedPtr<FJsonValue>& VarValue : *VariablesArray)
+		TSharedPtr<FBlueprintDependencyIndex> Index = MakeShared<FBlueprintDependencyIndex>(OutputDirectory);
+		for (const FString& FileName : FileNames)
 		{
-			TSharedPtr<FJsonObject> VarObj = VarValue->AsObject();
-			FString VarName = VarObj->GetStringField(TEXT("name"));
-			FString VarType = VarObj->GetStringField(TEXT("type"));
-			FString VarCategory = VarObj->GetStringField(TEXT("category"));
-			bool bIsExposed = VarObj->GetBoolField(TEXT("is_exposed"));
-			Markdown += FString::Printf(TEXT("| %s | %s | %s | %s |\n"),
-				*VarName, *VarType, *VarCategory, bIsExposed ? TEXT("Yes") : TEXT("No"));
+			Index->LoadFile(FPaths::Combine(OutputDirectory, FileName));
 		}
-		Markdown += TEXT("\n");
+
+		// Build the query graph now, so callers on other threads only ever read it
+		Index->GetGraph();
+		CachedIndex = MoveTemp(Index);
+		CachedKey = MoveTemp(Key);
 	}
 
-	// Functions
-	const TArray<TSharedPtr<FJsonValue>>* FunctionsArray;
-	if (JsonObject->TryGetArrayField(TEXT("functions"), FunctionsArray) && FunctionsArray->Num() > 0)
+	return CachedIndex.ToSharedRef();
+}
+
+TArray<FString> UBlueprintExporterLibrary::FindDependents(const FString& Path, bool bTransitive, const FString& OutputDirectory)
+{
+	return GetDependencyIndex(OutputDirectory)->Walk(Path, true, bTransitive);
+}
+
+TArray<FString> UBlueprintExporterLibrary::FindDependencies(const FString& Path, bool bTransitive, const FString& OutputDirectory)
+{
+	return GetDependencyIndex(OutputDirectory)->Walk(Path, false, bTransitive);
+}
+
+static FString ResolveProjectPath(const FString& Path)
+{
+	return FPaths::IsRelative(Path) ? FPaths::Combine(FPaths::ProjectDir(), Path) : Path;
+}
+
+static FString FormatDiff(const FBlueprintExportDiff& Diff, bool bMarkdown)
+{
+	return bMarkdown ? FBlueprintDiffWriter::ToMarkdown(Diff) : FBlueprintDiffWriter::ToJson(Diff);
+}
+
+FString UBlueprintExporterLibrary::DiffExports(const FString& OldPath, const FString& NewPath, bool bMarkdown)
+{
+	const FString OldFullPath = ResolveProjectPath(OldPath);
+	const FString NewFullPath = ResolveProjectPath(NewPath);
+
+	FBlueprintExportDiff Diff;
+	const bool bDirectories = IFileManager::Get().DirectoryExists(*OldFullPath) && IFileManager::Get().DirectoryExists(*NewFullPath);
+	const bool bCompared = bDirectories
+		? FBlueprintSnapshotDiff::DiffDirectories(OldFullPath, NewFullPath, Diff)
+		: FBlueprintSnapshotDiff::DiffFiles(OldFullPath, NewFullPath, Diff);
+	return bCompared ? FormatDiff(Diff, bMarkdown) : FString();
+}
+
+FString UBlueprintExporterLibrary::DiffBlueprintWithExport(UBlueprint* Blueprint, const FString& ExportedFile, bool bMarkdown)
+{
+	const FString FullPath = ResolveProjectPath(ExportedFile);
+
+	FBlueprintSnapshot OldSnapshot;
+	FBlueprintSnapshot NewSnapshot;
+	if (!FBlueprintSnapshotReader::LoadFile(FullPath, OldSnapshot) || !CaptureBlueprint(Blueprint, NewSnapshot))
 	{
-		Markdown += TEXT("## Functions\n\n");
-		for (const TSharedPtr<FJsonValue>& FuncValue : *FunctionsArray)
-		{
-			TSharedPtr<FJsonObject> FuncObj = FuncValue->AsObject();
-			FString FuncName = FuncObj->GetStringField(TEXT("name"));
+		return FString();
+	}
 
-			// Build parameters string
-			FString ParamsStr;
-			const TArray<TSharedPtr<FJsonValue>>* ParamsArray;
-			if (FuncObj->TryGetArrayField(TEXT("parameters"), ParamsArray))
-			{
-				for (int32 i = 0; i < ParamsArray->Num(); i++)
-				{
-					TSharedPtr<FJsonObject> ParamObj = (*ParamsArray)[i]->AsObject();
-					FString ParamName = ParamObj->GetStringField(TEXT("name"));
-					FString ParamType = ParamObj->GetStringField(TEXT("type"));
-					ParamsStr += FString::Printf(TEXT("%s: %s"), *ParamName, *ParamType);
-					if (i < ParamsArray->Num() - 1)
-					{
-						ParamsStr += TEXT(", ");
-					}
-				}
-			}
+	FBlueprintExportDiff Diff;
+	Diff.OldSource = FullPath;
+	Diff.NewSource = NewSnapshot.Path;
 
-			Markdown += FString::Printf(TEXT("### %s(%s)\n\n"), *FuncName, *ParamsStr);
+	FBlueprintDiff BlueprintDiff;
+	if (FBlueprintSnapshotDiff::DiffSnapshots(OldSnapshot, NewSnapshot, BlueprintDiff))
+	{
+		Diff.Blueprints.Add(MoveTemp(BlueprintDiff));
+	}
+	else
+	{
+		Diff.UnchangedCount = 1;
+	}
+	return FormatDiff(Diff, bMarkdown);
+}
 
-			// Include basic graph info
-			const TSharedPtr<FJsonObject>* GraphObjPtr;
-			if (FuncObj->TryGetObjectField(TEXT("graph"), GraphObjPtr))
-			{
-				const TArray<TSharedPtr<FJsonValue>>* NodesArray;
-				if ((*GraphObjPtr)->TryGetArrayField(TEXT("nodes"), NodesArray))
-				{
-					Markdown += FString::Printf(TEXT("**Nodes:** %d\n\n"), NodesArray->Num());
-				}
-			}
-		}
+bool UBlueprintExporterLibrary::ExportBlueprintToMarkdown(UBlueprint* Blueprint, const FString& FilePath)
+{
+	if (!Blueprint)
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("ExportBlueprintToMarkdown: Invalid blueprint"));
+		return false;
 	}
 
-	// Graphs
-	const TArray<TSharedPtr<FJsonValue>>* GraphsArray;
-	if (JsonObject->TryGetArrayField(TEXT("graphs"), GraphsArray) && GraphsArray->Num() > 0)
+	FBlueprintSnapshot Snapshot;
+	if (!CaptureBlueprint(Blueprint, Snapshot))
 	{
-		Markdown += TEXT("## Graphs\n\n");
-		for (const TSharedPtr<FJsonValue>& GraphValue : *GraphsArray)
-		{
-			TSharedPtr<FJsonObject> GraphObj = GraphValue->AsObject();
-			FString GraphName = GraphObj->GetStringField(TEXT("name"));
+		return false;
+	}
 
-			const TArray<TSharedPtr<FJsonValue>>* NodesArray;
-			if (GraphObj->TryGetArrayField(TEXT("nodes"), NodesArray))
-			{
-				Markdown += FString::Printf(TEXT("### %s\n\n"), *GraphName);
-				Markdown += FString::Printf(TEXT("**Total Nodes:** %d\n\n"), NodesArray->Num());
+	return FBlueprintMarkdownSink().WriteFile(Snapshot, FilePath);
+}
 
-				// List node types
-				TMap<FString, int32> NodeTypeCounts;
-				for (const TSharedPtr<FJsonValue>& NodeValue : *NodesArray)
-				{
-					TSharedPtr<FJsonObject> NodeObj = NodeValue->AsObject();
-					FString NodeType = NodeObj->GetStringField(TEXT("type"));
-					NodeTypeCounts.FindOrAdd(NodeType, 0)++;
-				}
+bool UBlueprintExporterLibrary::SnapshotToJsonString(const FBlueprintSnapshot& Snapshot, bool bPrettyPrint, FString& OutJson)
+{
+	FBlueprintJsonOptions Options;
+	Options.bPrettyPrint = bPrettyPrint;
+	return SnapshotToJsonString(Snapshot, Options, OutJson);
+}
 
-				if (NodeTypeCounts.Num() > 0)
-				{
-					Markdown += TEXT("**Node Types:**\n\n");
-					for (const TPair<FString, int32>& Pair : NodeTypeCounts)
-					{
-						Markdown += FString::Printf(TEXT("- %s: %d\n"), *Pair.Key, Pair.Value);
-					}
-					Markdown += TEXT("\n");
-				}
-			}
-		}
-	}
+bool UBlueprintExporterLibrary::SnapshotToJsonString(const FBlueprintSnapshot& Snapshot, const FBlueprintJsonOptions& Options, FString& OutJson)
+{
+	BLUEPRINT_EXPORT_PHASE_SCOPE(FormatJson);
 
-	// Dependencies
-	const TArray<TSharedPtr<FJsonValue>>* DependenciesArray;
-	if (JsonObject->TryGetArrayField(TEXT("dependencies"), DependenciesArray) && DependenciesArray->Num() > 0)
+	// Stream straight into the writer; no intermediate FJsonObject tree
+	if (Options.bPrettyPrint)
 	{
-		Markdown += TEXT("## Dependencies\n\n");
-		int32 Count = FMath::Min(DependenciesArray->Num(), 10); // Limit to first 10
-		for (int32 i = 0; i < Count; i++)
-		{
-			FString Dependency = (*DependenciesArray)[i]->AsString();
-			Markdown += FString::Printf(TEXT("- `%s`\n"), *Dependency);
-		}
-		if (DependenciesArray->Num() > 10)
-		{
-			Markdown += FString::Printf(TEXT("\n_...and %d more_\n"), DependenciesArray->Num() - 10);
-		}
-		Markdown += TEXT("\n");
+		TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&OutJson);
+		TBlueprintJsonWriter<TPrettyJsonPrintPolicy<TCHAR>>::WriteBlueprint(*Writer, Snapshot, Options);
+		const bool bClosed = Writer->Close();
+		FBlueprintExportProfile::AddBytes(EBlueprintExportPhase::FormatJson, OutJson.Len());
+		return bClosed;
 	}
 
-	Markdown += TEXT("---\n\n");
-	Markdown += TEXT("_Generated by Blueprint Exporter Plugin_\n");
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutJson);
+	TBlueprintJsonWriter<TCondensedJsonPrintPolicy<TCHAR>>::WriteBlueprint(*Writer, Snapshot, Options);
+	const bool bClosed = Writer->Close();
+	FBlueprintExportProfile::AddBytes(EBlueprintExportPhase::FormatJson, OutJson.Len());
+	return bClosed;
+}
+
+FString UBlueprintExporterLibrary::GenerateMarkdown(const FBlueprintSnapshot& Snapshot)
+{
+	BLUEPRINT_EXPORT_PHASE_SCOPE(FormatMarkdown);
 
+	FString Markdown;
+	Markdown.Reserve(FBlueprintMarkdownWriter::EstimateLength(Snapshot));
+	FBlueprintMarkdownWriter(Markdown).WriteBlueprint(Snapshot);
+	FBlueprintExportProfile::AddBytes(EBlueprintExportPhase::FormatMarkdown, Markdown.Len());
 	return Markdown;
 }
 
 // ============================================================================
-// Serialization Functions
+// Capture Functions
 // ============================================================================
 
-TSharedPtr<FJsonObject> UBlueprintExporterLibrary::SerializeBlueprint(UBlueprint* Blueprint)
+bool UBlueprintExporterLibrary::CaptureBlueprint(UBlueprint* Blueprint, FBlueprintSnapshot& OutSnapshot)
 {
 	if (!Blueprint)
 	{
-		UE_LOG(LogBlueprintExporter, Error, TEXT("SerializeBlueprint: Invalid blueprint"));
-		return MakeShareable(new FJsonObject);
+		UE_LOG(LogBlueprintExporter, Error, TEXT("CaptureBlueprint: Invalid blueprint"));
+		return false;
 	}
 
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	BLUEPRINT_EXPORT_PHASE_SCOPE(Capture);
+
+	OutSnapshot = FBlueprintSnapshot();
 
 	// Basic info
-	JsonObject->SetStringField(TEXT("name"), Blueprint->GetName());
-	JsonObject->SetStringField(TEXT("path"), Blueprint->GetPathName());
-	JsonObject->SetStringField(TEXT("class_type"), TEXT("Blueprint"));
+	OutSnapshot.Name = Blueprint->GetName();
+	OutSnapshot.Path = Blueprint->GetPathName();
+	OutSnapshot.PackageName = Blueprint->GetOutermost()->GetName();
 
 	// Parent class
 	if (Blueprint->ParentClass)
 	{
-		JsonObject->SetStringField(TEXT("parent_class"), Blueprint->ParentClass->GetName());
+		OutSnapshot.ParentClass = Blueprint->ParentClass->GetName();
 	}
 
 	// Generated class
 	if (Blueprint->GeneratedClass)
 	{
-		JsonObject->SetStringField(TEXT("generated_class"), Blueprint->GeneratedClass->GetName());
+		OutSnapshot.GeneratedClass = Blueprint->GeneratedClass->GetName();
 	}
 
-	// Graphs
-	TArray<TSharedPtr<FJsonValue>> GraphsArray;
-	for (UEdGraph* Graph : Blueprint->UbergraphPages)
-	{
-		if (Graph)
-		{
-			GraphsArray.Add(MakeShareable(new FJsonValueObject(SerializeGraph(Graph))));
-		}
-	}
+	// Type strings are built once per distinct pin type
+	FBlueprintPinTypeNames TypeNames;
 
-	// Also add function graphs
-	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+	// Every graph is read into the engine-independent model once (see FBlueprintGraphAdapter):
+	// event graphs first, then function graphs, both exported; macro and delegate signature
+	// graphs after them, only read for their dependencies
+	std::vector<BlueprintGraph::FGraph> Models;
+	TMap<UEdGraph*, int32> GraphIndices;
+	auto AddGraphs = [&Models, &TypeNames](const TArray<UEdGraph*>& Graphs, FBlueprintGraphAdapter::EFill Fill, TMap<UEdGraph*, int32>* OutIndices)
 	{
-		if (Graph)
+		for (UEdGraph* Graph : Graphs)
 		{
-			GraphsArray.Add(MakeShareable(new FJsonValueObject(SerializeGraph(Graph))));
+			if (Graph)
+			{
+				if (OutIndices)
+				{
+					OutIndices->Add(Graph, static_cast<int32>(Models.size()));
+				}
+				BLUEPRINT_EXPORT_PHASE_SCOPE(ReadGraph);
+				FBlueprintGraphAdapter::FillGraph(Graph, TypeNames, Models.emplace_back(), Fill);
+			}
 		}
-	}
-
-	JsonObject->SetArrayField(TEXT("graphs"), GraphsArray);
-
-	// Variables
-	JsonObject->SetArrayField(TEXT("variables"), SerializeVariables(Blueprint));
-
-	// Functions
-	JsonObject->SetArrayField(TEXT("functions"), SerializeFunctions(Blueprint));
-
-	// Components
-	JsonObject->SetArrayField(TEXT("components"), SerializeComponents(Blueprint));
-
-	// Dependencies
-	JsonObject->SetArrayField(TEXT("dependencies"), ExtractDependencies(Blueprint));
-
-	return JsonObject;
-}
+	};
 
-TSharedPtr<FJsonObject> UBlueprintExporterLibrary::SerializeGraph(UEdGraph* Graph)
-{
-	TSharedPtr<FJsonObject> GraphObject = MakeShareable(new FJsonObject);
+	AddGraphs(Blueprint->UbergraphPages, FBlueprintGraphAdapter::EFill::Full, nullptr);
+	AddGraphs(Blueprint->FunctionGraphs, FBlueprintGraphAdapter::EFill::Full, &GraphIndices);
+	const int32 NumExportedGraphs = static_cast<int32>(Models.size());
+	AddGraphs(Blueprint->MacroGraphs, FBlueprintGraphAdapter::EFill::DependenciesOnly, nullptr);
+	AddGraphs(Blueprint->DelegateSignatureGraphs, FBlueprintGraphAdapter::EFill::DependenciesOnly, nullptr);
 
-	if (!Graph)
+	OutSnapshot.Graphs.Reserve(NumExportedGraphs);
+	for (int32 GraphIndex = 0; GraphIndex < NumExportedGraphs; ++GraphIndex)
 	{
-		UE_LOG(LogBlueprintExporter, Warning, TEXT("SerializeGraph: Invalid graph"));
-		return GraphObject;
+		CaptureGraph(Models[GraphIndex], OutSnapshot.Graphs.AddDefaulted_GetRef());
 	}
 
-	GraphObject->SetStringField(TEXT("name"), Graph->GetName());
+	CaptureVariables(Blueprint, TypeNames, OutSnapshot.Variables);
+	CaptureFunctions(Blueprint, GraphIndices, TypeNames, OutSnapshot.Functions);
+	CaptureComponents(Blueprint, OutSnapshot.Components);
+	OutSnapshot.Dependencies = FBlueprintGraphAdapter::GetDependencies(Models);
 
-	// === NEW: Execution-flow ordering ===
-
-	// 1. Collect all nodes into unexported set (excluding knot nodes)
-	TSet<UEdGraphNode*> UnexportedNodes;
-	for (UEdGraphNode* Node : Graph->Nodes)
 	{
-		if (Node && !Cast<UK2Node_Knot>(Node))
-		{
-			UnexportedNodes.Add(Node);
-		}
+		BLUEPRINT_EXPORT_PHASE_SCOPE(Hash);
+		OutSnapshot.Hash = FBlueprintSnapshotHash::HashBlueprint(OutSnapshot);
 	}
 
-	TArray<TSharedPtr<FJsonValue>> OrderedNodesArray;
+	return true;
+}
 
-	// 2. Find and sort entry points (Event nodes, Function entry nodes, excluding knots)
-	TArray<UEdGraphNode*> EntryPoints;
-	for (UEdGraphNode* Node : Graph->Nodes)
-	{
-		if (Node && !Cast<UK2Node_Knot>(Node) && IsEntryPointNode(Node))
-		{
-			EntryPoints.Add(Node);
-		}
-	}
+void UBlueprintExporterLibrary::CaptureGraph(const BlueprintGraph::FGraph& Graph, FBlueprintGraphSnapshot& OutGraph)
+{
+	BLUEPRINT_EXPORT_PHASE_SCOPE(CaptureGraph);
 
-	// Sort entry points alphabetically for determinism
-	EntryPoints.Sort([](const UEdGraphNode& A, const UEdGraphNode& B) {
-		return A.GetName() < B.GetName();
-	});
+	OutGraph.Name = FBlueprintGraphAdapter::FromUtf8(Graph.Name);
 
-	// 3. Export each entry point and its execution flow
-	for (UEdGraphNode* EntryPoint : EntryPoints)
+	// Reroute chains are collapsed once per graph, not once per pin that reaches them
+	const BlueprintGraph::FKnotMap Knots = [&Graph]()
 	{
-		ExportNodeRecursive(EntryPoint, UnexportedNodes, OrderedNodesArray);
-	}
+		BLUEPRINT_EXPORT_PHASE_SCOPE(Knots);
+		return BlueprintGraph::FKnotMap(Graph);
+	}();
 
-	// 4. Export remaining nodes (data nodes, disconnected nodes, etc.)
-	TArray<UEdGraphNode*> RemainingNodes = UnexportedNodes.Array();
-	RemainingNodes.Sort([](const UEdGraphNode& A, const UEdGraphNode& B) {
-		return A.GetName() < B.GetName();
-	});
+	// Execution-flow ordering (see BlueprintGraph::FNodeOrdering)
+	const BlueprintGraph::FNodeOrdering Ordering = [&Graph, &Knots]()
+	{
+		BLUEPRINT_EXPORT_PHASE_SCOPE(Order);
+		return BlueprintGraph::FNodeOrdering(Graph, Knots);
+	}();
 
-	for (UEdGraphNode* Node : RemainingNodes)
+	OutGraph.Nodes.Reserve(static_cast<int32>(Ordering.GetOrderedNodes().size()));
+	for (const int32 NodeIndex : Ordering.GetOrderedNodes())
 	{
-		OrderedNodesArray.Add(
-			MakeShareable(new FJsonValueObject(SerializeNode(Node)))
-		);
-		UnexportedNodes.Remove(Node);
+		CaptureNode(Graph, NodeIndex, Knots, OutGraph.Nodes.AddDefaulted_GetRef());
 	}
 
-	GraphObject->SetArrayField(TEXT("nodes"), OrderedNodesArray);
-
-	return GraphObject;
+	BLUEPRINT_EXPORT_PHASE_SCOPE(Hash);
+	FBlueprintSnapshotHash::UpdateGraph(OutGraph);
 }
 
-TSharedPtr<FJsonObject> UBlueprintExporterLibrary::SerializeNode(UEdGraphNode* Node)
+void UBlueprintExporterLibrary::CaptureNode(const BlueprintGraph::FGraph& Graph, int32 NodeIndex, const BlueprintGraph::FKnotMap& Knots, FBlueprintNodeSnapshot& OutNode)
 {
-	TSharedPtr<FJsonObject> NodeObject = MakeShareable(new FJsonObject);
-
-	if (!Node)
-	{
-		UE_LOG(LogBlueprintExporter, Warning, TEXT("SerializeNode: Invalid node"));
-		return NodeObject;
-	}
+	const BlueprintGraph::FNode& Node = Graph.Nodes[NodeIndex];
 
-	NodeObject->SetStringField(TEXT("id"), Node->GetName());
-	NodeObject->SetStringField(TEXT("type"), NodeTypeToString(Node));
-	NodeObject->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
+	OutNode.Id = FBlueprintGraphAdapter::FromUtf8(Node.Name);
+	OutNode.Type = FBlueprintGraphAdapter::FromUtf8(BlueprintGraph::GetNodeTypeName(Node));
+	OutNode.Title = FBlueprintGraphAdapter::FromUtf8(Node.Title);
+	OutNode.Symbol = FBlueprintGraphAdapter::FromUtf8(BlueprintGraph::GetNodeSymbol(Node));
 
 	// Pins (filter out delegate pins)
-	TArray<TSharedPtr<FJsonValue>> PinsArray;
-	for (UEdGraphPin* Pin : Node->Pins)
+	OutNode.Pins.Reserve(static_cast<int32>(Node.Pins.size()));
+	for (int32 PinIndex = 0; PinIndex < static_cast<int32>(Node.Pins.size()); ++PinIndex)
 	{
-		if (Pin && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Delegate)
+		if (!Node.Pins[PinIndex].bIsDelegate)
 		{
-			PinsArray.Add(MakeShareable(new FJsonValueObject(SerializePin(Pin))));
+			CapturePin(Graph, { NodeIndex, PinIndex }, Knots, OutNode.Pins.AddDefaulted_GetRef());
 		}
 	}
-	NodeObject->SetArrayField(TEXT("pins"), PinsArray);
-
-	return NodeObject;
 }
 
-TSharedPtr<FJsonObject> UBlueprintExporterLibrary::SerializePin(UEdGraphPin* Pin)
+void UBlueprintExporterLibrary::CapturePin(const BlueprintGraph::FGraph& Graph, BlueprintGraph::FPinRef PinRef, const BlueprintGraph::FKnotMap& Knots, FBlueprintPinSnapshot& OutPin)
 {
-	TSharedPtr<FJsonObject> PinObject = MakeShareable(new FJsonObject);
+	const BlueprintGraph::FPin& Pin = Graph.GetPin(PinRef);
 
-	PinObject->SetStringField(TEXT("name"), Pin->GetName());
-	PinObject->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input ? TEXT("input") : TEXT("output"));
-	PinObject->SetStringField(TEXT("type"), PinTypeToString(Pin->PinType));
+	OutPin.Name = FBlueprintGraphAdapter::FromUtf8(Pin.Name);
+	OutPin.bIsInput = Pin.bIsInput;
+	OutPin.Type = FBlueprintGraphAdapter::FromUtf8(Pin.Type);
+	OutPin.DefaultValue = FBlueprintGraphAdapter::FromUtf8(Pin.DefaultValue);
+	OutPin.bHasLinks = !Pin.Links.empty();
 
-	// Default value
-	if (!Pin->DefaultValue.IsEmpty())
+	// Pin-to-pin connections (knot nodes collapsed)
+	const std::vector<BlueprintGraph::FPinRef>& LinkedPins = Knots.GetLinkedPins(PinRef);
+	OutPin.Connections.Reserve(static_cast<int32>(LinkedPins.size()));
+	for (const BlueprintGraph::FPinRef& LinkedPin : LinkedPins)
 	{
-		PinObject->SetStringField(TEXT("default_value"), Pin->DefaultValue);
+		FBlueprintConnectionSnapshot& Connection = OutPin.Connections.AddDefaulted_GetRef();
+		Connection.Node = FBlueprintGraphAdapter::FromUtf8(Graph.GetNode(LinkedPin).Name);
+		Connection.Pin = FBlueprintGraphAdapter::FromUtf8(Graph.GetPin(LinkedPin).Name);
 	}
-
-	// Pin-to-pin connections (minimal format, resolving knot nodes)
-	if (Pin->LinkedTo.Num() > 0)
-	{
-		TArray<TSharedPtr<FJsonValue>> ConnectionsArray;
-		for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-		{
-			TArray<UEdGraphPin*> ResolvedPins = ResolveKnotChainMulti(LinkedPin);
-
-			for (UEdGraphPin* ResolvedPin : ResolvedPins)
-			{
-				if (ResolvedPin && ResolvedPin->GetOwningNode())
-				{
-					TSharedPtr<FJsonObject> ConnectionObj = MakeShareable(new FJsonObject);
-					ConnectionObj->SetStringField(TEXT("node"), ResolvedPin->GetOwningNode()->GetName());
-					ConnectionObj->SetStringField(TEXT("pin"), ResolvedPin->GetName());
-					ConnectionsArray.Add(MakeShareable(new FJsonValueObject(ConnectionObj)));
-				}
-			}
-		}
-		PinObject->SetArrayField(TEXT("to"), ConnectionsArray);
-	}
-
-	return PinObject;
 }
 
-TArray<TSharedPtr<FJsonValue>> UBlueprintExporterLibrary::SerializeVariables(UBlueprint* Blueprint)
+void UBlueprintExporterLibrary::CaptureVariables(UBlueprint* Blueprint, FBlueprintPinTypeNames& TypeNames, TArray<FBlueprintVariableSnapshot>& OutVariables)
 {
-	TArray<TSharedPtr<FJsonValue>> VariablesArray;
+	OutVariables.Reserve(Blueprint->NewVariables.Num());
 
 	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
 	{
-		TSharedPtr<FJsonObject> VarObject = MakeShareable(new FJsonObject);
-
-		VarObject->SetStringField(TEXT("name"), Variable.VarName.ToString());
-		VarObject->SetStringField(TEXT("type"), PinTypeToString(Variable.VarType));
-		VarObject->SetStringField(TEXT("category"), Variable.Category.ToString());
-		VarObject->SetBoolField(TEXT("is_exposed"), (Variable.PropertyFlags & CPF_ExposeOnSpawn) != 0);
-
-		// Default value
-		if (!Variable.DefaultValue.IsEmpty())
-		{
-			VarObject->SetStringField(TEXT("default_value"), Variable.DefaultValue);
-		}
-
-		VariablesArray.Add(MakeShareable(new FJsonValueObject(VarObject)));
+		FBlueprintVariableSnapshot& VarSnapshot = OutVariables.AddDefaulted_GetRef();
+		VarSnapshot.Name = Variable.VarName.ToString();
+		VarSnapshot.Type = TypeNames.Get(Variable.VarType);
+		VarSnapshot.Category = Variable.Category.ToString();
+		VarSnapshot.bIsExposed = (Variable.PropertyFlags & CPF_ExposeOnSpawn) != 0;
+		VarSnapshot.DefaultValue = Variable.DefaultValue;
 	}
-
-	return VariablesArray;
 }
 
-TArray<TSharedPtr<FJsonValue>> UBlueprintExporterLibrary::SerializeFunctions(UBlueprint* Blueprint)
+void UBlueprintExporterLibrary::CaptureFunctions(UBlueprint* Blueprint, const TMap<UEdGraph*, int32>& GraphIndices, FBlueprintPinTypeNames& TypeNames, TArray<FBlueprintFunctionSnapshot>& OutFunctions)
 {
-	TArray<TSharedPtr<FJsonValue>> FunctionsArray;
-
 	for (UEdGraph* FunctionGraph : Blueprint->FunctionGraphs)
 	{
 		if (!FunctionGraph) continue;
 
-		TSharedPtr<FJsonObject> FuncObject = MakeShareable(new FJsonObject);
-
-		FuncObject->SetStringField(TEXT("name"), FunctionGraph->GetName());
+		FBlueprintFunctionSnapshot& FuncSnapshot = OutFunctions.AddDefaulted_GetRef();
+		FuncSnapshot.Name = FunctionGraph->GetName();
 
 		// Find function entry node to get parameters
-		TArray<TSharedPtr<FJsonValue>> ParamsArray;
 		for (UEdGraphNode* Node : FunctionGraph->Nodes)
 		{
 			if (UK2Node_FunctionEntry* EntryNode = Cast<UK2Node_FunctionEntry>(Node))
@@ -645,30 +641,24 @@ TArray<TSharedPtr<FJsonValue>> UBlueprintExporterLibrary::SerializeFunctions(UBl
 				{
 					if (Pin && Pin->Direction == EGPD_Output && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
 					{
-						TSharedPtr<FJsonObject> ParamObject = MakeShareable(new FJsonObject);
-						ParamObject->SetStringField(TEXT("name"), Pin->GetName());
-						ParamObject->SetStringField(TEXT("type"), PinTypeToString(Pin->PinType));
-						ParamsArray.Add(MakeShareable(new FJsonValueObject(ParamObject)));
+						FBlueprintParameterSnapshot& Param = FuncSnapshot.Parameters.AddDefaulted_GetRef();
+						Param.Name = Pin->GetName();
+						Param.Type = TypeNames.Get(Pin->PinType);
 					}
 				}
 			}
 		}
 
-		FuncObject->SetArrayField(TEXT("parameters"), ParamsArray);
-
-		// Include the graph structure
-		FuncObject->SetObjectField(TEXT("graph"), SerializeGraph(FunctionGraph));
-
-		FunctionsArray.Add(MakeShareable(new FJsonValueObject(FuncObject)));
+		// The graph itself was already captured alongside the event graphs
+		if (const int32* GraphIndex = GraphIndices.Find(FunctionGraph))
+		{
+			FuncSnapshot.GraphIndex = *GraphIndex;
+		}
 	}
-
-	return FunctionsArray;
 }
 
-TArray<TSharedPtr<FJsonValue>> UBlueprintExporterLibrary::SerializeComponents(UBlueprint* Blueprint)
+void UBlueprintExporterLibrary::CaptureComponents(UBlueprint* Blueprint, TArray<FBlueprintComponentSnapshot>& OutComponents)
 {
-	TArray<TSharedPtr<FJsonValue>> ComponentsArray;
-
 	// Get components from SimpleConstructionScript
 	if (Blueprint->SimpleConstructionScript)
 	{
@@ -678,145 +668,23 @@ TArray<TSharedPtr<FJsonValue>> UBlueprintExporterLibrary::SerializeComponents(UB
 		{
 			if (Node && Node->ComponentTemplate)
 			{
-				TSharedPtr<FJsonObject> CompObject = MakeShareable(new FJsonObject);
-
-				CompObject->SetStringField(TEXT("name"), Node->GetVariableName().ToString());
-				CompObject->SetStringField(TEXT("class"), Node->ComponentTemplate->GetClass()->GetName());
-
-				ComponentsArray.Add(MakeShareable(new FJsonValueObject(CompObject)));
+				FBlueprintComponentSnapshot& CompSnapshot = OutComponents.AddDefaulted_GetRef();
+				CompSnapshot.Name = Node->GetVariableName().ToString();
+				CompSnapshot.Class = Node->ComponentTemplate->GetClass()->GetName();
 			}
 		}
 	}
 
 	// Sort components alphabetically by name for determinism
-	ComponentsArray.Sort([](const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B) {
-		TSharedPtr<FJsonObject> ObjA = A->AsObject();
-		TSharedPtr<FJsonObject> ObjB = B->AsObject();
-		FString NameA = ObjA->GetStringField(TEXT("name"));
-		FString NameB = ObjB->GetStringField(TEXT("name"));
-		return NameA < NameB;
+	OutComponents.Sort([](const FBlueprintComponentSnapshot& A, const FBlueprintComponentSnapshot& B) {
+		return A.Name < B.Name;
 	});
-
-	return ComponentsArray;
-}
-
-TArray<TSharedPtr<FJsonValue>> UBlueprintExporterLibrary::ExtractDependencies(UBlueprint* Blueprint)
-{
-	TArray<TSharedPtr<FJsonValue>> DependenciesArray;
-	TSet<FString> UniqueDependencies;
-
-	// Helper lambda to process a single graph
-	auto ProcessGraph = [&UniqueDependencies, &DependenciesArray](UEdGraph* Graph)
-	{
-		if (!Graph) return;
-
-		for (UEdGraphNode* Node : Graph->Nodes)
-		{
-			if (!Node) continue;
-
-			// Check for function calls
-			if (UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
-			{
-				if (UClass* FunctionClass = CallNode->FunctionReference.GetMemberParentClass())
-				{
-					FString ClassPath = FunctionClass->GetPathName();
-					if (!ClassPath.IsEmpty() && !UniqueDependencies.Contains(ClassPath))
-					{
-						UniqueDependencies.Add(ClassPath);
-						DependenciesArray.Add(MakeShareable(new FJsonValueString(ClassPath)));
-					}
-				}
-			}
-
-			// Check pins for object references
-			for (UEdGraphPin* Pin : Node->Pins)
-			{
-				if (Pin && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Object)
-				{
-					if (UObject* DefaultObject = Pin->DefaultObject)
-					{
-						FString ObjectPath = DefaultObject->GetPathName();
-						if (!ObjectPath.IsEmpty() && !UniqueDependencies.Contains(ObjectPath))
-						{
-							UniqueDependencies.Add(ObjectPath);
-							DependenciesArray.Add(MakeShareable(new FJsonValueString(ObjectPath)));
-						}
-					}
-				}
-			}
-		}
-	};
-
-	// Search through all graph types
-	// 1. Event graphs (UbergraphPages)
-	for (UEdGraph* Graph : Blueprint->UbergraphPages)
-	{
-		ProcessGraph(Graph);
-	}
-
-	// 2. Function graphs
-	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
-	{
-		ProcessGraph(Graph);
-	}
-
-	// 3. Macro graphs
-	for (UEdGraph* Graph : Blueprint->MacroGraphs)
-	{
-		ProcessGraph(Graph);
-	}
-
-	// 4. Delegate signature graphs
-	for (UEdGraph* Graph : Blueprint->DelegateSignatureGraphs)
-	{
-		ProcessGraph(Graph);
-	}
-
-	// Sort dependencies alphabetically for determinism
-	DependenciesArray.Sort([](const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B) {
-		FString StrA, StrB;
-		A->TryGetString(StrA);
-		B->TryGetString(StrB);
-		return StrA < StrB;
-	});
-
-	return DependenciesArray;
 }
 
 // ============================================================================
 // Helper Functions
 // ============================================================================
 
-FString UBlueprintExporterLibrary::PinTypeToString(const FEdGraphPinType& PinType)
-{
-	FString TypeString = PinType.PinCategory.ToString();
-
-	if (PinType.PinSubCategoryObject.IsValid())
-	{
-		TypeString += TEXT("<") + PinType.PinSubCategoryObject->GetName() + TEXT(">");
-	}
-
-	if (PinType.IsArray())
-	{
-		TypeString = TEXT("Array<") + TypeString + TEXT(">");
-	}
-
-	return TypeString;
-}
-
-FString UBlueprintExporterLibrary::NodeTypeToString(UEdGraphNode* Node)
-{
-	if (!Node) return TEXT("Unknown");
-
-	if (Cast<UK2Node_Event>(Node)) return TEXT("Event");
-	if (Cast<UK2Node_FunctionEntry>(Node)) return TEXT("FunctionEntry");
-	if (Cast<UK2Node_CallFunction>(Node)) return TEXT("CallFunction");
-	if (Cast<UK2Node_VariableGet>(Node)) return TEXT("VariableGet");
-	if (Cast<UK2Node_VariableSet>(Node)) return TEXT("VariableSet");
-
-	return Node->GetClass()->GetName();
-}
-
 FString UBlueprintExporterLibrary::GetNodeCategory(UEdGraphNode* Node)
 {
 	if (UK2Node* K2Node = Cast<UK2Node>(Node))
@@ -848,187 +716,6 @@ TArray<UEdGraphNode*> UBlueprintExporterLibrary::GetConnectedNodes(UEdGraphNode*
 	return ConnectedNodes;
 }
 
-// ============================================================================
-// Knot Node Resolution
-// ============================================================================
-
-TArray<UEdGraphPin*> UBlueprintExporterLibrary::ResolveKnotChainMulti(UEdGraphPin* Pin)
-{
-	TArray<UEdGraphPin*> Results;
-
-	if (!Pin || !Pin->GetOwningNode())
-	{
-		Results.Add(Pin);
-		return Results;
-	}
-
-	UK2Node_Knot* KnotNode = Cast<UK2Node_Knot>(Pin->GetOwningNode());
-	if (!KnotNode)
-	{
-		Results.Add(Pin);
-		return Results;
-	}
-
-	UEdGraphPin* OppositePin = nullptr;
-	for (UEdGraphPin* KnotPin : KnotNode->Pins)
-	{
-		if (KnotPin && KnotPin->Direction != Pin->Direction)
-		{
-			OppositePin = KnotPin;
-			break;
-		}
-	}
-
-	if (!OppositePin || OppositePin->LinkedTo.Num() == 0)
-	{
-		return Results;
-	}
-
-	for (UEdGraphPin* LinkedPin : OppositePin->LinkedTo)
-	{
-		TArray<UEdGraphPin*> ResolvedPins = ResolveKnotChainMulti(LinkedPin);
-		Results.Append(ResolvedPins);
-	}
-
-	return Results;
-}
-
-// ============================================================================
-// Execution-Flow Ordering Helpers
-// ============================================================================
-
-bool UBlueprintExporterLibrary::IsEntryPointNode(UEdGraphNode* Node)
-{
-	if (!Node)
-	{
-		return false;
-	}
-
-	// Check if node is an Event node (most common entry points)
-	if (Cast<UK2Node_Event>(Node))
-	{
-		return true;
-	}
-
-	// Check for function entry nodes (for function graphs)
-	if (Cast<UK2Node_FunctionEntry>(Node))
-	{
-		return true;
-	}
-
-	// Additional entry point types could be added here:
-	// - UK2Node_ActorBoundEvent
-	// - UK2Node_ComponentBoundEvent
-	// - UK2Node_InputAction
-	// - UK2Node_Timeline (has its own execution flow)
-
-	return false;
-}
-
-TArray<UEdGraphPin*> UBlueprintExporterLibrary::GetSortedExecOutputPins(UEdGraphNode* Node)
-{
-	TArray<UEdGraphPin*> ExecOutputs;
-
-	if (!Node)
-	{
-		return ExecOutputs;
-	}
-
-	for (UEdGraphPin* Pin : Node->Pins)
-	{
-		if (Pin &&
-			Pin->Direction == EGPD_Output &&
-			Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
-		{
-			ExecOutputs.Add(Pin);
-		}
-	}
-
-	// Sort alphabetically for determinism
-	ExecOutputs.Sort([](const UEdGraphPin& A, const UEdGraphPin& B) {
-		return A.GetName() < B.GetName();
-	});
-
-	return ExecOutputs;
-}
-
-void UBlueprintExporterLibrary::ExportNodeRecursive(
-	UEdGraphNode* Node,
-	TSet<UEdGraphNode*>& UnexportedNodes,
-	TArray<TSharedPtr<FJsonValue>>& OrderedNodesArray)
-{
-	// Already exported or being processed?
-	if (!Node || !UnexportedNodes.Contains(Node))
-	{
-		return;
-	}
-
-	// Mark as being processed to prevent infinite recursion
-	UnexportedNodes.Remove(Node);
-
-	// === BACKTRACK: Export input dependencies first ===
-	for (UEdGraphPin* Pin : Node->Pins)
-	{
-		if (Pin && Pin->Direction == EGPD_Input)
-		{
-			// Sort linked pins for determinism
-			TArray<UEdGraphPin*> SortedLinkedPins = Pin->LinkedTo;
-			SortedLinkedPins.Sort([](const UEdGraphPin& A, const UEdGraphPin& B) {
-				if (A.GetOwningNode() != B.GetOwningNode())
-				{
-					return A.GetOwningNode()->GetName() < B.GetOwningNode()->GetName();
-				}
-				return A.GetName() < B.GetName();
-			});
-
-			for (UEdGraphPin* LinkedPin : SortedLinkedPins)
-			{
-				if (LinkedPin && LinkedPin->GetOwningNode())
-				{
-					ExportNodeRecursive(
-						LinkedPin->GetOwningNode(),
-						UnexportedNodes,
-						OrderedNodesArray
-					);
-				}
-			}
-		}
-	}
-
-	// === EXPORT: Add this node to output ===
-	OrderedNodesArray.Add(
-		MakeShareable(new FJsonValueObject(SerializeNode(Node)))
-	);
-
-	// === FORWARD: Follow exec flow ===
-	TArray<UEdGraphPin*> ExecOutputs = GetSortedExecOutputPins(Node);
-
-	for (UEdGraphPin* Pin : ExecOutputs)
-	{
-		// Sort linked pins for determinism
-		TArray<UEdGraphPin*> SortedLinkedPins = Pin->LinkedTo;
-		SortedLinkedPins.Sort([](const UEdGraphPin& A, const UEdGraphPin& B) {
-			if (A.GetOwningNode() != B.GetOwningNode())
-			{
-				return A.GetOwningNode()->GetName() < B.GetOwningNode()->GetName();
-			}
-			return A.GetName() < B.GetName();
-		});
-
-		for (UEdGraphPin* LinkedPin : SortedLinkedPins)
-		{
-			if (LinkedPin && LinkedPin->GetOwningNode())
-			{
-				ExportNodeRecursive(
-					LinkedPin->GetOwningNode(),
-					UnexportedNodes,
-					OrderedNodesArray
-				);
-			}
-		}
-	}
-}
-
 // ============================================================================
 // Python Integration Helper
 // ============================================================================
@@ -1071,7 +758,15 @@ public:
 			"    '''Export all blueprints to JSON and Markdown'''\n"
 			"    blueprint_exporter.main()\n"
 			"\n"
-			"unreal.log('Python command registered: export_blueprints()')\n"
+			"def start_auto_export():\n"
+			"    '''Re-export blueprints automatically when they are saved'''\n"
+			"    blueprint_exporter.start_auto_export()\n"
+			"\n"
+			"def stop_auto_export():\n"
+			"    '''Stop automatic re-export'''\n"
+			"    blueprint_exporter.stop_auto_export()\n"
+			"\n"
+			"unreal.log('Python commands registered: export_blueprints(), start_auto_export(), stop_auto_export()')\n"
 		), *PluginPythonDir);
 
 		IPythonScriptPlugin& PythonPlugin = FModuleManager::LoadModuleChecked<IPythonScriptPlugin>("PythonScriptPlugin");
@@ -1096,6 +791,7 @@ public:
 	{
 		UE_LOG(LogBlueprintExporter, Log, TEXT("BlueprintExporter module started"));
 
+		// Headless exports go through UBlueprintExporterCommandlet, which needs no menus or Python hooks
 		if (!IsRunningCommandlet())
 		{
 			FLevelEditorModule& LevelEditorModule = FModuleManager::LoadModuleChecked<FLevelEditorModule>("LevelEditor");
@@ -1176,8 +872,8 @@ private:
 		FString ProjectDir = FPaths::ProjectDir();
 		FString OutputDir = FPaths::Combine(ProjectDir, Settings->OutputDirectory);
 
-		// Export with pretty-printed JSON and markdown generation
-		int32 ExportedCount = UBlueprintExporterLibrary::ExportAllBlueprints(OutputDir, Settings->bPrettyPrintJson, Settings->bGenerateMarkdown);
+		// Export using every option from project settings
+		int32 ExportedCount = UBlueprintExporterLibrary::ExportAllBlueprintsWithSettings(OutputDir);
 
 		UE_LOG(LogBlueprintExporter, Log, TEXT("Export complete! Exported %d blueprints to: %s"), ExportedCount, *OutputDir);
 	}
@@ -1194,48 +890,16 @@ private:
 			return;
 		}
 
-		const UBlueprintExporterSettings* Settings = GetDefault<UBlueprintExporterSettings>();
-		FString ProjectDir = FPaths::ProjectDir();
-		FString OutputDir = FPaths::Combine(ProjectDir, Settings->OutputDirectory);
-
-		// Get blueprint path relative to /Game/
-		FString AssetPath = CurrentBlueprint->GetPathName();
-		FString BlueprintName = CurrentBlueprint->GetName();
-
-		// Remove package path prefix and .uasset extension if present
-		AssetPath.RemoveFromStart(TEXT("/Game/"));
-		int32 DotIndex;
-		if (AssetPath.FindLastChar('.', DotIndex))
-		{
-			AssetPath = AssetPath.Left(DotIndex);
-		}
-
-		// Create subdirectory structure
-		FString RelativeDir = FPaths::GetPath(AssetPath);
-		FString TargetDir = RelativeDir.IsEmpty() ? OutputDir : FPaths::Combine(OutputDir, RelativeDir);
-
-		// Ensure directory exists
-		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-		if (!PlatformFile.DirectoryExists(*TargetDir))
-		{
-			PlatformFile.CreateDirectoryTree(*TargetDir);
-		}
-
-		// Export JSON
-		FString JsonPath = FPaths::Combine(TargetDir, BlueprintName + TEXT(".json"));
-		bool bJsonSuccess = UBlueprintExporterLibrary::ExportBlueprintToFile(CurrentBlueprint, JsonPath, Settings->bPrettyPrintJson);
-
-		// Export Markdown if enabled
-		bool bMarkdownSuccess = true;
-		if (Settings->bGenerateMarkdown)
-		{
-			FString MarkdownPath = FPaths::Combine(TargetDir, BlueprintName + TEXT(".md"));
-			bMarkdownSuccess = UBlueprintExporterLibrary::ExportBlueprintToMarkdown(CurrentBlueprint, MarkdownPath);
-		}
+		// Through the batch export, so the manifest and the project, dependency and symbol indexes
+		// are updated with it. Not incremental: the editor may hold changes the saved package doesn't.
+		FBlueprintExportConfig Config = GetDefault<UBlueprintExporterSettings>()->ToExportConfig();
+		Config.bIncrementalExport = false;
 
-		if (bJsonSuccess && bMarkdownSuccess)
+		const FString BlueprintName = CurrentBlueprint->GetName();
+		const TArray<FBlueprintExportResult> Results = UBlueprintExporterLibrary::ExportBlueprintBatch({ CurrentBlueprint->GetPathName() }, Config);
+		if (Results.Num() == 1 && Results[0].Status == EBlueprintExportStatus::Exported)
 		{
-			UE_LOG(LogBlueprintExporter, Log, TEXT("Successfully exported %s to: %s"), *BlueprintName, *TargetDir);
+			UE_LOG(LogBlueprintExporter, Log, TEXT("Successfully exported %s to: %s"), *BlueprintName, *FPaths::GetPath(Results[0].OutputPath));
 		}
 		else
 		{
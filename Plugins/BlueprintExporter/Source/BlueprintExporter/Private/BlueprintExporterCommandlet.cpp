@@ -0,0 +1,285 @@
+// BlueprintExporterCommandlet.cpp
+
+#include "BlueprintExporterCommandlet.h"
+#include "BlueprintExporter.h"
+#include "BlueprintBulkExporter.h"
+#include "BlueprintDiffWriter.h"
+#include "BlueprintSnapshotDiff.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+
+UBlueprintExporterCommandlet::UBlueprintExporterCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+bool UBlueprintExporterCommandlet::ParseShard(const FString& ShardString, int32& OutIndex, int32& OutCount)
+{
+	FString IndexString;
+	FString CountString;
+	if (!ShardString.Split(TEXT("/"), &IndexString, &CountString) || !IndexString.IsNumeric() || !CountString.IsNumeric())
+	{
+		return false;
+	}
+
+	OutIndex = FCString::Atoi(*IndexString);
+	OutCount = FCString::Atoi(*CountString);
+	return OutCount > 0 && OutIndex >= 0 && OutIndex < OutCount;
+}
+
+int32 UBlueprintExporterCommandlet::GetShardIndex(FName PackageName, int32 ShardCount)
+{
+	// FName hashes differ between processes; the CRC of the string doesn't
+	return static_cast<int32>(FCrc::StrCrc32(*PackageName.ToString().ToLower()) % static_cast<uint32>(ShardCount));
+}
+
+static bool IsUnderAnyPath(const FString& PackageName, const TArray<FString>& Paths)
+{
+	for (const FString& Path : Paths)
+	{
+		const FString Prefix = Path.EndsWith(TEXT("/")) ? Path : Path + TEXT("/");
+		if (PackageName.StartsWith(Prefix) || PackageName.Equals(Path))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+int32 UBlueprintExporterCommandlet::Main(const FString& Params)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Options
+	FBlueprintExportConfig Config = GetDefault<UBlueprintExporterSettings>()->ToExportConfig();
+
+	FString OutputDirectory = Config.OutputDirectory;
+	FParse::Value(*Params, TEXT("Output="), OutputDirectory);
+	if (FPaths::IsRelative(OutputDirectory))
+	{
+		OutputDirectory = FPaths::Combine(FPaths::ProjectDir(), OutputDirectory);
+	}
+	FPaths::NormalizeDirectoryName(OutputDirectory);
+
+	int32 ShardIndex = 0;
+	int32 ShardCount = 1;
+	FString ShardString;
+	if (FParse::Value(*Params, TEXT("Shard="), ShardString) && !ParseShard(ShardString, ShardIndex, ShardCount))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Invalid -Shard=%s, expected i/N with 0 <= i < N"), *ShardString);
+		return 2;
+	}
+
+	TArray<FString> IncludePaths;
+	TArray<FString> ExcludePaths;
+	FString PathList;
+	if (FParse::Value(*Params, TEXT("Filter="), PathList, false))
+	{
+		PathList.ParseIntoArray(IncludePaths, TEXT(","));
+	}
+	if (FParse::Value(*Params, TEXT("Exclude="), PathList, false))
+	{
+		PathList.ParseIntoArray(ExcludePaths, TEXT(","));
+	}
+
+	if (FParse::Param(*Params, TEXT("Full")))
+	{
+		Config.bIncrementalExport = false;
+	}
+	if (FParse::Param(*Params, TEXT("Markdown")))
+	{
+		Config.bGenerateMarkdown = true;
+	}
+	if (FParse::Param(*Params, TEXT("NoMarkdown")))
+	{
+		Config.bGenerateMarkdown = false;
+	}
+	if (FParse::Param(*Params, TEXT("Pretty")))
+	{
+		Config.bPrettyPrintJson = true;
+	}
+	if (FParse::Param(*Params, TEXT("Compact")))
+	{
+		Config.bPrettyPrintJson = false;
+	}
+	if (FParse::Param(*Params, TEXT("CompactSchema")))
+	{
+		Config.bCompactSchema = true;
+	}
+	FString FormatString;
+	if (FParse::Value(*Params, TEXT("Format="), FormatString))
+	{
+		if (FormatString.Equals(TEXT("Json")))
+		{
+			Config.Format = EBlueprintExportFormat::Json;
+		}
+		else if (FormatString.Equals(TEXT("MessagePack")) || FormatString.Equals(TEXT("MsgPack")))
+		{
+			Config.Format = EBlueprintExportFormat::MessagePack;
+		}
+		else
+		{
+			UE_LOG(LogBlueprintExporter, Error, TEXT("Invalid -Format=%s, expected Json or MessagePack"), *FormatString);
+			return 2;
+		}
+	}
+	if (FParse::Param(*Params, TEXT("Bundle")))
+	{
+		Config.bBundleExport = true;
+	}
+	if (FParse::Param(*Params, TEXT("CompressBundle")))
+	{
+		Config.bBundleExport = true;
+		Config.bCompressBundleRecords = true;
+	}
+	FParse::Value(*Params, TEXT("MemoryBudgetMB="), Config.MemoryBudgetMB);
+
+	FString DiffAgainst;
+	if (FParse::Value(*Params, TEXT("DiffAgainst="), DiffAgainst) && FPaths::IsRelative(DiffAgainst))
+	{
+		DiffAgainst = FPaths::Combine(FPaths::ProjectDir(), DiffAgainst);
+	}
+
+	const bool bSharded = ShardCount > 1;
+	if (!DiffAgainst.IsEmpty() && (bSharded || Config.bBundleExport || Config.Format != EBlueprintExportFormat::Json))
+	{
+		// A shard only has part of the export, and only per-blueprint JSON files are read back
+		UE_LOG(LogBlueprintExporter, Error, TEXT("-DiffAgainst needs an unsharded export of JSON files, without -Shard, -Bundle or -Format=MessagePack"));
+		return 2;
+	}
+	const FString ShardSuffix = FBlueprintBulkExporter::MakeShardSuffix(ShardIndex, ShardCount);
+
+	FString SummaryPath = FPaths::Combine(OutputDirectory, FString::Printf(TEXT("export_summary%s.json"), *ShardSuffix));
+	FParse::Value(*Params, TEXT("Summary="), SummaryPath);
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.DirectoryExists(*OutputDirectory) && !PlatformFile.CreateDirectoryTree(*OutputDirectory))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to create output directory: %s"), *OutputDirectory);
+		return 2;
+	}
+
+	// Commandlets don't scan the project by default
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	TArray<FAssetData> AllAssets;
+	FBlueprintBulkExporter::GatherBlueprintAssets(AllAssets);
+
+	// Every shard sees the whole project, so only deleted blueprints are treated as stale
+	TSet<FName> ProjectPackageNames;
+	TArray<FAssetData> Assets;
+	for (const FAssetData& AssetData : AllAssets)
+	{
+		ProjectPackageNames.Add(AssetData.PackageName);
+
+		const FString PackageName = AssetData.PackageName.ToString();
+		if (IncludePaths.Num() > 0 && !IsUnderAnyPath(PackageName, IncludePaths))
+		{
+			continue;
+		}
+		if (IsUnderAnyPath(PackageName, ExcludePaths))
+		{
+			continue;
+		}
+		if (bSharded && GetShardIndex(AssetData.PackageName, ShardCount) != ShardIndex)
+		{
+			continue;
+		}
+
+		Assets.Add(AssetData);
+	}
+
+	// Same order on every machine, whatever order the registry returned
+	Assets.Sort([](const FAssetData& A, const FAssetData& B)
+	{
+		return A.PackageName.LexicalLess(B.PackageName);
+	});
+
+	UE_LOG(LogBlueprintExporter, Display, TEXT("Exporting %d of %d blueprints (shard %d/%d) to %s"),
+		Assets.Num(), AllAssets.Num(), ShardIndex, ShardCount, *OutputDirectory);
+
+	FBlueprintBulkExporter Exporter(OutputDirectory, Config);
+	Exporter.SetProjectPackageNames(MoveTemp(ProjectPackageNames));
+	Exporter.SetShard(ShardIndex, ShardCount);
+	Exporter.Run(Assets);
+
+	FString DiffFileName;
+	if (!DiffAgainst.IsEmpty())
+	{
+		FBlueprintExportDiff Diff;
+		if (FBlueprintSnapshotDiff::DiffDirectories(DiffAgainst, OutputDirectory, Diff))
+		{
+			const FString DiffPath = FPaths::Combine(OutputDirectory, TEXT("export_diff.json"));
+			const FString DiffMarkdownPath = FPaths::Combine(OutputDirectory, TEXT("export_diff.md"));
+			if (FFileHelper::SaveStringToFile(FBlueprintDiffWriter::ToJson(Diff), *DiffPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+				&& FFileHelper::SaveStringToFile(FBlueprintDiffWriter::ToMarkdown(Diff), *DiffMarkdownPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+			{
+				DiffFileName = FPaths::GetCleanFilename(DiffPath);
+			}
+			else
+			{
+				UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to save export diff: %s"), *DiffPath);
+			}
+			UE_LOG(LogBlueprintExporter, Display, TEXT("%d blueprints differ from %s, %d unchanged"), Diff.Blueprints.Num(), *DiffAgainst, Diff.UnchangedCount);
+		}
+	}
+
+	const double DurationSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Machine-readable summary
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("format_version"), BlueprintExporterFormatVersion);
+	Writer->WriteValue(TEXT("output_directory"), OutputDirectory);
+	Writer->WriteValue(TEXT("shard_index"), ShardIndex);
+	Writer->WriteValue(TEXT("shard_count"), ShardCount);
+	Writer->WriteValue(TEXT("project_blueprints"), AllAssets.Num());
+	Writer->WriteValue(TEXT("selected_blueprints"), Assets.Num());
+	Writer->WriteValue(TEXT("exported"), Exporter.GetExportedCount());
+	Writer->WriteValue(TEXT("unchanged"), Exporter.GetSkippedCount());
+	Writer->WriteValue(TEXT("content_unchanged"), Exporter.GetContentUnchangedCount());
+	Writer->WriteValue(TEXT("removed"), Exporter.GetRemovedCount());
+	Writer->WriteValue(TEXT("failed"), Exporter.GetFailedCount());
+	Writer->WriteValue(TEXT("files_written"), Exporter.GetWrittenFileCount());
+	Writer->WriteValue(TEXT("files_unchanged"), Exporter.GetUnchangedFileCount());
+	Writer->WriteValue(TEXT("duration_seconds"), DurationSeconds);
+	Writer->WriteValue(TEXT("peak_memory_mb"), static_cast<int64>(Exporter.GetPeakUsedPhysical() / (1024 * 1024)));
+	Writer->WriteValue(TEXT("profile_file"), Exporter.GetProfileFileName());
+	if (Config.bBundleExport)
+	{
+		Writer->WriteValue(TEXT("bundle_file"), Exporter.GetBundleFileName());
+	}
+	if (!DiffFileName.IsEmpty())
+	{
+		Writer->WriteValue(TEXT("diff_file"), DiffFileName);
+	}
+	Writer->WriteArrayStart(TEXT("failed_packages"));
+	for (const FName& PackageName : Exporter.GetFailedPackageNames())
+	{
+		Writer->WriteValue(PackageName.ToString());
+	}
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	if (!FFileHelper::SaveStringToFile(JsonString, *SummaryPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to save export summary: %s"), *SummaryPath);
+		return 1;
+	}
+
+	UE_LOG(LogBlueprintExporter, Display, TEXT("Export summary written to: %s"), *SummaryPath);
+	return Exporter.GetFailedCount() > 0 ? 1 : 0;
+}
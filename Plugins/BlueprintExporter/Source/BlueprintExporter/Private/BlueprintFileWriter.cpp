@@ -0,0 +1,123 @@
+// BlueprintFileWriter.cpp
+
+#include "BlueprintFileWriter.h"
+#include "BlueprintExporter.h"
+#include "BlueprintExportProfile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+// Chunk size when comparing two files on disk
+static constexpr int64 CompareChunkSize = 64 * 1024;
+
+static bool FileHasContent(const FString& FilePath, TArrayView<const uint8> Bytes)
+{
+	if (IFileManager::Get().FileSize(*FilePath) != Bytes.Num())
+	{
+		return false;
+	}
+
+	TArray64<uint8> Existing;
+	return FFileHelper::LoadFileToArray(Existing, *FilePath, FILEREAD_Silent)
+		&& Existing.Num() == Bytes.Num()
+		&& FMemory::Memcmp(Existing.GetData(), Bytes.GetData(), Bytes.Num()) == 0;
+}
+
+static bool FilesHaveSameContent(const FString& PathA, const FString& PathB)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const int64 Size = PlatformFile.FileSize(*PathA);
+	if (Size < 0 || Size != PlatformFile.FileSize(*PathB))
+	{
+		return false;
+	}
+
+	TUniquePtr<IFileHandle> FileA(PlatformFile.OpenRead(*PathA));
+	TUniquePtr<IFileHandle> FileB(PlatformFile.OpenRead(*PathB));
+	if (!FileA.IsValid() || !FileB.IsValid())
+	{
+		return false;
+	}
+
+	TArray<uint8> ChunkA;
+	TArray<uint8> ChunkB;
+	ChunkA.SetNumUninitialized(static_cast<int32>(FMath::Min(Size, CompareChunkSize)));
+	ChunkB.SetNumUninitialized(ChunkA.Num());
+
+	for (int64 Offset = 0; Offset < Size; Offset += CompareChunkSize)
+	{
+		const int64 Length = FMath::Min(Size - Offset, CompareChunkSize);
+		if (!FileA->Read(ChunkA.GetData(), Length) || !FileB->Read(ChunkB.GetData(), Length)
+			|| FMemory::Memcmp(ChunkA.GetData(), ChunkB.GetData(), Length) != 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+EBlueprintFileWriteResult FBlueprintFileWriter::WriteIfChanged(const FString& FilePath, TArrayView<const uint8> Bytes)
+{
+	BLUEPRINT_EXPORT_PHASE_SCOPE(WriteFile);
+	FBlueprintExportProfile::AddBytes(EBlueprintExportPhase::WriteFile, Bytes.Num());
+
+	if (FileHasContent(FilePath, Bytes))
+	{
+		return EBlueprintFileWriteResult::Unchanged;
+	}
+
+	const FString TempPath = GetTempPath(FilePath);
+	IFileManager& FileManager = IFileManager::Get();
+
+	bool bSaved = false;
+	{
+		TUniquePtr<FArchive> Writer(FileManager.CreateFileWriter(*TempPath));
+		if (Writer.IsValid())
+		{
+			Writer->Serialize(const_cast<uint8*>(Bytes.GetData()), Bytes.Num());
+			bSaved = Writer->Close();
+		}
+	}
+
+	if (!bSaved || !FileManager.Move(*FilePath, *TempPath, true, true))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to write file: %s"), *FilePath);
+		FileManager.Delete(*TempPath, false, true, true);
+		return EBlueprintFileWriteResult::Failed;
+	}
+
+	return EBlueprintFileWriteResult::Written;
+}
+
+EBlueprintFileWriteResult FBlueprintFileWriter::WriteIfChanged(const FString& FilePath, FStringView Text, int64* OutBytes)
+{
+	const FTCHARToUTF8 Utf8(Text.GetData(), Text.Len());
+	if (OutBytes)
+	{
+		*OutBytes = Utf8.Length();
+	}
+	return WriteIfChanged(FilePath, TArrayView<const uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()));
+}
+
+EBlueprintFileWriteResult FBlueprintFileWriter::ReplaceIfChanged(const FString& FilePath, const FString& TempPath)
+{
+	BLUEPRINT_EXPORT_PHASE_SCOPE(WriteFile);
+
+	IFileManager& FileManager = IFileManager::Get();
+
+	if (FilesHaveSameContent(FilePath, TempPath))
+	{
+		FileManager.Delete(*TempPath, false, true, true);
+		return EBlueprintFileWriteResult::Unchanged;
+	}
+
+	if (!FileManager.Move(*FilePath, *TempPath, true, true))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to replace file: %s"), *FilePath);
+		FileManager.Delete(*TempPath, false, true, true);
+		return EBlueprintFileWriteResult::Failed;
+	}
+
+	return EBlueprintFileWriteResult::Written;
+}
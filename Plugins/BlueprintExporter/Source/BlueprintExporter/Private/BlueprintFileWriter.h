@@ -0,0 +1,47 @@
+// BlueprintFileWriter.h
+// Output files that are only replaced when their content changes
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EBlueprintFileWriteResult : uint8
+{
+	Written,
+	/** The file already held exactly this content and was left untouched */
+	Unchanged,
+	Failed
+};
+
+/**
+ * Writes output files without touching the ones whose content is already on disk
+ *
+ * Re-exporting a project rewrites thousands of files that mostly come out identical;
+ * leaving those alone keeps their timestamps, so file watchers, source control
+ * status and downstream indexers only see the files that really changed. A file
+ * whose size differs is known to differ from a stat alone; only same-size files are
+ * read back and compared.
+ *
+ * New content goes to <File>.tmp first and is renamed over the file, so readers
+ * never see a partially written one. Safe to call from worker threads for distinct files.
+ */
+struct FBlueprintFileWriter
+{
+	/** Write Bytes to FilePath unless it already holds them */
+	static EBlueprintFileWriteResult WriteIfChanged(const FString& FilePath, TArrayView<const uint8> Bytes);
+
+	/**
+	 * Write Text as UTF-8 (no byte order mark) unless FilePath already holds it
+	 * @param OutBytes - If set, receives the size of the encoded text, the file's size unless the write failed
+	 */
+	static EBlueprintFileWriteResult WriteIfChanged(const FString& FilePath, FStringView Text, int64* OutBytes = nullptr);
+
+	/**
+	 * Rename a finished temporary file over FilePath, or delete it if FilePath already
+	 * has the same content (for files streamed to disk rather than built in memory)
+	 */
+	static EBlueprintFileWriteResult ReplaceIfChanged(const FString& FilePath, const FString& TempPath);
+
+	/** Where new content is written before the rename */
+	static FString GetTempPath(const FString& FilePath) { return FilePath + TEXT(".tmp"); }
+};
@@ -0,0 +1,244 @@
+// BlueprintGraphAdapter.cpp
+
+#include "BlueprintGraphAdapter.h"
+#include "BlueprintExportProfile.h"
+#include "BlueprintPinTypeNames.h"
+#include "GraphCore/BlueprintGraphDependencies.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_ConstructObjectFromClass.h"
+#include "K2Node_Event.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_Knot.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+
+/** Blueprint classes by their generated class, never the skeleton (SKEL_) class */
+static std::string GetClassPath(UClass* Class)
+{
+	return Class ? FBlueprintGraphAdapter::ToUtf8(Class->GetAuthoritativeClass()->GetPathName()) : std::string();
+}
+
+std::string FBlueprintGraphAdapter::ToUtf8(const FString& String)
+{
+	const FTCHARToUTF8 Utf8(*String, String.Len());
+	return std::string(Utf8.Get(), Utf8.Length());
+}
+
+FString FBlueprintGraphAdapter::FromUtf8(const std::string& String)
+{
+	const FUTF8ToTCHAR Text(String.data(), static_cast<int32>(String.size()));
+	return FString(Text.Length(), Text.Get());
+}
+
+void FBlueprintGraphAdapter::FillGraph(const UEdGraph* Graph, FBlueprintPinTypeNames& TypeNames, BlueprintGraph::FGraph& OutGraph, EFill Fill)
+{
+	OutGraph = BlueprintGraph::FGraph();
+	if (!Graph)
+	{
+		return;
+	}
+
+	const bool bFull = Fill == EFill::Full;
+	OutGraph.Name = ToUtf8(Graph->GetName());
+	OutGraph.Nodes.reserve(Graph->Nodes.Num());
+
+	// Pin -> reference, so links can be filled once every pin has one
+	TMap<const UEdGraphPin*, BlueprintGraph::FPinRef> PinRefs;
+
+	// Titles are timed per graph: a phase scope per node costs more than most titles
+	uint64 TitleCycles = 0;
+
+	for (const UEdGraphNode* Node : Graph->Nodes)
+	{
+		if (!Node)
+		{
+			continue;
+		}
+
+		const int32 NodeIndex = static_cast<int32>(OutGraph.Nodes.size());
+		BlueprintGraph::FNode& ModelNode = OutGraph.Nodes.emplace_back();
+		FillNode(Node, ModelNode, Fill, TitleCycles);
+
+		ModelNode.Pins.reserve(bFull ? Node->Pins.Num() : 0);
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			if (!Pin)
+			{
+				continue;
+			}
+
+			const bool bIsObject = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Object;
+			if (!bFull && !(bIsObject && Pin->DefaultObject))
+			{
+				continue;
+			}
+
+			if (bFull)
+			{
+				PinRefs.Add(Pin, { NodeIndex, static_cast<int32>(ModelNode.Pins.size()) });
+			}
+
+			BlueprintGraph::FPin& ModelPin = ModelNode.Pins.emplace_back();
+			if (bIsObject && Pin->DefaultObject)
+			{
+				ModelPin.DefaultObject = ToUtf8(Pin->DefaultObject->GetPathName());
+			}
+			if (!bFull)
+			{
+				continue;
+			}
+
+			ModelPin.Name = ToUtf8(Pin->GetName());
+			ModelPin.bIsInput = Pin->Direction == EGPD_Input;
+			ModelPin.bIsExec = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+			ModelPin.bIsDelegate = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Delegate;
+			ModelPin.Type = TypeNames.GetUtf8(Pin->PinType);
+			ModelPin.DefaultValue = ToUtf8(Pin->DefaultValue);
+		}
+	}
+
+	if (!bFull)
+	{
+		return;
+	}
+	FBlueprintExportProfile::AddTime(EBlueprintExportPhase::NodeTitle, TitleCycles);
+
+	// Links, in the editor's order
+	for (const TPair<const UEdGraphPin*, BlueprintGraph::FPinRef>& Pair : PinRefs)
+	{
+		std::vector<BlueprintGraph::FPinRef>& Links = OutGraph.Nodes[Pair.Value.Node].Pins[Pair.Value.Pin].Links;
+		Links.reserve(Pair.Key->LinkedTo.Num());
+		for (const UEdGraphPin* LinkedPin : Pair.Key->LinkedTo)
+		{
+			if (const BlueprintGraph::FPinRef* LinkedRef = PinRefs.Find(LinkedPin))
+			{
+				Links.push_back(*LinkedRef);
+			}
+		}
+	}
+}
+
+void FBlueprintGraphAdapter::FillNode(const UEdGraphNode* Node, BlueprintGraph::FNode& OutNode, EFill Fill, uint64& TitleCycles)
+{
+	const bool bFull = Fill == EFill::Full;
+
+	// Members referenced through self resolve against the blueprint's own class
+	auto FillMember = [&OutNode](const UK2Node* K2Node, const FMemberReference& Reference)
+	{
+		if (!Reference.GetMemberName().IsNone())
+		{
+			OutNode.MemberName = ToUtf8(Reference.GetMemberName().ToString());
+			OutNode.MemberClass = GetClassPath(Reference.GetMemberParentClass(K2Node->GetBlueprintClassFromNode()));
+		}
+	};
+
+	if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+	{
+		OutNode.Kind = BlueprintGraph::ENodeKind::CallFunction;
+		if (UClass* FunctionClass = CallNode->FunctionReference.GetMemberParentClass())
+		{
+			OutNode.FunctionClass = ToUtf8(FunctionClass->GetPathName());
+		}
+		if (bFull)
+		{
+			FillMember(CallNode, CallNode->FunctionReference);
+		}
+	}
+
+	if (!bFull)
+	{
+		return;
+	}
+
+	OutNode.Name = ToUtf8(Node->GetName());
+	const uint64 TitleStartCycles = FPlatformTime::Cycles64();
+	OutNode.Title = ToUtf8(Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
+	TitleCycles += FPlatformTime::Cycles64() - TitleStartCycles;
+	OutNode.bIsKnot = Cast<UK2Node_Knot>(Node) != nullptr;
+	OutNode.bIsEntryPoint = IsEntryPointNode(Node);
+
+	if (OutNode.Kind == BlueprintGraph::ENodeKind::CallFunction)
+	{
+		return;
+	}
+
+	if (Cast<UK2Node_Event>(Node))
+	{
+		OutNode.Kind = BlueprintGraph::ENodeKind::Event;
+	}
+	else if (Cast<UK2Node_FunctionEntry>(Node))
+	{
+		OutNode.Kind = BlueprintGraph::ENodeKind::FunctionEntry;
+	}
+	else if (const UK2Node_VariableGet* GetNode = Cast<UK2Node_VariableGet>(Node))
+	{
+		OutNode.Kind = BlueprintGraph::ENodeKind::VariableGet;
+		FillMember(GetNode, GetNode->VariableReference);
+	}
+	else if (const UK2Node_VariableSet* SetNode = Cast<UK2Node_VariableSet>(Node))
+	{
+		OutNode.Kind = BlueprintGraph::ENodeKind::VariableSet;
+		FillMember(SetNode, SetNode->VariableReference);
+	}
+	else
+	{
+		// Spawn Actor, Construct Object, Create Widget... keep their class as the type
+		if (const UK2Node_ConstructObjectFromClass* ConstructNode = Cast<UK2Node_ConstructObjectFromClass>(Node))
+		{
+			OutNode.Kind = BlueprintGraph::ENodeKind::Construct;
+			OutNode.MemberClass = GetClassPath(ConstructNode->GetClassToSpawn());
+		}
+		OutNode.ClassName = ToUtf8(Node->GetClass()->GetName());
+	}
+}
+
+bool FBlueprintGraphAdapter::IsEntryPointNode(const UEdGraphNode* Node)
+{
+	if (!Node)
+	{
+		return false;
+	}
+
+	// Check if node is an Event node (most common entry points)
+	if (Cast<UK2Node_Event>(Node))
+	{
+		return true;
+	}
+
+	// Check for function entry nodes (for function graphs)
+	if (Cast<UK2Node_FunctionEntry>(Node))
+	{
+		return true;
+	}
+
+	// Additional entry point types could be added here:
+	// - UK2Node_ActorBoundEvent
+	// - UK2Node_ComponentBoundEvent
+	// - UK2Node_InputAction
+	// - UK2Node_Timeline (has its own execution flow)
+
+	return false;
+}
+
+TArray<FString> FBlueprintGraphAdapter::GetDependencies(const std::vector<BlueprintGraph::FGraph>& Graphs)
+{
+	std::vector<std::string> Dependencies;
+	for (const BlueprintGraph::FGraph& Graph : Graphs)
+	{
+		BlueprintGraph::CollectDependencies(Graph, Dependencies);
+	}
+
+	// Sorted for determinism
+	BlueprintGraph::SortAndDeduplicate(Dependencies);
+
+	TArray<FString> DependenciesArray;
+	DependenciesArray.Reserve(static_cast<int32>(Dependencies.size()));
+	for (const std::string& Dependency : Dependencies)
+	{
+		DependenciesArray.Add(FromUtf8(Dependency));
+	}
+	return DependenciesArray;
+}
@@ -0,0 +1,51 @@
+// BlueprintGraphAdapter.h
+// Fills the engine-independent graph model (GraphCore/) from editor graphs
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GraphCore/BlueprintGraphModel.h"
+
+class UEdGraph;
+class UEdGraphNode;
+class FBlueprintPinTypeNames;
+
+/**
+ * The only place the graph algorithms meet UEdGraph
+ *
+ * Everything the capture needs from a graph (names, titles, pin types and defaults,
+ * links, and what each node is) is read here, once per graph, into a
+ * BlueprintGraph::FGraph. Knot collapsing, ordering, dependencies and the node
+ * type/symbol strings then run on the model, in code that builds and is tested
+ * without the engine (see Tools/GraphCore). Game thread only, like the rest of the capture.
+ */
+class FBlueprintGraphAdapter
+{
+public:
+	enum class EFill : uint8
+	{
+		/** Everything the export needs */
+		Full,
+		/** Only what dependency collection reads: node kinds, called classes and default objects */
+		DependenciesOnly
+	};
+
+	/**
+	 * Fill OutGraph from Graph
+	 * Links to pins outside the graph are dropped; the editor never makes them.
+	 */
+	static void FillGraph(const UEdGraph* Graph, FBlueprintPinTypeNames& TypeNames, BlueprintGraph::FGraph& OutGraph, EFill Fill = EFill::Full);
+
+	/** Events and function entries, where execution starts */
+	static bool IsEntryPointNode(const UEdGraphNode* Node);
+
+	/** Asset and class paths the graphs depend on, sorted and without duplicates (a snapshot's Dependencies) */
+	static TArray<FString> GetDependencies(const std::vector<BlueprintGraph::FGraph>& Graphs);
+
+	static std::string ToUtf8(const FString& String);
+	static FString FromUtf8(const std::string& String);
+
+private:
+	/** Adds the time GetNodeTitle took to TitleCycles, for the graph's NodeTitle phase */
+	static void FillNode(const UEdGraphNode* Node, BlueprintGraph::FNode& OutNode, EFill Fill, uint64& TitleCycles);
+};
@@ -0,0 +1,324 @@
+// BlueprintJsonWriter.h
+// Streams a blueprint snapshot straight into a TJsonWriter, without building an FJsonObject tree
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintExportTypes.h"
+#include "BlueprintExportPipeline.h"
+#include "BlueprintSnapshotHash.h"
+#include "BlueprintStringTable.h"
+#include "Serialization/JsonWriter.h"
+
+/**
+ * Field order and optional-field rules here define the JSON schema (see JSON-SCHEMA.md).
+ * Output is byte-identical to serializing the equivalent FJsonObject with FJsonSerializer.
+ *
+ * WriterType is a TJsonWriter, or any writer with the same Write* calls
+ * (FBlueprintMsgPackWriter), so every format carries exactly the same schema.
+ */
+template <class WriterType>
+class TBlueprintSchemaWriter
+{
+public:
+	using FWriter = WriterType;
+
+	static void WriteBlueprint(FWriter& Writer, const FBlueprintSnapshot& Snapshot, const FBlueprintJsonOptions& Options = FBlueprintJsonOptions())
+	{
+		Writer.WriteObjectStart();
+
+		// Schema 1 has no version field; its layout is unchanged, but like every schema it carries the hashes
+		const bool bGraphsById = Options.bFunctionGraphsById || Options.bCompactSchema;
+		if (Options.bCompactSchema)
+		{
+			Writer.WriteValue(TEXT("schema_version"), 3);
+		}
+		else if (Options.bFunctionGraphsById)
+		{
+			Writer.WriteValue(TEXT("schema_version"), 2);
+		}
+
+		// Basic info
+		Writer.WriteValue(TEXT("name"), Snapshot.Name);
+		Writer.WriteValue(TEXT("path"), Snapshot.Path);
+		Writer.WriteValue(TEXT("class_type"), TEXT("Blueprint"));
+
+		if (!Snapshot.ParentClass.IsEmpty())
+		{
+			Writer.WriteValue(TEXT("parent_class"), Snapshot.ParentClass);
+		}
+
+		if (!Snapshot.GeneratedClass.IsEmpty())
+		{
+			Writer.WriteValue(TEXT("generated_class"), Snapshot.GeneratedClass);
+		}
+
+		Writer.WriteValue(TEXT("hash"), FBlueprintSnapshotHash::ToString(Snapshot.Hash));
+
+		// Graphs (event graphs and function graphs)
+		if (Options.bCompactSchema)
+		{
+			WriteCompactGraphs(Writer, Snapshot);
+		}
+		else
+		{
+			Writer.WriteArrayStart(TEXT("graphs"));
+			for (const FBlueprintGraphSnapshot& Graph : Snapshot.Graphs)
+			{
+				Writer.WriteObjectStart();
+				if (bGraphsById)
+				{
+					// Graph names are object names, unique within the blueprint
+					Writer.WriteValue(TEXT("id"), Graph.Name);
+				}
+				WriteGraphFields(Writer, Graph);
+				Writer.WriteObjectEnd();
+			}
+			Writer.WriteArrayEnd();
+		}
+
+		// Variables
+		Writer.WriteArrayStart(TEXT("variables"));
+		for (const FBlueprintVariableSnapshot& Variable : Snapshot.Variables)
+		{
+			Writer.WriteObjectStart();
+			Writer.WriteValue(TEXT("name"), Variable.Name);
+			Writer.WriteValue(TEXT("type"), Variable.Type);
+			Writer.WriteValue(TEXT("category"), Variable.Category);
+			Writer.WriteValue(TEXT("is_exposed"), Variable.bIsExposed);
+			if (!Variable.DefaultValue.IsEmpty())
+			{
+				Writer.WriteValue(TEXT("default_value"), Variable.DefaultValue);
+			}
+			Writer.WriteObjectEnd();
+		}
+		Writer.WriteArrayEnd();
+
+		// Functions
+		Writer.WriteArrayStart(TEXT("functions"));
+		for (const FBlueprintFunctionSnapshot& Function : Snapshot.Functions)
+		{
+			Writer.WriteObjectStart();
+			Writer.WriteValue(TEXT("name"), Function.Name);
+
+			Writer.WriteArrayStart(TEXT("parameters"));
+			for (const FBlueprintParameterSnapshot& Param : Function.Parameters)
+			{
+				Writer.WriteObjectStart();
+				Writer.WriteValue(TEXT("name"), Param.Name);
+				Writer.WriteValue(TEXT("type"), Param.Type);
+				Writer.WriteObjectEnd();
+			}
+			Writer.WriteArrayEnd();
+
+			if (const FBlueprintGraphSnapshot* FunctionGraph = Snapshot.GetFunctionGraph(Function))
+			{
+				if (bGraphsById)
+				{
+					Writer.WriteValue(TEXT("graph_id"), FunctionGraph->Name);
+				}
+				else
+				{
+					Writer.WriteObjectStart(TEXT("graph"));
+					WriteGraphFields(Writer, *FunctionGraph);
+					Writer.WriteObjectEnd();
+				}
+			}
+
+			Writer.WriteObjectEnd();
+		}
+		Writer.WriteArrayEnd();
+
+		// Components
+		Writer.WriteArrayStart(TEXT("components"));
+		for (const FBlueprintComponentSnapshot& Component : Snapshot.Components)
+		{
+			Writer.WriteObjectStart();
+			Writer.WriteValue(TEXT("name"), Component.Name);
+			Writer.WriteValue(TEXT("class"), Component.Class);
+			Writer.WriteObjectEnd();
+		}
+		Writer.WriteArrayEnd();
+
+		// Dependencies
+		Writer.WriteArrayStart(TEXT("dependencies"));
+		for (const FString& Dependency : Snapshot.Dependencies)
+		{
+			Writer.WriteValue(Dependency);
+		}
+		Writer.WriteArrayEnd();
+
+		Writer.WriteObjectEnd();
+	}
+
+private:
+	// Node id -> position in its graph
+	using FNodeIndices = TMap<FString, int32, FDefaultSetAllocator, TCaseSensitiveStringKeyFuncs<int32>>;
+
+	/** Schema 3: "strings", then "graphs" whose nodes and pins refer to them by index */
+	static void WriteCompactGraphs(FWriter& Writer, const FBlueprintSnapshot& Snapshot)
+	{
+		const FBlueprintStringTable Strings(Snapshot);
+
+		Writer.WriteArrayStart(TEXT("strings"));
+		for (const FString& String : Strings.GetStrings())
+		{
+			Writer.WriteValue(String);
+		}
+		Writer.WriteArrayEnd();
+
+		Writer.WriteArrayStart(TEXT("graphs"));
+		for (const FBlueprintGraphSnapshot& Graph : Snapshot.Graphs)
+		{
+			FNodeIndices NodeIndices;
+			NodeIndices.Reserve(Graph.Nodes.Num());
+			for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); ++NodeIndex)
+			{
+				NodeIndices.Add(Graph.Nodes[NodeIndex].Id, NodeIndex);
+			}
+
+			Writer.WriteObjectStart();
+			Writer.WriteValue(TEXT("id"), Graph.Name);
+			Writer.WriteValue(TEXT("name"), Graph.Name);
+			Writer.WriteValue(TEXT("hash"), FBlueprintSnapshotHash::ToString(Graph.Hash));
+
+			Writer.WriteArrayStart(TEXT("nodes"));
+			for (const FBlueprintNodeSnapshot& Node : Graph.Nodes)
+			{
+				// [id, type, title, pins, hash]
+				Writer.WriteArrayStart();
+				Writer.WriteValue(Strings.IndexOf(Node.Id));
+				Writer.WriteValue(Strings.IndexOf(Node.Type));
+				Writer.WriteValue(Strings.IndexOf(Node.Title));
+
+				Writer.WriteArrayStart();
+				for (const FBlueprintPinSnapshot& Pin : Node.Pins)
+				{
+					WriteCompactPin(Writer, Pin, Graph, NodeIndices, Strings);
+				}
+				Writer.WriteArrayEnd();
+
+				// Unique per node, so not worth a string table entry
+				Writer.WriteValue(FBlueprintSnapshotHash::ToString(Node.Hash));
+
+				Writer.WriteArrayEnd();
+			}
+			Writer.WriteArrayEnd();
+
+			Writer.WriteObjectEnd();
+		}
+		Writer.WriteArrayEnd();
+	}
+
+	/** [name, direction (0 = input, 1 = output), type, default?, to?]; trailing absent fields are left out */
+	static void WriteCompactPin(FWriter& Writer, const FBlueprintPinSnapshot& Pin, const FBlueprintGraphSnapshot& Graph,
+		const FNodeIndices& NodeIndices, const FBlueprintStringTable& Strings)
+	{
+		Writer.WriteArrayStart();
+		Writer.WriteValue(Strings.IndexOf(Pin.Name));
+		Writer.WriteValue(Pin.bIsInput ? 0 : 1);
+		Writer.WriteValue(Strings.IndexOf(Pin.Type));
+
+		if (!Pin.DefaultValue.IsEmpty() || Pin.bHasLinks)
+		{
+			// 0 is the empty string: no default value
+			Writer.WriteValue(Strings.IndexOf(Pin.DefaultValue));
+		}
+
+		if (Pin.bHasLinks)
+		{
+			// Flat [node, pin, node, pin, ...] of indices into the graph's nodes and that node's pins.
+			// A link that can't be resolved in this graph is written as [-1 - node name, pin name] string indices.
+			Writer.WriteArrayStart();
+			for (const FBlueprintConnectionSnapshot& Connection : Pin.Connections)
+			{
+				int32 PinIndex = INDEX_NONE;
+				const int32* NodeIndex = NodeIndices.Find(Connection.Node);
+				if (NodeIndex)
+				{
+					PinIndex = Graph.Nodes[*NodeIndex].Pins.IndexOfByPredicate([&Connection](const FBlueprintPinSnapshot& TargetPin)
+					{
+						return TargetPin.Name.Equals(Connection.Pin, ESearchCase::CaseSensitive);
+					});
+				}
+
+				if (PinIndex != INDEX_NONE)
+				{
+					Writer.WriteValue(*NodeIndex);
+					Writer.WriteValue(PinIndex);
+				}
+				else
+				{
+					Writer.WriteValue(-1 - Strings.IndexOf(Connection.Node));
+					Writer.WriteValue(Strings.IndexOf(Connection.Pin));
+				}
+			}
+			Writer.WriteArrayEnd();
+		}
+
+		Writer.WriteArrayEnd();
+	}
+
+	static void WriteGraphFields(FWriter& Writer, const FBlueprintGraphSnapshot& Graph)
+	{
+		Writer.WriteValue(TEXT("name"), Graph.Name);
+		Writer.WriteValue(TEXT("hash"), FBlueprintSnapshotHash::ToString(Graph.Hash));
+
+		Writer.WriteArrayStart(TEXT("nodes"));
+		for (const FBlueprintNodeSnapshot& Node : Graph.Nodes)
+		{
+			WriteNode(Writer, Node);
+		}
+		Writer.WriteArrayEnd();
+	}
+
+	static void WriteNode(FWriter& Writer, const FBlueprintNodeSnapshot& Node)
+	{
+		Writer.WriteObjectStart();
+		Writer.WriteValue(TEXT("id"), Node.Id);
+		Writer.WriteValue(TEXT("type"), Node.Type);
+		Writer.WriteValue(TEXT("title"), Node.Title);
+		Writer.WriteValue(TEXT("hash"), FBlueprintSnapshotHash::ToString(Node.Hash));
+
+		Writer.WriteArrayStart(TEXT("pins"));
+		for (const FBlueprintPinSnapshot& Pin : Node.Pins)
+		{
+			WritePin(Writer, Pin);
+		}
+		Writer.WriteArrayEnd();
+
+		Writer.WriteObjectEnd();
+	}
+
+	static void WritePin(FWriter& Writer, const FBlueprintPinSnapshot& Pin)
+	{
+		Writer.WriteObjectStart();
+		Writer.WriteValue(TEXT("name"), Pin.Name);
+		Writer.WriteValue(TEXT("direction"), Pin.bIsInput ? TEXT("input") : TEXT("output"));
+		Writer.WriteValue(TEXT("type"), Pin.Type);
+
+		if (!Pin.DefaultValue.IsEmpty())
+		{
+			Writer.WriteValue(TEXT("default_value"), Pin.DefaultValue);
+		}
+
+		// "to" is present whenever the pin had links, even if every link ended at a dead-end knot
+		if (Pin.bHasLinks)
+		{
+			Writer.WriteArrayStart(TEXT("to"));
+			for (const FBlueprintConnectionSnapshot& Connection : Pin.Connections)
+			{
+				Writer.WriteObjectStart();
+				Writer.WriteValue(TEXT("node"), Connection.Node);
+				Writer.WriteValue(TEXT("pin"), Connection.Pin);
+				Writer.WriteObjectEnd();
+			}
+			Writer.WriteArrayEnd();
+		}
+
+		Writer.WriteObjectEnd();
+	}
+};
+
+template <class PrintPolicy>
+using TBlueprintJsonWriter = TBlueprintSchemaWriter<TJsonWriter<TCHAR, PrintPolicy>>;
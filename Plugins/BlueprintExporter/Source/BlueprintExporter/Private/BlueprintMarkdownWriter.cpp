@@ -0,0 +1,455 @@
+// BlueprintMarkdownWriter.cpp
+
+#include "BlueprintMarkdownWriter.h"
+
+// Longest execution chain followed from an event
+static constexpr int32 MaxExecutionChainSteps = 50;
+
+// Dependencies listed before the rest are left out
+static constexpr int32 MaxListedDependencies = 10;
+
+static bool IsExecPin(const FBlueprintPinSnapshot& Pin)
+{
+	return Pin.Type.Equals(TEXT("exec"), ESearchCase::CaseSensitive);
+}
+
+static bool IsEventNode(const FBlueprintNodeSnapshot& Node)
+{
+	return Node.Type.Contains(TEXT("Event"), ESearchCase::CaseSensitive);
+}
+
+static bool IsFunctionCallNode(const FBlueprintNodeSnapshot& Node)
+{
+	return Node.Type.Contains(TEXT("CallFunction"), ESearchCase::CaseSensitive);
+}
+
+static bool IsVariableNode(const FBlueprintNodeSnapshot& Node)
+{
+	return Node.Type.Contains(TEXT("Variable"), ESearchCase::CaseSensitive);
+}
+
+/** Ids of the nodes linked from a node's output pins, in pin order, without repeats */
+static void GetLinkedNodeIds(const FBlueprintNodeSnapshot& Node, bool bExecOnly, TArray<const FString*, TInlineAllocator<8>>& OutIds)
+{
+	for (const FBlueprintPinSnapshot& Pin : Node.Pins)
+	{
+		if (Pin.bIsInput || (bExecOnly && !IsExecPin(Pin)))
+		{
+			continue;
+		}
+
+		for (const FBlueprintConnectionSnapshot& Connection : Pin.Connections)
+		{
+			const bool bListed = OutIds.ContainsByPredicate([&Connection](const FString* Id)
+			{
+				return Id->Equals(Connection.Node, ESearchCase::CaseSensitive);
+			});
+			if (!bListed)
+			{
+				OutIds.Add(&Connection.Node);
+			}
+		}
+	}
+}
+
+int32 FBlueprintMarkdownWriter::EstimateLength(const FBlueprintSnapshot& Snapshot)
+{
+	int64 Length = 512 + Snapshot.Name.Len() + Snapshot.Path.Len() + Snapshot.ParentClass.Len();
+
+	for (const FBlueprintComponentSnapshot& Component : Snapshot.Components)
+	{
+		Length += Component.Name.Len() + Component.Class.Len() + 16;
+	}
+	for (const FBlueprintVariableSnapshot& Variable : Snapshot.Variables)
+	{
+		Length += Variable.Name.Len() + Variable.Type.Len() + Variable.Category.Len() + 24;
+	}
+	for (const FBlueprintFunctionSnapshot& Function : Snapshot.Functions)
+	{
+		Length += Function.Name.Len() + 16;
+		for (const FBlueprintParameterSnapshot& Parameter : Function.Parameters)
+		{
+			Length += Parameter.Name.Len() + Parameter.Type.Len() + 4;
+		}
+	}
+	for (int32 Index = 0; Index < FMath::Min(Snapshot.Dependencies.Num(), MaxListedDependencies); ++Index)
+	{
+		Length += Snapshot.Dependencies[Index].Len() + 8;
+	}
+
+	// Nodes appear in the node listing and, depending on their type, once or twice more
+	for (const FBlueprintGraphSnapshot& Graph : Snapshot.Graphs)
+	{
+		Length += Graph.Name.Len() + 64;
+		for (const FBlueprintNodeSnapshot& Node : Graph.Nodes)
+		{
+			Length += 3 * (Node.Title.Len() + Node.Type.Len()) + Node.Id.Len() + 96;
+			for (const FBlueprintPinSnapshot& Pin : Node.Pins)
+			{
+				Length += 2 * (Pin.Name.Len() + Pin.Type.Len() + Pin.DefaultValue.Len()) + 40;
+				for (const FBlueprintConnectionSnapshot& Connection : Pin.Connections)
+				{
+					Length += Connection.Node.Len() + 4;
+				}
+			}
+		}
+	}
+
+	return static_cast<int32>(FMath::Min<int64>(Length, MAX_int32));
+}
+
+void FBlueprintMarkdownWriter::WriteBlueprint(const FBlueprintSnapshot& Snapshot)
+{
+	// Header
+	Out += TEXT("# ");
+	Out += Snapshot.Name;
+	Out += TEXT("\n\n**Type:** Blueprint\n**Path:** `");
+	Out += Snapshot.Path;
+	Out += TEXT("`\n**Parent Class:** ");
+	Out += Snapshot.ParentClass.IsEmpty() ? TEXT("None") : *Snapshot.ParentClass;
+	Out += TEXT("\n\n");
+
+	// Components
+	if (Snapshot.Components.Num() > 0)
+	{
+		Out += TEXT("## Components\n\n");
+		for (const FBlueprintComponentSnapshot& Component : Snapshot.Components)
+		{
+			Out += TEXT("- **");
+			Out += Component.Name;
+			Out += TEXT("** (");
+			Out += Component.Class;
+			Out += TEXT(")\n");
+		}
+		Out += TEXT("\n");
+	}
+
+	// Variables
+	if (Snapshot.Variables.Num() > 0)
+	{
+		Out += TEXT("## Variables\n\n");
+		Out += TEXT("| Name | Type | Category | Exposed |\n");
+		Out += TEXT("|------|------|----------|----------|\n");
+		for (const FBlueprintVariableSnapshot& Variable : Snapshot.Variables)
+		{
+			Out += TEXT("| ");
+			Out += Variable.Name;
+			Out += TEXT(" | ");
+			Out += Variable.Type;
+			Out += TEXT(" | ");
+			Out += Variable.Category;
+			Out += Variable.bIsExposed ? TEXT(" | True |\n") : TEXT(" | False |\n");
+		}
+		Out += TEXT("\n");
+	}
+
+	// Functions
+	if (Snapshot.Functions.Num() > 0)
+	{
+		Out += TEXT("## Functions\n\n");
+		for (const FBlueprintFunctionSnapshot& Function : Snapshot.Functions)
+		{
+			Out += TEXT("### ");
+			Out += Function.Name;
+			Out += TEXT("(");
+			for (int32 Index = 0; Index < Function.Parameters.Num(); ++Index)
+			{
+				if (Index > 0)
+				{
+					Out += TEXT(", ");
+				}
+				Out += Function.Parameters[Index].Name;
+				Out += TEXT(": ");
+				Out += Function.Parameters[Index].Type;
+			}
+			Out += TEXT(")\n\n");
+		}
+		Out += TEXT("\n");
+	}
+
+	// Graphs, node by node
+	if (Snapshot.Graphs.Num() > 0)
+	{
+		Out += TEXT("## Graphs & Node Logic\n\n");
+		for (const FBlueprintGraphSnapshot& Graph : Snapshot.Graphs)
+		{
+			WriteGraph(Graph);
+		}
+		Out += TEXT("\n");
+	}
+
+	// Dependencies
+	if (Snapshot.Dependencies.Num() > 0)
+	{
+		Out += TEXT("## Dependencies\n\n");
+		for (int32 Index = 0; Index < FMath::Min(Snapshot.Dependencies.Num(), MaxListedDependencies); ++Index)
+		{
+			Out += TEXT("- `");
+			Out += Snapshot.Dependencies[Index];
+			Out += TEXT("`\n");
+		}
+		Out += TEXT("\n");
+	}
+}
+
+void FBlueprintMarkdownWriter::WriteGraph(const FBlueprintGraphSnapshot& Graph)
+{
+	Out += TEXT("### ");
+	Out += Graph.Name;
+	Out += TEXT("\n\n**Total Nodes:** ");
+	Out.AppendInt(Graph.Nodes.Num());
+	Out += TEXT("\n\n");
+
+	if (Graph.Nodes.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<int32> EventNodes;
+	TArray<int32> FunctionCallNodes;
+	TArray<int32> VariableNodes;
+	for (int32 Index = 0; Index < Graph.Nodes.Num(); ++Index)
+	{
+		const FBlueprintNodeSnapshot& Node = Graph.Nodes[Index];
+		if (IsEventNode(Node))
+		{
+			EventNodes.Add(Index);
+		}
+		if (IsFunctionCallNode(Node))
+		{
+			FunctionCallNodes.Add(Index);
+		}
+		if (IsVariableNode(Node))
+		{
+			VariableNodes.Add(Index);
+		}
+	}
+
+	// Execution flow, starting from each event
+	if (EventNodes.Num() > 0)
+	{
+		TMap<FString, int32> NodeIndices;
+		NodeIndices.Reserve(Graph.Nodes.Num());
+		for (int32 Index = 0; Index < Graph.Nodes.Num(); ++Index)
+		{
+			NodeIndices.Add(Graph.Nodes[Index].Id, Index);
+		}
+
+		Out += TEXT("#### Execution Flow\n\n");
+		for (const int32 EventIndex : EventNodes)
+		{
+			WriteExecutionChain(Graph, NodeIndices, EventIndex);
+		}
+		Out += TEXT("\n");
+	}
+
+	if (FunctionCallNodes.Num() > 0)
+	{
+		Out += TEXT("#### Function Calls\n\n");
+		for (const int32 Index : FunctionCallNodes)
+		{
+			WriteFunctionCall(Graph.Nodes[Index]);
+		}
+		Out += TEXT("\n");
+	}
+
+	if (VariableNodes.Num() > 0)
+	{
+		Out += TEXT("#### Variables Used\n\n");
+		for (const int32 Index : VariableNodes)
+		{
+			Out += TEXT("- **");
+			AppendJoinedLines(Graph.Nodes[Index].Title, TEXT(" "));
+			Out += TEXT("** (");
+			Out += Graph.Nodes[Index].Type;
+			Out += TEXT(")\n");
+		}
+		Out += TEXT("\n");
+	}
+
+	Out += TEXT("#### All Nodes (Detailed)\n\n");
+	for (int32 Index = 0; Index < Graph.Nodes.Num(); ++Index)
+	{
+		WriteNodeDetail(Graph.Nodes[Index], Index + 1);
+	}
+}
+
+void FBlueprintMarkdownWriter::WriteExecutionChain(const FBlueprintGraphSnapshot& Graph, const TMap<FString, int32>& NodeIndices, int32 EventIndex)
+{
+	Out += TEXT("**");
+	Out += Graph.Nodes[EventIndex].Title;
+	Out += TEXT("**\n\n");
+
+	TSet<int32> Visited;
+	int32 Current = EventIndex;
+	int32 Step = 1;
+	while (Current != INDEX_NONE && !Visited.Contains(Current))
+	{
+		Visited.Add(Current);
+		const FBlueprintNodeSnapshot& Node = Graph.Nodes[Current];
+
+		Out.AppendInt(Step);
+		Out += TEXT(". **");
+		AppendJoinedLines(Node.Title, TEXT(" \u2192 "));
+		Out += TEXT("** `[");
+		Out += Node.Type;
+		Out += TEXT("]`\n");
+
+		// Data pins; exec pins are the chain itself
+		for (const bool bInputs : { true, false })
+		{
+			bool bListed = false;
+			for (const FBlueprintPinSnapshot& Pin : Node.Pins)
+			{
+				if (Pin.bIsInput != bInputs || IsExecPin(Pin))
+				{
+					continue;
+				}
+
+				if (!bListed)
+				{
+					Out += bInputs ? TEXT("   - Inputs:\n") : TEXT("   - Outputs:\n");
+					bListed = true;
+				}
+
+				Out += TEXT("     - ");
+				Out += Pin.Name;
+				Out += TEXT(": `");
+				Out += Pin.Type;
+				Out += TEXT("`");
+				if (bInputs && !Pin.DefaultValue.IsEmpty())
+				{
+					Out += TEXT(" = `");
+					Out += Pin.DefaultValue;
+					Out += TEXT("`");
+				}
+				Out += TEXT("\n");
+			}
+		}
+
+		Out += TEXT("\n");
+
+		// The first linked exec output that leads to a node of this graph
+		TArray<const FString*, TInlineAllocator<8>> NextIds;
+		GetLinkedNodeIds(Node, true, NextIds);
+		Current = INDEX_NONE;
+		for (const FString* NextId : NextIds)
+		{
+			if (const int32* NextIndex = NodeIndices.Find(*NextId))
+			{
+				Current = *NextIndex;
+				break;
+			}
+		}
+
+		if (++Step > MaxExecutionChainSteps)
+		{
+			Out += TEXT("   _(Execution chain continues...)_\n\n");
+			break;
+		}
+	}
+
+	Out += TEXT("\n");
+}
+
+void FBlueprintMarkdownWriter::WriteFunctionCall(const FBlueprintNodeSnapshot& Node)
+{
+	Out += TEXT("- **");
+	AppendJoinedLines(Node.Title, TEXT(" \u2192 "));
+	Out += TEXT("**\n");
+
+	for (const bool bInputs : { true, false })
+	{
+		bool bListed = false;
+		for (const FBlueprintPinSnapshot& Pin : Node.Pins)
+		{
+			if (Pin.bIsInput != bInputs || IsExecPin(Pin))
+			{
+				continue;
+			}
+
+			if (!bListed)
+			{
+				Out += bInputs ? TEXT("  - Parameters:\n") : TEXT("  - Returns:\n");
+				bListed = true;
+			}
+
+			Out += TEXT("    - `");
+			Out += Pin.Name;
+			Out += TEXT("`: ");
+			Out += Pin.Type;
+			if (bInputs && !Pin.DefaultValue.IsEmpty())
+			{
+				Out += TEXT(" = `");
+				Out += Pin.DefaultValue;
+				Out += TEXT("`");
+			}
+			Out += TEXT("\n");
+		}
+	}
+
+	Out += TEXT("\n");
+}
+
+void FBlueprintMarkdownWriter::WriteNodeDetail(const FBlueprintNodeSnapshot& Node, int32 Number)
+{
+	Out += TEXT("**Node ");
+	Out.AppendInt(Number);
+	Out += TEXT(": ");
+	AppendJoinedLines(Node.Title, TEXT(" \u2192 "));
+	Out += TEXT("**\n- Type: `");
+	Out += Node.Type;
+	Out += TEXT("`\n- ID: `");
+	Out += Node.Id;
+	Out += TEXT("`\n");
+
+	if (Node.Pins.Num() > 0)
+	{
+		Out += TEXT("- Pins:\n");
+		for (const FBlueprintPinSnapshot& Pin : Node.Pins)
+		{
+			Out += Pin.bIsInput ? TEXT("  - [input] `") : TEXT("  - [output] `");
+			Out += Pin.Name;
+			Out += TEXT("`: ");
+			Out += Pin.Type;
+			if (!Pin.DefaultValue.IsEmpty())
+			{
+				Out += TEXT(" = `");
+				Out += Pin.DefaultValue;
+				Out += TEXT("`");
+			}
+			Out += TEXT("\n");
+		}
+	}
+
+	TArray<const FString*, TInlineAllocator<8>> LinkedIds;
+	GetLinkedNodeIds(Node, false, LinkedIds);
+	if (LinkedIds.Num() > 0)
+	{
+		Out += TEXT("- Connected to: ");
+		for (int32 Index = 0; Index < LinkedIds.Num(); ++Index)
+		{
+			Out += Index > 0 ? TEXT(", `") : TEXT("`");
+			Out += *LinkedIds[Index];
+			Out += TEXT("`");
+		}
+		Out += TEXT("\n");
+	}
+
+	Out += TEXT("\n");
+}
+
+void FBlueprintMarkdownWriter::AppendJoinedLines(const FString& Text, const TCHAR* Separator)
+{
+	int32 LineStart = 0;
+	for (int32 Index = 0; Index < Text.Len(); ++Index)
+	{
+		if (Text[Index] == TEXT('\n'))
+		{
+			Out.AppendChars(*Text + LineStart, Index - LineStart);
+			Out += Separator;
+			LineStart = Index + 1;
+		}
+	}
+	Out.AppendChars(*Text + LineStart, Text.Len() - LineStart);
+}
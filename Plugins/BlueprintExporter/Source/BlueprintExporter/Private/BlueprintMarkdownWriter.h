@@ -0,0 +1,45 @@
+// BlueprintMarkdownWriter.h
+// Markdown documentation of a blueprint, rendered straight from its snapshot
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintExportTypes.h"
+
+/**
+ * Appends the Markdown document of a blueprint to a string
+ *
+ * Renders the same document as generate_markdown() in Content/Python/blueprint_exporter.py
+ * does from the blueprint's JSON: components, variables and functions, then per graph the
+ * execution chain of each event, the function calls with their parameters, the variables
+ * used and every node with its pins and links. The two must stay in step.
+ *
+ * Everything is appended to one string, reserved up front from the snapshot's size, so
+ * rendering doesn't reallocate or format through Printf.
+ */
+class FBlueprintMarkdownWriter
+{
+public:
+	explicit FBlueprintMarkdownWriter(FString& InOut)
+		: Out(InOut)
+	{
+	}
+
+	/** Rough length of the document, for reserving the output */
+	static int32 EstimateLength(const FBlueprintSnapshot& Snapshot);
+
+	void WriteBlueprint(const FBlueprintSnapshot& Snapshot);
+
+private:
+	void WriteGraph(const FBlueprintGraphSnapshot& Graph);
+
+	/** Follow the first linked exec output of each node from an event, as far as 50 steps */
+	void WriteExecutionChain(const FBlueprintGraphSnapshot& Graph, const TMap<FString, int32>& NodeIndices, int32 EventIndex);
+	void WriteFunctionCall(const FBlueprintNodeSnapshot& Node);
+	void WriteNodeDetail(const FBlueprintNodeSnapshot& Node, int32 Number);
+
+	/** Append text with each line break replaced by Separator */
+	void AppendJoinedLines(const FString& Text, const TCHAR* Separator);
+
+	FString& Out;
+};
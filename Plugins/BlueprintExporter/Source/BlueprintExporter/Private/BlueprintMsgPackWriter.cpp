@@ -0,0 +1,253 @@
+// BlueprintMsgPackWriter.cpp
+
+#include "BlueprintMsgPackWriter.h"
+
+namespace BlueprintMsgPack
+{
+	// Type bytes, see https://github.com/msgpack/msgpack/blob/master/spec.md
+	constexpr uint8 FixMap = 0x80;
+	constexpr uint8 FixArray = 0x90;
+	constexpr uint8 FixStr = 0xa0;
+	constexpr uint8 False = 0xc2;
+	constexpr uint8 True = 0xc3;
+	constexpr uint8 UInt8 = 0xcc;
+	constexpr uint8 UInt16 = 0xcd;
+	constexpr uint8 UInt32 = 0xce;
+	constexpr uint8 UInt64 = 0xcf;
+	constexpr uint8 Int8 = 0xd0;
+	constexpr uint8 Int16 = 0xd1;
+	constexpr uint8 Int32 = 0xd2;
+	constexpr uint8 Int64 = 0xd3;
+	constexpr uint8 Str8 = 0xd9;
+	constexpr uint8 Str16 = 0xda;
+	constexpr uint8 Str32 = 0xdb;
+	constexpr uint8 Array16 = 0xdc;
+	constexpr uint8 Array32 = 0xdd;
+	constexpr uint8 Map16 = 0xde;
+	constexpr uint8 Map32 = 0xdf;
+
+	// Type byte and 32-bit count
+	constexpr int32 ReservedHeaderSize = 5;
+}
+
+void FBlueprintMsgPackWriter::WriteObjectStart()
+{
+	BeginValue();
+	BeginContainer(true);
+}
+
+void FBlueprintMsgPackWriter::WriteObjectStart(const TCHAR* Identifier)
+{
+	WriteIdentifier(Identifier);
+	BeginContainer(true);
+}
+
+void FBlueprintMsgPackWriter::WriteObjectEnd()
+{
+	EndContainer(true);
+}
+
+void FBlueprintMsgPackWriter::WriteArrayStart()
+{
+	BeginValue();
+	BeginContainer(false);
+}
+
+void FBlueprintMsgPackWriter::WriteArrayStart(const TCHAR* Identifier)
+{
+	WriteIdentifier(Identifier);
+	BeginContainer(false);
+}
+
+void FBlueprintMsgPackWriter::WriteArrayEnd()
+{
+	EndContainer(false);
+}
+
+void FBlueprintMsgPackWriter::WriteValue(const FString& Value)
+{
+	BeginValue();
+	WriteString(*Value, Value.Len());
+}
+
+void FBlueprintMsgPackWriter::WriteValue(int32 Value)
+{
+	BeginValue();
+	WriteInteger(Value);
+}
+
+void FBlueprintMsgPackWriter::WriteValue(const TCHAR* Identifier, const FString& Value)
+{
+	WriteIdentifier(Identifier);
+	WriteString(*Value, Value.Len());
+}
+
+void FBlueprintMsgPackWriter::WriteValue(const TCHAR* Identifier, const TCHAR* Value)
+{
+	WriteIdentifier(Identifier);
+	WriteString(Value, FCString::Strlen(Value));
+}
+
+void FBlueprintMsgPackWriter::WriteValue(const TCHAR* Identifier, int32 Value)
+{
+	WriteIdentifier(Identifier);
+	WriteInteger(Value);
+}
+
+void FBlueprintMsgPackWriter::WriteValue(const TCHAR* Identifier, bool Value)
+{
+	WriteIdentifier(Identifier);
+	Bytes.Add(Value ? BlueprintMsgPack::True : BlueprintMsgPack::False);
+}
+
+void FBlueprintMsgPackWriter::BeginValue()
+{
+	if (Containers.Num() > 0)
+	{
+		check(!Containers.Last().bIsMap);
+		Containers.Last().Count++;
+	}
+}
+
+void FBlueprintMsgPackWriter::WriteIdentifier(const TCHAR* Identifier)
+{
+	check(Containers.Num() > 0 && Containers.Last().bIsMap);
+	Containers.Last().Count++;
+	WriteString(Identifier, FCString::Strlen(Identifier));
+}
+
+void FBlueprintMsgPackWriter::BeginContainer(bool bIsMap)
+{
+	Containers.Add({ Bytes.Num(), 0, bIsMap });
+	Bytes.AddUninitialized(BlueprintMsgPack::ReservedHeaderSize);
+}
+
+void FBlueprintMsgPackWriter::EndContainer(bool bIsMap)
+{
+	check(Containers.Num() > 0 && Containers.Last().bIsMap == bIsMap);
+	const FContainer Container = Containers.Pop();
+
+	uint8 Header[BlueprintMsgPack::ReservedHeaderSize];
+	int32 HeaderSize;
+	if (Container.Count < 16)
+	{
+		Header[0] = (bIsMap ? BlueprintMsgPack::FixMap : BlueprintMsgPack::FixArray) | static_cast<uint8>(Container.Count);
+		HeaderSize = 1;
+	}
+	else if (Container.Count <= MAX_uint16)
+	{
+		Header[0] = bIsMap ? BlueprintMsgPack::Map16 : BlueprintMsgPack::Array16;
+		Header[1] = static_cast<uint8>(Container.Count >> 8);
+		Header[2] = static_cast<uint8>(Container.Count);
+		HeaderSize = 3;
+	}
+	else
+	{
+		Header[0] = bIsMap ? BlueprintMsgPack::Map32 : BlueprintMsgPack::Array32;
+		Header[1] = static_cast<uint8>(Container.Count >> 24);
+		Header[2] = static_cast<uint8>(Container.Count >> 16);
+		Header[3] = static_cast<uint8>(Container.Count >> 8);
+		Header[4] = static_cast<uint8>(Container.Count);
+		HeaderSize = 5;
+	}
+
+	// Most containers are small, so this moves only their own contents
+	FMemory::Memcpy(Bytes.GetData() + Container.HeaderOffset, Header, HeaderSize);
+	if (HeaderSize < BlueprintMsgPack::ReservedHeaderSize)
+	{
+		Bytes.RemoveAt(Container.HeaderOffset + HeaderSize, BlueprintMsgPack::ReservedHeaderSize - HeaderSize, false);
+	}
+}
+
+void FBlueprintMsgPackWriter::WriteString(const TCHAR* Chars, int32 Length)
+{
+	const FTCHARToUTF8 Utf8(Chars, Length);
+	const uint32 Size = static_cast<uint32>(Utf8.Length());
+
+	if (Size < 32)
+	{
+		Bytes.Add(BlueprintMsgPack::FixStr | static_cast<uint8>(Size));
+	}
+	else if (Size <= MAX_uint8)
+	{
+		Bytes.Add(BlueprintMsgPack::Str8);
+		WriteBigEndian(Size, 1);
+	}
+	else if (Size <= MAX_uint16)
+	{
+		Bytes.Add(BlueprintMsgPack::Str16);
+		WriteBigEndian(Size, 2);
+	}
+	else
+	{
+		Bytes.Add(BlueprintMsgPack::Str32);
+		WriteBigEndian(Size, 4);
+	}
+
+	Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Size);
+}
+
+void FBlueprintMsgPackWriter::WriteInteger(int64 Value)
+{
+	if (Value >= 0)
+	{
+		if (Value < 128)
+		{
+			// Positive fixint
+			Bytes.Add(static_cast<uint8>(Value));
+		}
+		else if (Value <= MAX_uint8)
+		{
+			Bytes.Add(BlueprintMsgPack::UInt8);
+			WriteBigEndian(Value, 1);
+		}
+		else if (Value <= MAX_uint16)
+		{
+			Bytes.Add(BlueprintMsgPack::UInt16);
+			WriteBigEndian(Value, 2);
+		}
+		else if (Value <= MAX_uint32)
+		{
+			Bytes.Add(BlueprintMsgPack::UInt32);
+			WriteBigEndian(Value, 4);
+		}
+		else
+		{
+			Bytes.Add(BlueprintMsgPack::UInt64);
+			WriteBigEndian(Value, 8);
+		}
+	}
+	else if (Value >= -32)
+	{
+		// Negative fixint
+		Bytes.Add(static_cast<uint8>(static_cast<int8>(Value)));
+	}
+	else if (Value >= MIN_int8)
+	{
+		Bytes.Add(BlueprintMsgPack::Int8);
+		WriteBigEndian(static_cast<uint64>(Value), 1);
+	}
+	else if (Value >= MIN_int16)
+	{
+		Bytes.Add(BlueprintMsgPack::Int16);
+		WriteBigEndian(static_cast<uint64>(Value), 2);
+	}
+	else if (Value >= MIN_int32)
+	{
+		Bytes.Add(BlueprintMsgPack::Int32);
+		WriteBigEndian(static_cast<uint64>(Value), 4);
+	}
+	else
+	{
+		Bytes.Add(BlueprintMsgPack::Int64);
+		WriteBigEndian(static_cast<uint64>(Value), 8);
+	}
+}
+
+void FBlueprintMsgPackWriter::WriteBigEndian(uint64 Value, int32 NumBytes)
+{
+	for (int32 Shift = (NumBytes - 1) * 8; Shift >= 0; Shift -= 8)
+	{
+		Bytes.Add(static_cast<uint8>(Value >> Shift));
+	}
+}
@@ -0,0 +1,64 @@
+// BlueprintMsgPackWriter.h
+// MessagePack output with the same calls as TJsonWriter, for TBlueprintSchemaWriter
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Writes MessagePack (https://msgpack.org) into a byte array
+ *
+ * JSON objects become maps with string keys and arrays stay arrays, so the output has
+ * the same fields in the same order as the JSON export. Sizes aren't known when a
+ * container starts, so each one reserves the largest header and is shrunk to the
+ * smallest header that fits its final count when it ends; readers see plain,
+ * minimally encoded MessagePack.
+ */
+class FBlueprintMsgPackWriter
+{
+public:
+	explicit FBlueprintMsgPackWriter(TArray<uint8>& InBytes)
+		: Bytes(InBytes)
+	{
+	}
+
+	void WriteObjectStart();
+	void WriteObjectStart(const TCHAR* Identifier);
+	void WriteObjectEnd();
+
+	void WriteArrayStart();
+	void WriteArrayStart(const TCHAR* Identifier);
+	void WriteArrayEnd();
+
+	void WriteValue(const FString& Value);
+	void WriteValue(int32 Value);
+	void WriteValue(const TCHAR* Identifier, const FString& Value);
+	void WriteValue(const TCHAR* Identifier, const TCHAR* Value);
+	void WriteValue(const TCHAR* Identifier, int32 Value);
+	void WriteValue(const TCHAR* Identifier, bool Value);
+
+	/** @return True if every object and array was closed */
+	bool Close() const { return Containers.Num() == 0; }
+
+private:
+	struct FContainer
+	{
+		int32 HeaderOffset;
+		uint32 Count;
+		bool bIsMap;
+	};
+
+	/** Count a value in the enclosing array (map entries are counted by their key) */
+	void BeginValue();
+	void WriteIdentifier(const TCHAR* Identifier);
+
+	void BeginContainer(bool bIsMap);
+	void EndContainer(bool bIsMap);
+
+	void WriteString(const TCHAR* Chars, int32 Length);
+	void WriteInteger(int64 Value);
+	void WriteBigEndian(uint64 Value, int32 NumBytes);
+
+	TArray<uint8>& Bytes;
+	TArray<FContainer> Containers;
+};
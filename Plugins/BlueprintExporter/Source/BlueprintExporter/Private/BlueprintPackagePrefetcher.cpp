@@ -0,0 +1,118 @@
+// BlueprintPackagePrefetcher.cpp
+
+#include "BlueprintPackagePrefetcher.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+// Loaded blueprints (graphs, pins, generated class, CDO) are several times their size on disk
+static constexpr int64 LoadedSizePerDiskByte = 4;
+
+// Used when the asset registry has no size for a package
+static constexpr int64 DefaultPackageDiskSize = 256 * 1024;
+
+FBlueprintPackagePrefetcher::FBlueprintPackagePrefetcher(int32 InMaxPackages, int64 InMemoryBudgetBytes)
+	: MaxPackages(FMath::Max(0, InMaxPackages))
+	, MemoryBudgetBytes(InMemoryBudgetBytes)
+{
+}
+
+FBlueprintPackagePrefetcher::~FBlueprintPackagePrefetcher()
+{
+	for (const FRequest& Request : Window)
+	{
+		if (Request.RequestId != INDEX_NONE && !CompletedPackages.Contains(PackageNames[Request.QueueIndex]))
+		{
+			FlushAsyncLoading(Request.RequestId);
+		}
+	}
+}
+
+void FBlueprintPackagePrefetcher::SetQueue(TArray<FName> InPackageNames)
+{
+	check(Window.Num() == 0);
+
+	PackageNames = MoveTemp(InPackageNames);
+	NextToIssue = 0;
+	WindowBytes = 0;
+}
+
+void FBlueprintPackagePrefetcher::Pump(int32 Index)
+{
+	NextToIssue = FMath::Max(NextToIssue, Index);
+
+	while (NextToIssue < PackageNames.Num() && Window.Num() < MaxPackages)
+	{
+		const FName PackageName = PackageNames[NextToIssue];
+		const int64 EstimatedBytes = EstimateLoadedSize(PackageName);
+
+		if (Window.Num() > 0 && WindowBytes + EstimatedBytes > MemoryBudgetBytes)
+		{
+			break;
+		}
+
+		FRequest Request;
+		Request.QueueIndex = NextToIssue++;
+
+		// Already in memory (e.g. open in an editor): nothing to load, and no memory to account for
+		UPackage* Existing = FindObjectFast<UPackage>(nullptr, PackageName);
+		if (!Existing || !Existing->IsFullyLoaded())
+		{
+			Request.EstimatedBytes = EstimatedBytes;
+			Request.RequestId = LoadPackageAsync(PackageName.ToString(), FLoadPackageAsyncDelegate::CreateRaw(this, &FBlueprintPackagePrefetcher::OnPackageLoaded));
+		}
+
+		WindowBytes += Request.EstimatedBytes;
+		Window.Add(Request);
+	}
+}
+
+void FBlueprintPackagePrefetcher::WaitFor(int32 Index)
+{
+	while (Window.Num() > 0 && Window[0].QueueIndex <= Index)
+	{
+		const FRequest Request = Window[0];
+		Window.RemoveAt(0);
+		WindowBytes -= Request.EstimatedBytes;
+
+		if (Request.QueueIndex < Index)
+		{
+			continue;
+		}
+
+		// Completion callbacks run on the game thread, from Tick() or FlushAsyncLoading()
+		if (Request.RequestId == INDEX_NONE || CompletedPackages.Remove(PackageNames[Request.QueueIndex]) > 0)
+		{
+			HitCount++;
+		}
+		else
+		{
+			StallCount++;
+			FlushAsyncLoading(Request.RequestId);
+		}
+	}
+}
+
+void FBlueprintPackagePrefetcher::Tick(double TimeLimitSeconds)
+{
+	if (IsAsyncLoading())
+	{
+		ProcessAsyncLoading(true, false, TimeLimitSeconds);
+	}
+}
+
+int64 FBlueprintPackagePrefetcher::EstimateLoadedSize(FName PackageName)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+
+	const int64 DiskSize = PackageData.IsSet() && PackageData->DiskSize > 0 ? PackageData->DiskSize : DefaultPackageDiskSize;
+	return DiskSize * LoadedSizePerDiskByte;
+}
+
+void FBlueprintPackagePrefetcher::OnPackageLoaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+{
+	// Failed loads count as complete too; GetAsset() reports the failure
+	CompletedPackages.Add(PackageName);
+}
@@ -0,0 +1,69 @@
+// BlueprintPackagePrefetcher.h
+// Loads the next packages of a bulk export asynchronously while the current one is processed
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectGlobals.h"
+
+/**
+ * Sliding window of async package loads ahead of the bulk export cursor
+ *
+ * The window holds at most MaxPackages requests and stops growing once the
+ * estimated resident size of the packages in it exceeds the memory budget
+ * (always allowing one, so a single large package can't stall the export).
+ * Packages must be consumed in queue order with WaitFor().
+ */
+class FBlueprintPackagePrefetcher
+{
+public:
+	FBlueprintPackagePrefetcher(int32 InMaxPackages, int64 InMemoryBudgetBytes);
+
+	/** Waits for outstanding loads so no completion callback outlives the prefetcher */
+	~FBlueprintPackagePrefetcher();
+
+	/** Packages that will be consumed, in order */
+	void SetQueue(TArray<FName> InPackageNames);
+
+	/** Issue async loads from Index onwards until the window is full */
+	void Pump(int32 Index);
+
+	/** Block until the package at Index has finished loading, and release its window slot */
+	void WaitFor(int32 Index);
+
+	/** Give the async loader some game-thread time, e.g. while waiting on workers */
+	static void Tick(double TimeLimitSeconds);
+
+	/** Packages that were already loading or loaded when they were needed */
+	int32 GetHitCount() const { return HitCount; }
+
+	/** Packages the export had to wait for */
+	int32 GetStallCount() const { return StallCount; }
+
+	/** Rough in-memory size of a package, from its size on disk */
+	static int64 EstimateLoadedSize(FName PackageName);
+
+private:
+	struct FRequest
+	{
+		int32 QueueIndex = INDEX_NONE;
+		int32 RequestId = INDEX_NONE;
+		int64 EstimatedBytes = 0;
+	};
+
+	void OnPackageLoaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result);
+
+	int32 MaxPackages = 0;
+	int64 MemoryBudgetBytes = 0;
+
+	TArray<FName> PackageNames;
+	int32 NextToIssue = 0;
+
+	// Outstanding requests in queue order
+	TArray<FRequest> Window;
+	int64 WindowBytes = 0;
+	TSet<FName> CompletedPackages;
+
+	int32 HitCount = 0;
+	int32 StallCount = 0;
+};
@@ -0,0 +1,29 @@
+// BlueprintPinTypeNames.cpp
+
+#include "BlueprintPinTypeNames.h"
+#include "BlueprintGraphAdapter.h"
+#include "GraphCore/BlueprintGraphFormat.h"
+
+const FBlueprintPinTypeNames::FNames& FBlueprintPinTypeNames::Find(const FEdGraphPinType& PinType)
+{
+	const FKey Key{ PinType.PinCategory, PinType.PinSubCategoryObject.Get(), PinType.IsArray() };
+
+	if (const FNames* Found = Names.Find(Key))
+	{
+		return *Found;
+	}
+
+	FNames& Added = Names.Add(Key);
+	Added.Utf8Name = Format(PinType);
+	Added.Name = FBlueprintGraphAdapter::FromUtf8(Added.Utf8Name);
+	return Added;
+}
+
+std::string FBlueprintPinTypeNames::Format(const FEdGraphPinType& PinType)
+{
+	const std::string SubCategoryObject = PinType.PinSubCategoryObject.IsValid()
+		? FBlueprintGraphAdapter::ToUtf8(PinType.PinSubCategoryObject->GetName())
+		: std::string();
+
+	return BlueprintGraph::FormatPinType(FBlueprintGraphAdapter::ToUtf8(PinType.PinCategory.ToString()), SubCategoryObject, PinType.IsArray());
+}
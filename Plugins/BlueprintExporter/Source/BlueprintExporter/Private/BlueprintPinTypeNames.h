@@ -0,0 +1,57 @@
+// BlueprintPinTypeNames.h
+// Pin type strings, computed once per distinct pin type
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraphPin.h"
+#include <string>
+
+/**
+ * Caches the exported type string of each distinct pin type seen during a capture
+ *
+ * A blueprint has thousands of pins but only a few dozen pin types, so the
+ * category name, sub-category object name and container wrapping are built once
+ * per type. Only the fields the type string depends on are part of the key.
+ * Game thread only, like the rest of the capture.
+ */
+class FBlueprintPinTypeNames
+{
+public:
+	/** The type string for PinType, e.g. "object<Actor>" or "Array<int>" */
+	const FString& Get(const FEdGraphPinType& PinType) { return Find(PinType).Name; }
+
+	/** The same string in UTF-8, for the graph model */
+	const std::string& GetUtf8(const FEdGraphPinType& PinType) { return Find(PinType).Utf8Name; }
+
+	/** Build the type string without caching (see BlueprintGraph::FormatPinType) */
+	static std::string Format(const FEdGraphPinType& PinType);
+
+private:
+	struct FKey
+	{
+		FName Category;
+		const UObject* SubCategoryObject;
+		bool bIsArray;
+
+		bool operator==(const FKey& Other) const
+		{
+			return Category == Other.Category && SubCategoryObject == Other.SubCategoryObject && bIsArray == Other.bIsArray;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.Category), GetTypeHash(Key.SubCategoryObject)), GetTypeHash(Key.bIsArray));
+		}
+	};
+
+	struct FNames
+	{
+		FString Name;
+		std::string Utf8Name;
+	};
+
+	const FNames& Find(const FEdGraphPinType& PinType);
+
+	TMap<FKey, FNames> Names;
+};
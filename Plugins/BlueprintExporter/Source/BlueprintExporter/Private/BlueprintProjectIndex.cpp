@@ -0,0 +1,253 @@
+// BlueprintProjectIndex.cpp
+
+#include "BlueprintProjectIndex.h"
+#include "BlueprintExporter.h"
+#include "BlueprintFileWriter.h"
+#include "BlueprintSnapshotHash.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+const TCHAR* FBlueprintProjectIndex::BaseFileName = TEXT("index");
+
+/** Top-level content folder of a package, e.g. /Game/Characters/Heroes/BP_Hero -> Characters; empty at the root */
+static FString GetCategory(FName PackageName)
+{
+	TArray<FString> Parts;
+	PackageName.ToString().ParseIntoArray(Parts, TEXT("/"));
+	return Parts.Num() > 2 ? Parts[1] : FString();
+}
+
+static FString FormatBytes(int64 Bytes)
+{
+	if (Bytes < 1024)
+	{
+		return FString::Printf(TEXT("%lld B"), Bytes);
+	}
+	if (Bytes < 1024 * 1024)
+	{
+		return FString::Printf(TEXT("%.1f KB"), Bytes / 1024.0);
+	}
+	return FString::Printf(TEXT("%.1f MB"), Bytes / (1024.0 * 1024.0));
+}
+
+FBlueprintProjectIndex::FBlueprintProjectIndex(const FString& InOutputDirectory, const FString& InBaseFileName)
+	: OutputDirectory(InOutputDirectory)
+	, IndexBaseName(InBaseFileName)
+{
+}
+
+void FBlueprintProjectIndex::Load()
+{
+	Blueprints.Reset();
+
+	const FString IndexPath = FPaths::Combine(OutputDirectory, IndexBaseName + TEXT(".json"));
+	FString JsonString;
+	if (!FPaths::FileExists(IndexPath) || !FFileHelper::LoadFileToString(JsonString, *IndexPath))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	const TArray<TSharedPtr<FJsonValue>>* BlueprintValues;
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid()
+		|| !Root->TryGetArrayField(TEXT("blueprints"), BlueprintValues))
+	{
+		UE_LOG(LogBlueprintExporter, Warning, TEXT("Ignoring unreadable project index: %s"), *IndexPath);
+		return;
+	}
+
+	// Entries of another format may describe different output
+	int32 FormatVersion = 0;
+	if (!Root->TryGetNumberField(TEXT("format_version"), FormatVersion) || FormatVersion != BlueprintExporterFormatVersion)
+	{
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& BlueprintValue : *BlueprintValues)
+	{
+		const TSharedPtr<FJsonObject> BlueprintObject = BlueprintValue->AsObject();
+		FString AssetPath;
+		if (!BlueprintObject.IsValid() || !BlueprintObject->TryGetStringField(TEXT("path"), AssetPath))
+		{
+			continue;
+		}
+
+		FEntry Entry;
+		Entry.PackageName = FName(*BlueprintObject->GetStringField(TEXT("package")));
+		Entry.Name = BlueprintObject->GetStringField(TEXT("name"));
+		BlueprintObject->TryGetStringField(TEXT("parent_class"), Entry.ParentClass);
+		BlueprintObject->TryGetStringField(TEXT("hash"), Entry.Hash);
+		BlueprintObject->TryGetStringField(TEXT("file"), Entry.File);
+		BlueprintObject->TryGetNumberField(TEXT("graphs"), Entry.GraphCount);
+		BlueprintObject->TryGetNumberField(TEXT("nodes"), Entry.NodeCount);
+		BlueprintObject->TryGetNumberField(TEXT("variables"), Entry.VariableCount);
+		BlueprintObject->TryGetNumberField(TEXT("functions"), Entry.FunctionCount);
+		BlueprintObject->TryGetNumberField(TEXT("bytes"), Entry.Bytes);
+
+		Blueprints.Add(AssetPath, MoveTemp(Entry));
+	}
+}
+
+bool FBlueprintProjectIndex::Save() const
+{
+	// Grouped by top-level folder (root first), then by path, so both files are deterministic
+	TArray<FString> SortedPaths;
+	Blueprints.GetKeys(SortedPaths);
+	SortedPaths.Sort([this](const FString& A, const FString& B)
+	{
+		const FString CategoryA = GetCategory(Blueprints.FindChecked(A).PackageName);
+		const FString CategoryB = GetCategory(Blueprints.FindChecked(B).PackageName);
+		return CategoryA != CategoryB ? CategoryA < CategoryB : A < B;
+	});
+
+	bool bSaved = true;
+	const TPair<const TCHAR*, FString> Files[] =
+	{
+		{ TEXT(".json"), MakeJson(SortedPaths) },
+		{ TEXT(".md"), MakeMarkdown(SortedPaths) },
+	};
+	for (const TPair<const TCHAR*, FString>& File : Files)
+	{
+		const FString FilePath = FPaths::Combine(OutputDirectory, IndexBaseName + File.Key);
+		if (FBlueprintFileWriter::WriteIfChanged(FilePath, File.Value) == EBlueprintFileWriteResult::Failed)
+		{
+			UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to save project index: %s"), *FilePath);
+			bSaved = false;
+		}
+	}
+
+	return bSaved;
+}
+
+FString FBlueprintProjectIndex::MakeJson(const TArray<FString>& SortedPaths) const
+{
+	int64 TotalNodes = 0;
+	int64 TotalBytes = 0;
+	for (const TPair<FString, FEntry>& Pair : Blueprints)
+	{
+		TotalNodes += Pair.Value.NodeCount;
+		TotalBytes += Pair.Value.Bytes;
+	}
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("format_version"), BlueprintExporterFormatVersion);
+	Writer->WriteValue(TEXT("total_blueprints"), Blueprints.Num());
+	Writer->WriteValue(TEXT("total_nodes"), TotalNodes);
+	Writer->WriteValue(TEXT("total_bytes"), TotalBytes);
+
+	Writer->WriteArrayStart(TEXT("blueprints"));
+	for (const FString& AssetPath : SortedPaths)
+	{
+		const FEntry& Entry = Blueprints.FindChecked(AssetPath);
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("path"), AssetPath);
+		Writer->WriteValue(TEXT("package"), Entry.PackageName.ToString());
+		Writer->WriteValue(TEXT("name"), Entry.Name);
+		if (!Entry.ParentClass.IsEmpty())
+		{
+			Writer->WriteValue(TEXT("parent_class"), Entry.ParentClass);
+		}
+		Writer->WriteValue(TEXT("hash"), Entry.Hash);
+		if (!Entry.File.IsEmpty())
+		{
+			Writer->WriteValue(TEXT("file"), Entry.File);
+		}
+		Writer->WriteValue(TEXT("graphs"), Entry.GraphCount);
+		Writer->WriteValue(TEXT("nodes"), Entry.NodeCount);
+		Writer->WriteValue(TEXT("variables"), Entry.VariableCount);
+		Writer->WriteValue(TEXT("functions"), Entry.FunctionCount);
+		Writer->WriteValue(TEXT("bytes"), Entry.Bytes);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+	return JsonString;
+}
+
+FString FBlueprintProjectIndex::MakeMarkdown(const TArray<FString>& SortedPaths) const
+{
+	FString Markdown;
+	Markdown.Reserve(256 + SortedPaths.Num() * 128);
+
+	Markdown += TEXT("# Blueprint Index\n\n");
+	Markdown += FString::Printf(TEXT("**Total Blueprints:** %d\n\n"), Blueprints.Num());
+	Markdown += TEXT("## All Blueprints\n\n");
+
+	FString CurrentCategory;
+	for (const FString& AssetPath : SortedPaths)
+	{
+		const FEntry& Entry = Blueprints.FindChecked(AssetPath);
+
+		const FString Category = GetCategory(Entry.PackageName);
+		if (Category != CurrentCategory)
+		{
+			CurrentCategory = Category;
+			Markdown += FString::Printf(TEXT("\n### %s\n\n"), *Category);
+		}
+
+		// Without a file of its own (bundle mode) the blueprint is listed by path
+		if (Entry.File.IsEmpty())
+		{
+			Markdown += FString::Printf(TEXT("- %s (`%s`)"), *Entry.Name, *AssetPath);
+		}
+		else
+		{
+			Markdown += FString::Printf(TEXT("- [%s](%s)"), *Entry.Name, *Entry.File);
+		}
+
+		Markdown += FString::Printf(TEXT(" - %s, %d graphs, %d nodes, %s\n"),
+			Entry.ParentClass.IsEmpty() ? TEXT("None") : *Entry.ParentClass, Entry.GraphCount, Entry.NodeCount, *FormatBytes(Entry.Bytes));
+	}
+
+	return Markdown;
+}
+
+void FBlueprintProjectIndex::Update(const FBlueprintSnapshot& Snapshot)
+{
+	FEntry& Entry = Blueprints.FindOrAdd(Snapshot.Path);
+	Entry.PackageName = FName(*Snapshot.PackageName);
+	Entry.Name = Snapshot.Name;
+	Entry.ParentClass = Snapshot.ParentClass;
+	Entry.Hash = FBlueprintSnapshotHash::ToString(Snapshot.Hash);
+	Entry.GraphCount = Snapshot.Graphs.Num();
+	Entry.NodeCount = 0;
+	for (const FBlueprintGraphSnapshot& Graph : Snapshot.Graphs)
+	{
+		Entry.NodeCount += Graph.Nodes.Num();
+	}
+	Entry.VariableCount = Snapshot.Variables.Num();
+	Entry.FunctionCount = Snapshot.Functions.Num();
+}
+
+void FBlueprintProjectIndex::SetOutput(const FString& AssetPath, const FString& FilePath, int64 Bytes)
+{
+	if (FEntry* Entry = Blueprints.Find(AssetPath))
+	{
+		Entry->File.Reset();
+		if (!FilePath.IsEmpty())
+		{
+			Entry->File = FilePath;
+			FPaths::MakePathRelativeTo(Entry->File, *(OutputDirectory / TEXT("")));
+		}
+		Entry->Bytes = Bytes;
+	}
+}
+
+void FBlueprintProjectIndex::RemoveStale(const TSet<FName>& LivePackageNames)
+{
+	for (auto It = Blueprints.CreateIterator(); It; ++It)
+	{
+		if (!LivePackageNames.Contains(It.Value().PackageName))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,85 @@
+// BlueprintProjectIndex.h
+// index.md and index.json listing every exported blueprint
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintExportTypes.h"
+
+/**
+ * Project index stored as <OutputDirectory>/index.json, with index.md next to it
+ *
+ * One entry per exported blueprint: its name, parent class, structural hash, graph, node,
+ * variable and function counts, the size of its output and the file to open (its Markdown, or its
+ * data file without Markdown; none in bundle mode). Both files are built from what the
+ * export already holds in memory, never from a scan of the output directory. Exports
+ * update it incrementally like the dependency index: the entries of re-exported
+ * blueprints are replaced, those of deleted blueprints dropped and the rest kept from
+ * the last save.
+ *
+ * Game thread only.
+ */
+class FBlueprintProjectIndex
+{
+public:
+	/** Base name of both files; sharded exports keep one pair per shard */
+	static const TCHAR* BaseFileName;
+
+	explicit FBlueprintProjectIndex(const FString& InOutputDirectory, const FString& InBaseFileName = BaseFileName);
+
+	/** Load index.json; a missing, unreadable or outdated file simply means an empty index */
+	void Load();
+
+	/** Write index.json and index.md (each only if its content changed) */
+	bool Save() const;
+
+	/** Record (or replace) a captured blueprint; its output is filled in by SetOutput */
+	void Update(const FBlueprintSnapshot& Snapshot);
+
+	/**
+	 * Record where a blueprint's export went
+	 * @param FilePath - Markdown or data file, empty if the blueprint has no file of its own
+	 * @param Bytes - Size of the blueprint's output
+	 */
+	void SetOutput(const FString& AssetPath, const FString& FilePath, int64 Bytes);
+
+	/** Output size recorded for a blueprint by SetOutput, here or in the loaded index; 0 if unknown */
+	int64 GetBytes(const FString& AssetPath) const
+	{
+		const FEntry* Entry = Blueprints.Find(AssetPath);
+		return Entry ? Entry->Bytes : 0;
+	}
+
+	void Remove(const FString& AssetPath) { Blueprints.Remove(AssetPath); }
+
+	bool Contains(const FString& AssetPath) const { return Blueprints.Contains(AssetPath); }
+
+	/** Drop blueprints that are no longer in the project */
+	void RemoveStale(const TSet<FName>& LivePackageNames);
+
+private:
+	struct FEntry
+	{
+		FName PackageName;
+		FString Name;
+		FString ParentClass;
+		// Structural hash of the blueprint (FBlueprintSnapshot::Hash)
+		FString Hash;
+		// Relative to the output directory, with forward slashes
+		FString File;
+		int32 GraphCount = 0;
+		int32 NodeCount = 0;
+		int32 VariableCount = 0;
+		int32 FunctionCount = 0;
+		int64 Bytes = 0;
+	};
+
+	FString MakeJson(const TArray<FString>& SortedPaths) const;
+	FString MakeMarkdown(const TArray<FString>& SortedPaths) const;
+
+	FString OutputDirectory;
+	FString IndexBaseName;
+
+	// Asset path -> entry
+	TMap<FString, FEntry> Blueprints;
+};
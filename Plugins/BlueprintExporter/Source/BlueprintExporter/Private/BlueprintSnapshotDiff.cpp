@@ -0,0 +1,617 @@
+// BlueprintSnapshotDiff.cpp
+
+#include "BlueprintSnapshotDiff.h"
+#include "BlueprintExporter.h"
+#include "BlueprintGraphAdapter.h"
+#include "BlueprintProjectIndex.h"
+#include "BlueprintSnapshotHash.h"
+#include "BlueprintSnapshotReader.h"
+#include "Dom/JsonObject.h"
+#include "GraphCore/BlueprintGraphDiff.h"
+#include "GraphCore/BlueprintGraphHash.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+static void AddFieldChange(TArray<FBlueprintFieldChange>& Changes, const TCHAR* Field, const FString& OldValue, const FString& NewValue)
+{
+	if (!OldValue.Equals(NewValue, ESearchCase::CaseSensitive))
+	{
+		Changes.Add({ Field, OldValue, NewValue });
+	}
+}
+
+/** Equal hashes mean equal content; 0 is an export without one, which has to be compared */
+static bool HashesMatch(uint64 OldHash, uint64 NewHash)
+{
+	return OldHash != 0 && OldHash == NewHash;
+}
+
+static bool ContainsConnection(const TArray<FBlueprintConnectionSnapshot>& Connections, const FBlueprintConnectionSnapshot& Connection)
+{
+	return Connections.ContainsByPredicate([&Connection](const FBlueprintConnectionSnapshot& Other)
+	{
+		return Other.Node.Equals(Connection.Node, ESearchCase::CaseSensitive) && Other.Pin.Equals(Connection.Pin, ESearchCase::CaseSensitive);
+	});
+}
+
+const TCHAR* FBlueprintSnapshotDiff::GetChangeName(EBlueprintDiffChange Change)
+{
+	switch (Change)
+	{
+	case EBlueprintDiffChange::Added:
+		return TEXT("added");
+	case EBlueprintDiffChange::Removed:
+		return TEXT("removed");
+	default:
+		return TEXT("changed");
+	}
+}
+
+// ============================================================================
+// Snapshots
+// ============================================================================
+
+bool FBlueprintSnapshotDiff::DiffSnapshots(const FBlueprintSnapshot& OldSnapshot, const FBlueprintSnapshot& NewSnapshot, FBlueprintDiff& OutDiff)
+{
+	OutDiff = FBlueprintDiff();
+	OutDiff.Name = NewSnapshot.Name;
+	OutDiff.Path = NewSnapshot.Path;
+	OutDiff.OldHash = OldSnapshot.Hash;
+	OutDiff.NewHash = NewSnapshot.Hash;
+
+	if (HashesMatch(OldSnapshot.Hash, NewSnapshot.Hash))
+	{
+		return false;
+	}
+
+	AddFieldChange(OutDiff.Fields, TEXT("parent_class"), OldSnapshot.ParentClass, NewSnapshot.ParentClass);
+	AddFieldChange(OutDiff.Fields, TEXT("generated_class"), OldSnapshot.GeneratedClass, NewSnapshot.GeneratedClass);
+
+	TMap<FString, int32> OldGraphIndices;
+	for (int32 GraphIndex = 0; GraphIndex < OldSnapshot.Graphs.Num(); ++GraphIndex)
+	{
+		OldGraphIndices.Add(OldSnapshot.Graphs[GraphIndex].Name, GraphIndex);
+	}
+
+	TBitArray<> OldGraphPaired(false, OldSnapshot.Graphs.Num());
+	for (const FBlueprintGraphSnapshot& NewGraph : NewSnapshot.Graphs)
+	{
+		const int32* OldGraphIndex = OldGraphIndices.Find(NewGraph.Name);
+		if (!OldGraphIndex)
+		{
+			FBlueprintGraphDiff& GraphDiff = OutDiff.Graphs.AddDefaulted_GetRef();
+			GraphDiff.Name = NewGraph.Name;
+			GraphDiff.Change = EBlueprintDiffChange::Added;
+			GraphDiff.NodeCount = NewGraph.Nodes.Num();
+			continue;
+		}
+
+		OldGraphPaired[*OldGraphIndex] = true;
+		const FBlueprintGraphSnapshot& OldGraph = OldSnapshot.Graphs[*OldGraphIndex];
+		if (HashesMatch(OldGraph.Hash, NewGraph.Hash))
+		{
+			continue;
+		}
+
+		FBlueprintGraphDiff GraphDiff;
+		DiffGraph(OldGraph, NewGraph, GraphDiff);
+		if (GraphDiff.Nodes.Num() > 0)
+		{
+			OutDiff.Graphs.Add(MoveTemp(GraphDiff));
+		}
+	}
+
+	for (int32 GraphIndex = 0; GraphIndex < OldSnapshot.Graphs.Num(); ++GraphIndex)
+	{
+		if (!OldGraphPaired[GraphIndex])
+		{
+			FBlueprintGraphDiff& GraphDiff = OutDiff.Graphs.AddDefaulted_GetRef();
+			GraphDiff.Name = OldSnapshot.Graphs[GraphIndex].Name;
+			GraphDiff.Change = EBlueprintDiffChange::Removed;
+			GraphDiff.NodeCount = OldSnapshot.Graphs[GraphIndex].Nodes.Num();
+		}
+	}
+
+	DiffMembers(OldSnapshot, NewSnapshot, OutDiff);
+	return OutDiff.HasChanges();
+}
+
+// ============================================================================
+// Graphs and nodes
+// ============================================================================
+
+void FBlueprintSnapshotDiff::DiffGraph(const FBlueprintGraphSnapshot& OldGraph, const FBlueprintGraphSnapshot& NewGraph, FBlueprintGraphDiff& OutDiff)
+{
+	OutDiff.Name = NewGraph.Name;
+	OutDiff.Change = EBlueprintDiffChange::Changed;
+	OutDiff.NodeCount = NewGraph.Nodes.Num();
+
+	// The keys view the UTF-8 ids, so every id is converted before any key is made
+	auto MakeKeys = [](const FBlueprintGraphSnapshot& Graph, std::vector<std::string>& OutIds)
+	{
+		OutIds.reserve(Graph.Nodes.Num());
+		for (const FBlueprintNodeSnapshot& Node : Graph.Nodes)
+		{
+			OutIds.push_back(FBlueprintGraphAdapter::ToUtf8(Node.Id));
+		}
+
+		std::vector<BlueprintGraph::FDiffNodeKey> Keys;
+		Keys.reserve(Graph.Nodes.Num());
+		for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); ++NodeIndex)
+		{
+			const FBlueprintNodeSnapshot& Node = Graph.Nodes[NodeIndex];
+			Keys.push_back({ OutIds[NodeIndex], Node.Hash, FBlueprintSnapshotHash::HashNodeShape(Node) });
+		}
+		return Keys;
+	};
+
+	std::vector<std::string> OldIds;
+	std::vector<std::string> NewIds;
+	const std::vector<BlueprintGraph::FDiffNodeKey> OldKeys = MakeKeys(OldGraph, OldIds);
+	const std::vector<BlueprintGraph::FDiffNodeKey> NewKeys = MakeKeys(NewGraph, NewIds);
+	const BlueprintGraph::FNodeMatching Matching = BlueprintGraph::MatchNodes(OldKeys, NewKeys);
+
+	TMap<FString, FString> RecreatedIds;
+	for (int32 NewIndex = 0; NewIndex < NewGraph.Nodes.Num(); ++NewIndex)
+	{
+		const int32 OldIndex = Matching.OldForNew[NewIndex];
+		if (OldIndex >= 0 && !OldGraph.Nodes[OldIndex].Id.Equals(NewGraph.Nodes[NewIndex].Id, ESearchCase::CaseSensitive))
+		{
+			RecreatedIds.Add(OldGraph.Nodes[OldIndex].Id, NewGraph.Nodes[NewIndex].Id);
+		}
+	}
+
+	for (int32 NewIndex = 0; NewIndex < NewGraph.Nodes.Num(); ++NewIndex)
+	{
+		const FBlueprintNodeSnapshot& NewNode = NewGraph.Nodes[NewIndex];
+		const int32 OldIndex = Matching.OldForNew[NewIndex];
+		if (OldIndex < 0)
+		{
+			FBlueprintNodeDiff& NodeDiff = OutDiff.Nodes.AddDefaulted_GetRef();
+			NodeDiff.Change = EBlueprintDiffChange::Added;
+			NodeDiff.Id = NewNode.Id;
+			NodeDiff.Type = NewNode.Type;
+			NodeDiff.Title = NewNode.Title;
+			for (const FBlueprintPinSnapshot& Pin : NewNode.Pins)
+			{
+				if (!Pin.DefaultValue.IsEmpty() || Pin.Connections.Num() > 0)
+				{
+					FBlueprintPinDiff& PinDiff = NodeDiff.Pins.AddDefaulted_GetRef();
+					PinDiff.Name = Pin.Name;
+					PinDiff.bIsInput = Pin.bIsInput;
+					PinDiff.Change = EBlueprintDiffChange::Added;
+					AddFieldChange(PinDiff.Fields, TEXT("default_value"), FString(), Pin.DefaultValue);
+					PinDiff.LinksAdded = Pin.Connections;
+				}
+			}
+			continue;
+		}
+
+		// Same hash: the node and its links are as they were, even if it was recreated under a new id
+		if (BlueprintGraph::IsUnchanged(OldKeys[OldIndex], NewKeys[NewIndex]))
+		{
+			++OutDiff.UnchangedNodeCount;
+			continue;
+		}
+
+		FBlueprintNodeDiff NodeDiff;
+		if (DiffNode(OldGraph.Nodes[OldIndex], NewNode, RecreatedIds, NodeDiff))
+		{
+			OutDiff.Nodes.Add(MoveTemp(NodeDiff));
+		}
+		else
+		{
+			++OutDiff.UnchangedNodeCount;
+		}
+	}
+
+	for (int32 OldIndex = 0; OldIndex < OldGraph.Nodes.Num(); ++OldIndex)
+	{
+		if (Matching.NewForOld[OldIndex] < 0)
+		{
+			const FBlueprintNodeSnapshot& OldNode = OldGraph.Nodes[OldIndex];
+			FBlueprintNodeDiff& NodeDiff = OutDiff.Nodes.AddDefaulted_GetRef();
+			NodeDiff.Change = EBlueprintDiffChange::Removed;
+			NodeDiff.Id = OldNode.Id;
+			NodeDiff.Type = OldNode.Type;
+			NodeDiff.Title = OldNode.Title;
+		}
+	}
+}
+
+bool FBlueprintSnapshotDiff::DiffNode(const FBlueprintNodeSnapshot& OldNode, const FBlueprintNodeSnapshot& NewNode, const TMap<FString, FString>& RecreatedIds,
+	FBlueprintNodeDiff& OutDiff)
+{
+	OutDiff.Change = EBlueprintDiffChange::Changed;
+	OutDiff.Id = NewNode.Id;
+	OutDiff.Type = NewNode.Type;
+	OutDiff.Title = NewNode.Title;
+	AddFieldChange(OutDiff.Fields, TEXT("id"), OldNode.Id, NewNode.Id);
+	AddFieldChange(OutDiff.Fields, TEXT("type"), OldNode.Type, NewNode.Type);
+	AddFieldChange(OutDiff.Fields, TEXT("title"), OldNode.Title, NewNode.Title);
+
+	// Old links as they would read in the new graph
+	auto GetOldConnections = [&RecreatedIds](const FBlueprintPinSnapshot& Pin)
+	{
+		TArray<FBlueprintConnectionSnapshot> Connections = Pin.Connections;
+		for (FBlueprintConnectionSnapshot& Connection : Connections)
+		{
+			if (const FString* NewId = RecreatedIds.Find(Connection.Node))
+			{
+				Connection.Node = *NewId;
+			}
+		}
+		return Connections;
+	};
+
+	// Nodes have a handful of pins, so pairing them by search is cheaper than a map
+	TBitArray<> OldPinPaired(false, OldNode.Pins.Num());
+	for (const FBlueprintPinSnapshot& NewPin : NewNode.Pins)
+	{
+		const int32 OldPinIndex = OldNode.Pins.IndexOfByPredicate([&NewPin](const FBlueprintPinSnapshot& OldPin)
+		{
+			return OldPin.bIsInput == NewPin.bIsInput && OldPin.Name.Equals(NewPin.Name, ESearchCase::CaseSensitive);
+		});
+
+		FBlueprintPinDiff PinDiff;
+		PinDiff.Name = NewPin.Name;
+		PinDiff.bIsInput = NewPin.bIsInput;
+		if (OldPinIndex == INDEX_NONE || OldPinPaired[OldPinIndex])
+		{
+			PinDiff.Change = EBlueprintDiffChange::Added;
+			AddFieldChange(PinDiff.Fields, TEXT("type"), FString(), NewPin.Type);
+			AddFieldChange(PinDiff.Fields, TEXT("default_value"), FString(), NewPin.DefaultValue);
+			PinDiff.LinksAdded = NewPin.Connections;
+			OutDiff.Pins.Add(MoveTemp(PinDiff));
+			continue;
+		}
+
+		OldPinPaired[OldPinIndex] = true;
+		const FBlueprintPinSnapshot& OldPin = OldNode.Pins[OldPinIndex];
+		AddFieldChange(PinDiff.Fields, TEXT("type"), OldPin.Type, NewPin.Type);
+		AddFieldChange(PinDiff.Fields, TEXT("default_value"), OldPin.DefaultValue, NewPin.DefaultValue);
+
+		// Links are a set: their order is the editor's, not the user's
+		const TArray<FBlueprintConnectionSnapshot> OldConnections = GetOldConnections(OldPin);
+		for (const FBlueprintConnectionSnapshot& Connection : NewPin.Connections)
+		{
+			if (!ContainsConnection(OldConnections, Connection))
+			{
+				PinDiff.LinksAdded.Add(Connection);
+			}
+		}
+		for (const FBlueprintConnectionSnapshot& Connection : OldConnections)
+		{
+			if (!ContainsConnection(NewPin.Connections, Connection))
+			{
+				PinDiff.LinksRemoved.Add(Connection);
+			}
+		}
+
+		if (PinDiff.Fields.Num() > 0 || PinDiff.LinksAdded.Num() > 0 || PinDiff.LinksRemoved.Num() > 0)
+		{
+			OutDiff.Pins.Add(MoveTemp(PinDiff));
+		}
+	}
+
+	for (int32 OldPinIndex = 0; OldPinIndex < OldNode.Pins.Num(); ++OldPinIndex)
+	{
+		if (!OldPinPaired[OldPinIndex])
+		{
+			const FBlueprintPinSnapshot& OldPin = OldNode.Pins[OldPinIndex];
+			FBlueprintPinDiff& PinDiff = OutDiff.Pins.AddDefaulted_GetRef();
+			PinDiff.Name = OldPin.Name;
+			PinDiff.bIsInput = OldPin.bIsInput;
+			PinDiff.Change = EBlueprintDiffChange::Removed;
+			PinDiff.LinksRemoved = GetOldConnections(OldPin);
+		}
+	}
+
+	// A new id alone is a node recreated unchanged (exports without hashes get here), not a change
+	const bool bOnlyIdChanged = OutDiff.Fields.Num() == 1 && OutDiff.Fields[0].Field == TEXT("id");
+	return OutDiff.Pins.Num() > 0 || (OutDiff.Fields.Num() > 0 && !bOnlyIdChanged);
+}
+
+// ============================================================================
+// Variables, functions and components
+// ============================================================================
+
+/** A variable, function or component as the diff sees it: a name and named values, in the same order for every member of a kind */
+struct FMemberValues
+{
+	FString Name;
+	TArray<TPair<const TCHAR*, FString>, TInlineAllocator<4>> Values;
+};
+
+static void DiffMemberLists(const TArray<FMemberValues>& OldMembers, const TArray<FMemberValues>& NewMembers, TArray<FBlueprintMemberDiff>& OutDiffs)
+{
+	TMap<FString, int32> OldIndices;
+	for (int32 Index = 0; Index < OldMembers.Num(); ++Index)
+	{
+		OldIndices.Add(OldMembers[Index].Name, Index);
+	}
+
+	TBitArray<> OldPaired(false, OldMembers.Num());
+	for (const FMemberValues& NewMember : NewMembers)
+	{
+		FBlueprintMemberDiff Diff;
+		Diff.Name = NewMember.Name;
+
+		const int32* OldIndex = OldIndices.Find(NewMember.Name);
+		if (!OldIndex)
+		{
+			Diff.Change = EBlueprintDiffChange::Added;
+			for (const TPair<const TCHAR*, FString>& Value : NewMember.Values)
+			{
+				AddFieldChange(Diff.Fields, Value.Key, FString(), Value.Value);
+			}
+			OutDiffs.Add(MoveTemp(Diff));
+			continue;
+		}
+
+		OldPaired[*OldIndex] = true;
+		const FMemberValues& OldMember = OldMembers[*OldIndex];
+		for (int32 ValueIndex = 0; ValueIndex < NewMember.Values.Num(); ++ValueIndex)
+		{
+			AddFieldChange(Diff.Fields, NewMember.Values[ValueIndex].Key, OldMember.Values[ValueIndex].Value, NewMember.Values[ValueIndex].Value);
+		}
+		if (Diff.Fields.Num() > 0)
+		{
+			OutDiffs.Add(MoveTemp(Diff));
+		}
+	}
+
+	for (int32 Index = 0; Index < OldMembers.Num(); ++Index)
+	{
+		if (!OldPaired[Index])
+		{
+			FBlueprintMemberDiff& Diff = OutDiffs.AddDefaulted_GetRef();
+			Diff.Name = OldMembers[Index].Name;
+			Diff.Change = EBlueprintDiffChange::Removed;
+		}
+	}
+}
+
+static TArray<FMemberValues> GetVariableValues(const FBlueprintSnapshot& Snapshot)
+{
+	TArray<FMemberValues> Members;
+	for (const FBlueprintVariableSnapshot& Variable : Snapshot.Variables)
+	{
+		FMemberValues& Member = Members.AddDefaulted_GetRef();
+		Member.Name = Variable.Name;
+		Member.Values.Add({ TEXT("type"), Variable.Type });
+		Member.Values.Add({ TEXT("category"), Variable.Category });
+		Member.Values.Add({ TEXT("is_exposed"), Variable.bIsExposed ? TEXT("true") : TEXT("false") });
+		Member.Values.Add({ TEXT("default_value"), Variable.DefaultValue });
+	}
+	return Members;
+}
+
+static TArray<FMemberValues> GetFunctionValues(const FBlueprintSnapshot& Snapshot)
+{
+	TArray<FMemberValues> Members;
+	for (const FBlueprintFunctionSnapshot& Function : Snapshot.Functions)
+	{
+		// "Name: Type, Name: Type", the signature as one value
+		FString Parameters;
+		for (const FBlueprintParameterSnapshot& Param : Function.Parameters)
+		{
+			if (!Parameters.IsEmpty())
+			{
+				Parameters += TEXT(", ");
+			}
+			Parameters += Param.Name;
+			Parameters += TEXT(": ");
+			Parameters += Param.Type;
+		}
+
+		FMemberValues& Member = Members.AddDefaulted_GetRef();
+		Member.Name = Function.Name;
+		Member.Values.Add({ TEXT("parameters"), MoveTemp(Parameters) });
+	}
+	return Members;
+}
+
+static TArray<FMemberValues> GetComponentValues(const FBlueprintSnapshot& Snapshot)
+{
+	TArray<FMemberValues> Members;
+	for (const FBlueprintComponentSnapshot& Component : Snapshot.Components)
+	{
+		FMemberValues& Member = Members.AddDefaulted_GetRef();
+		Member.Name = Component.Name;
+		Member.Values.Add({ TEXT("class"), Component.Class });
+	}
+	return Members;
+}
+
+void FBlueprintSnapshotDiff::DiffMembers(const FBlueprintSnapshot& OldSnapshot, const FBlueprintSnapshot& NewSnapshot, FBlueprintDiff& OutDiff)
+{
+	DiffMemberLists(GetVariableValues(OldSnapshot), GetVariableValues(NewSnapshot), OutDiff.Variables);
+	DiffMemberLists(GetFunctionValues(OldSnapshot), GetFunctionValues(NewSnapshot), OutDiff.Functions);
+	DiffMemberLists(GetComponentValues(OldSnapshot), GetComponentValues(NewSnapshot), OutDiff.Components);
+}
+
+// ============================================================================
+// Files and directories
+// ============================================================================
+
+bool FBlueprintSnapshotDiff::DiffFiles(const FString& OldFile, const FString& NewFile, FBlueprintExportDiff& OutDiff)
+{
+	OutDiff = FBlueprintExportDiff();
+	OutDiff.OldSource = OldFile;
+	OutDiff.NewSource = NewFile;
+
+	FBlueprintSnapshot OldSnapshot;
+	FBlueprintSnapshot NewSnapshot;
+	if (!FBlueprintSnapshotReader::LoadFile(OldFile, OldSnapshot) || !FBlueprintSnapshotReader::LoadFile(NewFile, NewSnapshot))
+	{
+		return false;
+	}
+
+	FBlueprintDiff Diff;
+	if (DiffSnapshots(OldSnapshot, NewSnapshot, Diff))
+	{
+		OutDiff.Blueprints.Add(MoveTemp(Diff));
+	}
+	else
+	{
+		OutDiff.UnchangedCount = 1;
+	}
+	return true;
+}
+
+/** What a project index lists of an exported blueprint */
+struct FIndexedBlueprint
+{
+	FString Name;
+	FString Hash;
+	// Its Markdown or data file, relative to the export directory
+	FString File;
+};
+
+/** Every blueprint the project indexes of an export directory list (one per shard); false if there are none */
+static bool LoadProjectIndexes(const FString& Directory, TMap<FString, FIndexedBlueprint>& OutBlueprints)
+{
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(Directory, FString(FBlueprintProjectIndex::BaseFileName) + TEXT("*.json")), true, false);
+
+	bool bLoaded = false;
+	for (const FString& FileName : FileNames)
+	{
+		const FString IndexPath = FPaths::Combine(Directory, FileName);
+		FString JsonString;
+		if (!FFileHelper::LoadFileToString(JsonString, *IndexPath))
+		{
+			UE_LOG(LogBlueprintExporter, Warning, TEXT("Ignoring unreadable project index: %s"), *IndexPath);
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> Root;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+		const TArray<TSharedPtr<FJsonValue>>* BlueprintValues;
+		if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("blueprints"), BlueprintValues))
+		{
+			UE_LOG(LogBlueprintExporter, Warning, TEXT("Ignoring unreadable project index: %s"), *IndexPath);
+			continue;
+		}
+
+		bLoaded = true;
+		for (const TSharedPtr<FJsonValue>& BlueprintValue : *BlueprintValues)
+		{
+			const TSharedPtr<FJsonObject> BlueprintObject = BlueprintValue->AsObject();
+			FString AssetPath;
+			if (!BlueprintObject.IsValid() || !BlueprintObject->TryGetStringField(TEXT("path"), AssetPath))
+			{
+				continue;
+			}
+
+			FIndexedBlueprint& Entry = OutBlueprints.Add(AssetPath);
+			BlueprintObject->TryGetStringField(TEXT("name"), Entry.Name);
+			BlueprintObject->TryGetStringField(TEXT("hash"), Entry.Hash);
+			BlueprintObject->TryGetStringField(TEXT("file"), Entry.File);
+		}
+	}
+	return bLoaded;
+}
+
+/** The JSON data file of an indexed blueprint, next to its Markdown; empty if it was exported to none */
+static FString GetJsonFile(const FString& Directory, const FIndexedBlueprint& Entry)
+{
+	if (Entry.File.EndsWith(TEXT(".md")))
+	{
+		return FPaths::Combine(Directory, FPaths::ChangeExtension(Entry.File, TEXT("json")));
+	}
+	if (Entry.File.EndsWith(TEXT(".json")))
+	{
+		return FPaths::Combine(Directory, Entry.File);
+	}
+	return FString();
+}
+
+bool FBlueprintSnapshotDiff::DiffDirectories(const FString& OldDirectory, const FString& NewDirectory, FBlueprintExportDiff& OutDiff)
+{
+	OutDiff = FBlueprintExportDiff();
+	OutDiff.OldSource = OldDirectory;
+	OutDiff.NewSource = NewDirectory;
+
+	TMap<FString, FIndexedBlueprint> OldBlueprints;
+	TMap<FString, FIndexedBlueprint> NewBlueprints;
+	if (!LoadProjectIndexes(OldDirectory, OldBlueprints) || !LoadProjectIndexes(NewDirectory, NewBlueprints))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Comparing export directories needs the project index (index.json) of both: %s, %s"), *OldDirectory, *NewDirectory);
+		return false;
+	}
+
+	TArray<FString> Paths;
+	OldBlueprints.GetKeys(Paths);
+	for (const TPair<FString, FIndexedBlueprint>& Pair : NewBlueprints)
+	{
+		if (!OldBlueprints.Contains(Pair.Key))
+		{
+			Paths.Add(Pair.Key);
+		}
+	}
+	Paths.Sort();
+
+	for (const FString& Path : Paths)
+	{
+		const FIndexedBlueprint* OldEntry = OldBlueprints.Find(Path);
+		const FIndexedBlueprint* NewEntry = NewBlueprints.Find(Path);
+		if (!OldEntry || !NewEntry)
+		{
+			FBlueprintDiff& Diff = OutDiff.Blueprints.AddDefaulted_GetRef();
+			Diff.Name = OldEntry ? OldEntry->Name : NewEntry->Name;
+			Diff.Path = Path;
+			Diff.Change = OldEntry ? EBlueprintDiffChange::Removed : EBlueprintDiffChange::Added;
+			uint64_t Hash = 0;
+			BlueprintGraph::ParseHash(FBlueprintGraphAdapter::ToUtf8(OldEntry ? OldEntry->Hash : NewEntry->Hash), Hash);
+			if (OldEntry)
+			{
+				Diff.OldHash = Hash;
+			}
+			else
+			{
+				Diff.NewHash = Hash;
+			}
+			continue;
+		}
+
+		// The index holds the root of each blueprint's hash tree: equal roots, nothing to open
+		if (!OldEntry->Hash.IsEmpty() && OldEntry->Hash.Equals(NewEntry->Hash))
+		{
+			++OutDiff.UnchangedCount;
+			continue;
+		}
+
+		const FString OldFile = GetJsonFile(OldDirectory, *OldEntry);
+		const FString NewFile = GetJsonFile(NewDirectory, *NewEntry);
+		FBlueprintSnapshot OldSnapshot;
+		FBlueprintSnapshot NewSnapshot;
+		if (OldFile.IsEmpty() || NewFile.IsEmpty() || !FPaths::FileExists(OldFile) || !FPaths::FileExists(NewFile)
+			|| !FBlueprintSnapshotReader::LoadFile(OldFile, OldSnapshot) || !FBlueprintSnapshotReader::LoadFile(NewFile, NewSnapshot))
+		{
+			OutDiff.Skipped.Add(Path);
+			continue;
+		}
+
+		FBlueprintDiff Diff;
+		if (DiffSnapshots(OldSnapshot, NewSnapshot, Diff))
+		{
+			OutDiff.Blueprints.Add(MoveTemp(Diff));
+		}
+		else
+		{
+			++OutDiff.UnchangedCount;
+		}
+	}
+
+	if (OutDiff.Skipped.Num() > 0)
+	{
+		UE_LOG(LogBlueprintExporter, Warning, TEXT("Diff skipped %d changed blueprints without a readable JSON export (MessagePack and bundle exports aren't compared)"),
+			OutDiff.Skipped.Num());
+	}
+	return true;
+}
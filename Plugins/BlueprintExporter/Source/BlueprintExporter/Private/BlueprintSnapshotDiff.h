@@ -0,0 +1,153 @@
+// BlueprintSnapshotDiff.h
+// Semantic diff of blueprint exports: what was added, removed and changed, not which lines moved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintExportTypes.h"
+
+enum class EBlueprintDiffChange : uint8
+{
+	Added,
+	Removed,
+	Changed
+};
+
+/** A field with another value, e.g. a pin's "default_value"; added entries have an empty OldValue */
+struct FBlueprintFieldChange
+{
+	FString Field;
+	FString OldValue;
+	FString NewValue;
+};
+
+struct FBlueprintPinDiff
+{
+	FString Name;
+	bool bIsInput = false;
+	EBlueprintDiffChange Change = EBlueprintDiffChange::Changed;
+	TArray<FBlueprintFieldChange> Fields;
+
+	// Links made and broken; a link to a node that was only recreated under a new id is neither
+	TArray<FBlueprintConnectionSnapshot> LinksAdded;
+	TArray<FBlueprintConnectionSnapshot> LinksRemoved;
+};
+
+struct FBlueprintNodeDiff
+{
+	EBlueprintDiffChange Change = EBlueprintDiffChange::Changed;
+	// The new id; the old one for removed nodes ("id" in Fields when it changed)
+	FString Id;
+	FString Type;
+	FString Title;
+	TArray<FBlueprintFieldChange> Fields;
+
+	// Changed pins; for added nodes, their pins with a default value or links
+	TArray<FBlueprintPinDiff> Pins;
+};
+
+struct FBlueprintGraphDiff
+{
+	FString Name;
+	EBlueprintDiffChange Change = EBlueprintDiffChange::Changed;
+	// Nodes of the graph, the old one if it was removed
+	int32 NodeCount = 0;
+	int32 UnchangedNodeCount = 0;
+
+	// Added, removed and changed nodes of a changed graph, new ones in graph order, then removed ones
+	TArray<FBlueprintNodeDiff> Nodes;
+};
+
+/** A variable, function or component; added ones list their values as Fields */
+struct FBlueprintMemberDiff
+{
+	FString Name;
+	EBlueprintDiffChange Change = EBlueprintDiffChange::Changed;
+	TArray<FBlueprintFieldChange> Fields;
+};
+
+struct FBlueprintDiff
+{
+	FString Name;
+	FString Path;
+	EBlueprintDiffChange Change = EBlueprintDiffChange::Changed;
+	// 0 on the side a blueprint was added or removed on
+	uint64 OldHash = 0;
+	uint64 NewHash = 0;
+
+	// parent_class, generated_class
+	TArray<FBlueprintFieldChange> Fields;
+	TArray<FBlueprintGraphDiff> Graphs;
+	TArray<FBlueprintMemberDiff> Variables;
+	TArray<FBlueprintMemberDiff> Functions;
+	TArray<FBlueprintMemberDiff> Components;
+
+	bool HasChanges() const
+	{
+		return Change != EBlueprintDiffChange::Changed || Fields.Num() > 0 || Graphs.Num() > 0
+			|| Variables.Num() > 0 || Functions.Num() > 0 || Components.Num() > 0;
+	}
+};
+
+/** Diff of two exports of a blueprint, or of every blueprint in two export directories */
+struct FBlueprintExportDiff
+{
+	// As given: files or directories
+	FString OldSource;
+	FString NewSource;
+
+	// Added, removed and changed blueprints, by path
+	TArray<FBlueprintDiff> Blueprints;
+	int32 UnchangedCount = 0;
+
+	// Blueprints in both exports whose files couldn't be read (MessagePack, bundle or missing), by path
+	TArray<FString> Skipped;
+};
+
+/**
+ * Compares blueprint exports by content rather than by text
+ *
+ * Graphs, variables, functions and components are paired by name; nodes by id, then by hash
+ * (recreated unchanged), then by type and title (recreated and edited), see
+ * BlueprintGraph::MatchNodes; pins by name and direction. The structural hashes are compared
+ * before anything else: equal blueprint and graph hashes skip the whole blueprint or graph,
+ * and a paired node whose hash is unchanged is never looked into, whatever its id. Only nodes whose hash
+ * changed are compared field by field, so the cost follows the size of the change rather than
+ * of the blueprint. Node order never counts, and links to a node recreated under a new id are
+ * followed to it, so neither moving nor recreating nodes shows up as a change by itself.
+ */
+class FBlueprintSnapshotDiff
+{
+public:
+	/**
+	 * Compare two snapshots of a blueprint
+	 * @return True if they differ
+	 */
+	static bool DiffSnapshots(const FBlueprintSnapshot& OldSnapshot, const FBlueprintSnapshot& NewSnapshot, FBlueprintDiff& OutDiff);
+
+	/** Compare two exported JSON files of a blueprint; false if either couldn't be read */
+	static bool DiffFiles(const FString& OldFile, const FString& NewFile, FBlueprintExportDiff& OutDiff);
+
+	/**
+	 * Compare every blueprint of two export directories, as listed by their project indexes
+	 * (index.json, or every shard's); blueprints with the same hash in both aren't opened.
+	 * @return False if either directory has no project index
+	 */
+	static bool DiffDirectories(const FString& OldDirectory, const FString& NewDirectory, FBlueprintExportDiff& OutDiff);
+
+	/** "added", "removed" or "changed" */
+	static const TCHAR* GetChangeName(EBlueprintDiffChange Change);
+
+private:
+	static void DiffGraph(const FBlueprintGraphSnapshot& OldGraph, const FBlueprintGraphSnapshot& NewGraph, FBlueprintGraphDiff& OutDiff);
+
+	/**
+	 * Compare two nodes the matching paired
+	 * @param RecreatedIds - Old id -> new id of the graph's nodes that were paired across a new id
+	 * @return True if they differ
+	 */
+	static bool DiffNode(const FBlueprintNodeSnapshot& OldNode, const FBlueprintNodeSnapshot& NewNode, const TMap<FString, FString>& RecreatedIds,
+		FBlueprintNodeDiff& OutDiff);
+
+	static void DiffMembers(const FBlueprintSnapshot& OldSnapshot, const FBlueprintSnapshot& NewSnapshot, FBlueprintDiff& OutDiff);
+};
@@ -0,0 +1,130 @@
+// BlueprintSnapshotHash.cpp
+
+#include "BlueprintSnapshotHash.h"
+#include "GraphCore/BlueprintGraphHash.h"
+
+/** FStructuralHash on the UTF-8 of FStrings, without a heap allocation for short ones */
+class FSnapshotHasher
+{
+public:
+	void Add(const FString& String)
+	{
+		const FTCHARToUTF8 Utf8(*String, String.Len());
+		Hash.AddString(std::string_view(Utf8.Get(), Utf8.Length()));
+	}
+
+	void Add(int64 Value) { Hash.AddInteger(Value); }
+	void Add(bool bValue) { Hash.AddBool(bValue); }
+	void AddHash(uint64 Value) { Hash.AddHash(Value); }
+
+	uint64 Finish() const { return Hash.Finish(); }
+
+private:
+	BlueprintGraph::FStructuralHash Hash;
+};
+
+uint64 FBlueprintSnapshotHash::HashNode(const FBlueprintNodeSnapshot& Node)
+{
+	FSnapshotHasher Hasher;
+	Hasher.Add(Node.Type);
+	Hasher.Add(Node.Title);
+	Hasher.Add(Node.Symbol);
+
+	Hasher.Add(static_cast<int64>(Node.Pins.Num()));
+	for (const FBlueprintPinSnapshot& Pin : Node.Pins)
+	{
+		Hasher.Add(Pin.Name);
+		Hasher.Add(Pin.bIsInput);
+		Hasher.Add(Pin.Type);
+		Hasher.Add(Pin.DefaultValue);
+		Hasher.Add(Pin.bHasLinks);
+
+		Hasher.Add(static_cast<int64>(Pin.Connections.Num()));
+		for (const FBlueprintConnectionSnapshot& Connection : Pin.Connections)
+		{
+			Hasher.Add(Connection.Node);
+			Hasher.Add(Connection.Pin);
+		}
+	}
+	return Hasher.Finish();
+}
+
+uint64 FBlueprintSnapshotHash::HashNodeShape(const FBlueprintNodeSnapshot& Node)
+{
+	FSnapshotHasher Hasher;
+	Hasher.Add(Node.Type);
+	Hasher.Add(Node.Title);
+	return Hasher.Finish();
+}
+
+void FBlueprintSnapshotHash::UpdateGraph(FBlueprintGraphSnapshot& Graph)
+{
+	FSnapshotHasher Hasher;
+	Hasher.Add(Graph.Name);
+
+	Hasher.Add(static_cast<int64>(Graph.Nodes.Num()));
+	for (FBlueprintNodeSnapshot& Node : Graph.Nodes)
+	{
+		Node.Hash = HashNode(Node);
+		Hasher.Add(Node.Id);
+		Hasher.AddHash(Node.Hash);
+	}
+	Graph.Hash = Hasher.Finish();
+}
+
+uint64 FBlueprintSnapshotHash::HashBlueprint(const FBlueprintSnapshot& Snapshot)
+{
+	FSnapshotHasher Hasher;
+	Hasher.Add(Snapshot.Name);
+	Hasher.Add(Snapshot.Path);
+	Hasher.Add(Snapshot.ParentClass);
+	Hasher.Add(Snapshot.GeneratedClass);
+
+	Hasher.Add(static_cast<int64>(Snapshot.Graphs.Num()));
+	for (const FBlueprintGraphSnapshot& Graph : Snapshot.Graphs)
+	{
+		Hasher.AddHash(Graph.Hash);
+	}
+
+	Hasher.Add(static_cast<int64>(Snapshot.Variables.Num()));
+	for (const FBlueprintVariableSnapshot& Variable : Snapshot.Variables)
+	{
+		Hasher.Add(Variable.Name);
+		Hasher.Add(Variable.Type);
+		Hasher.Add(Variable.Category);
+		Hasher.Add(Variable.bIsExposed);
+		Hasher.Add(Variable.DefaultValue);
+	}
+
+	Hasher.Add(static_cast<int64>(Snapshot.Functions.Num()));
+	for (const FBlueprintFunctionSnapshot& Function : Snapshot.Functions)
+	{
+		Hasher.Add(Function.Name);
+		Hasher.Add(static_cast<int64>(Function.Parameters.Num()));
+		for (const FBlueprintParameterSnapshot& Param : Function.Parameters)
+		{
+			Hasher.Add(Param.Name);
+			Hasher.Add(Param.Type);
+		}
+		Hasher.Add(static_cast<int64>(Function.GraphIndex));
+	}
+
+	Hasher.Add(static_cast<int64>(Snapshot.Components.Num()));
+	for (const FBlueprintComponentSnapshot& Component : Snapshot.Components)
+	{
+		Hasher.Add(Component.Name);
+		Hasher.Add(Component.Class);
+	}
+
+	Hasher.Add(static_cast<int64>(Snapshot.Dependencies.Num()));
+	for (const FString& Dependency : Snapshot.Dependencies)
+	{
+		Hasher.Add(Dependency);
+	}
+	return Hasher.Finish();
+}
+
+FString FBlueprintSnapshotHash::ToString(uint64 Hash)
+{
+	return FString::Printf(TEXT("%016llx"), Hash);
+}
@@ -0,0 +1,38 @@
+// BlueprintSnapshotHash.h
+// Merkle-style structural hashes of a snapshot: per node, rolled up per graph and per blueprint
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintExportTypes.h"
+
+/**
+ * Fills in the Hash fields of a snapshot (BlueprintGraph::FStructuralHash over UTF-8 fields)
+ *
+ * - Node: type, title, symbol and each pin's name, direction, type, default value and
+ *   resolved connections (node id and pin), in pin order. The node's own id is left out,
+ *   so a node that was deleted and recreated with the same content and links hashes the same.
+ * - Graph: name, then the id and hash of each node in export order.
+ * - Blueprint: name, path and classes, the graph hashes, variables, functions, components
+ *   and dependencies: everything the export writes, so two captures with the same hash
+ *   export to the same files under the same settings.
+ *
+ * Consumers compare hashes to skip unchanged blueprints, graphs and nodes without reading them.
+ */
+class FBlueprintSnapshotHash
+{
+public:
+	static uint64 HashNode(const FBlueprintNodeSnapshot& Node);
+
+	/** Type and title: what the diff pairs a node recreated under a new id by, after its hash */
+	static uint64 HashNodeShape(const FBlueprintNodeSnapshot& Node);
+
+	/** Hash each node of the graph, then the graph */
+	static void UpdateGraph(FBlueprintGraphSnapshot& Graph);
+
+	/** The blueprint hash; its graphs must be hashed already (see UpdateGraph) */
+	static uint64 HashBlueprint(const FBlueprintSnapshot& Snapshot);
+
+	/** 16 lowercase hex digits, as the export writes hashes */
+	static FString ToString(uint64 Hash);
+};
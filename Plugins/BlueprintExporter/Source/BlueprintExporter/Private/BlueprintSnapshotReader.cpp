@@ -0,0 +1,350 @@
+// BlueprintSnapshotReader.cpp
+
+#include "BlueprintSnapshotReader.h"
+#include "BlueprintExporter.h"
+#include "BlueprintGraphAdapter.h"
+#include "BlueprintSnapshotHash.h"
+#include "Dom/JsonObject.h"
+#include "GraphCore/BlueprintGraphHash.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+/** A hash as the export writes it; false if Text isn't one */
+static bool ParseHash(const FString& Text, uint64& OutHash)
+{
+	uint64_t Hash = 0;
+	if (!BlueprintGraph::ParseHash(FBlueprintGraphAdapter::ToUtf8(Text), Hash))
+	{
+		return false;
+	}
+	OutHash = Hash;
+	return true;
+}
+
+static const TArray<TSharedPtr<FJsonValue>>& GetArray(const FJsonObject& Object, const TCHAR* Field)
+{
+	static const TArray<TSharedPtr<FJsonValue>> Empty;
+	const TArray<TSharedPtr<FJsonValue>>* Values;
+	return Object.TryGetArrayField(Field, Values) ? *Values : Empty;
+}
+
+/** Element of a JSON array as an integer, or Default if it is missing or not a number */
+static int32 GetInteger(const TArray<TSharedPtr<FJsonValue>>& Values, int32 Index, int32 Default = INDEX_NONE)
+{
+	double Number = 0.0;
+	return Values.IsValidIndex(Index) && Values[Index].IsValid() && Values[Index]->TryGetNumber(Number) ? static_cast<int32>(Number) : Default;
+}
+
+/** Entry of a compact string table; out-of-range indices read as the empty string */
+static const FString& GetString(const TArray<FString>& Strings, int32 Index)
+{
+	static const FString Empty;
+	return Strings.IsValidIndex(Index) ? Strings[Index] : Empty;
+}
+
+bool FBlueprintSnapshotReader::LoadFile(const FString& FilePath, FBlueprintSnapshot& OutSnapshot)
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to read blueprint export: %s"), *FilePath);
+		return false;
+	}
+
+	if (!ReadJson(JsonString, OutSnapshot))
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Not a blueprint export: %s"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+bool FBlueprintSnapshotReader::ReadJson(const FString& JsonString, FBlueprintSnapshot& OutSnapshot)
+{
+	OutSnapshot = FBlueprintSnapshot();
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid()
+		|| !Root->TryGetStringField(TEXT("name"), OutSnapshot.Name)
+		|| !Root->TryGetStringField(TEXT("path"), OutSnapshot.Path))
+	{
+		return false;
+	}
+
+	Root->TryGetStringField(TEXT("parent_class"), OutSnapshot.ParentClass);
+	Root->TryGetStringField(TEXT("generated_class"), OutSnapshot.GeneratedClass);
+
+	int32 SchemaVersion = 1;
+	Root->TryGetNumberField(TEXT("schema_version"), SchemaVersion);
+	if (SchemaVersion == 3)
+	{
+		ReadCompactGraphs(*Root, OutSnapshot.Graphs);
+	}
+	else
+	{
+		for (const TSharedPtr<FJsonValue>& GraphValue : GetArray(*Root, TEXT("graphs")))
+		{
+			const TSharedPtr<FJsonObject>* GraphObject;
+			if (GraphValue->TryGetObject(GraphObject))
+			{
+				ReadGraph(**GraphObject, OutSnapshot.Graphs.AddDefaulted_GetRef());
+			}
+		}
+	}
+
+	for (const TSharedPtr<FJsonValue>& VariableValue : GetArray(*Root, TEXT("variables")))
+	{
+		const TSharedPtr<FJsonObject>* VariableObject;
+		if (VariableValue->TryGetObject(VariableObject))
+		{
+			FBlueprintVariableSnapshot& Variable = OutSnapshot.Variables.AddDefaulted_GetRef();
+			(*VariableObject)->TryGetStringField(TEXT("name"), Variable.Name);
+			(*VariableObject)->TryGetStringField(TEXT("type"), Variable.Type);
+			(*VariableObject)->TryGetStringField(TEXT("category"), Variable.Category);
+			(*VariableObject)->TryGetBoolField(TEXT("is_exposed"), Variable.bIsExposed);
+			(*VariableObject)->TryGetStringField(TEXT("default_value"), Variable.DefaultValue);
+		}
+	}
+
+	// Graph names are unique, so functions find their graph by name in every schema
+	for (const TSharedPtr<FJsonValue>& FunctionValue : GetArray(*Root, TEXT("functions")))
+	{
+		const TSharedPtr<FJsonObject>* FunctionObject;
+		if (!FunctionValue->TryGetObject(FunctionObject))
+		{
+			continue;
+		}
+
+		FBlueprintFunctionSnapshot& Function = OutSnapshot.Functions.AddDefaulted_GetRef();
+		(*FunctionObject)->TryGetStringField(TEXT("name"), Function.Name);
+		for (const TSharedPtr<FJsonValue>& ParamValue : GetArray(**FunctionObject, TEXT("parameters")))
+		{
+			const TSharedPtr<FJsonObject>* ParamObject;
+			if (ParamValue->TryGetObject(ParamObject))
+			{
+				FBlueprintParameterSnapshot& Param = Function.Parameters.AddDefaulted_GetRef();
+				(*ParamObject)->TryGetStringField(TEXT("name"), Param.Name);
+				(*ParamObject)->TryGetStringField(TEXT("type"), Param.Type);
+			}
+		}
+
+		FString GraphName;
+		const TSharedPtr<FJsonObject>* GraphObject;
+		if (!(*FunctionObject)->TryGetStringField(TEXT("graph_id"), GraphName) && (*FunctionObject)->TryGetObjectField(TEXT("graph"), GraphObject))
+		{
+			(*GraphObject)->TryGetStringField(TEXT("name"), GraphName);
+		}
+		if (!GraphName.IsEmpty())
+		{
+			Function.GraphIndex = OutSnapshot.Graphs.IndexOfByPredicate([&GraphName](const FBlueprintGraphSnapshot& Graph)
+			{
+				return Graph.Name.Equals(GraphName, ESearchCase::CaseSensitive);
+			});
+		}
+	}
+
+	for (const TSharedPtr<FJsonValue>& ComponentValue : GetArray(*Root, TEXT("components")))
+	{
+		const TSharedPtr<FJsonObject>* ComponentObject;
+		if (ComponentValue->TryGetObject(ComponentObject))
+		{
+			FBlueprintComponentSnapshot& Component = OutSnapshot.Components.AddDefaulted_GetRef();
+			(*ComponentObject)->TryGetStringField(TEXT("name"), Component.Name);
+			(*ComponentObject)->TryGetStringField(TEXT("class"), Component.Class);
+		}
+	}
+
+	for (const TSharedPtr<FJsonValue>& DependencyValue : GetArray(*Root, TEXT("dependencies")))
+	{
+		OutSnapshot.Dependencies.Add(DependencyValue->AsString());
+	}
+
+	// Exports from before the hashes were written: hash what was read instead
+	FString HashString;
+	if (!Root->TryGetStringField(TEXT("hash"), HashString) || !ParseHash(HashString, OutSnapshot.Hash))
+	{
+		for (FBlueprintGraphSnapshot& Graph : OutSnapshot.Graphs)
+		{
+			FBlueprintSnapshotHash::UpdateGraph(Graph);
+		}
+		OutSnapshot.Hash = FBlueprintSnapshotHash::HashBlueprint(OutSnapshot);
+	}
+	return true;
+}
+
+void FBlueprintSnapshotReader::ReadGraph(const FJsonObject& GraphObject, FBlueprintGraphSnapshot& OutGraph)
+{
+	GraphObject.TryGetStringField(TEXT("name"), OutGraph.Name);
+
+	FString HashString;
+	if (GraphObject.TryGetStringField(TEXT("hash"), HashString))
+	{
+		ParseHash(HashString, OutGraph.Hash);
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>& NodeValues = GetArray(GraphObject, TEXT("nodes"));
+	OutGraph.Nodes.Reserve(NodeValues.Num());
+	for (const TSharedPtr<FJsonValue>& NodeValue : NodeValues)
+	{
+		const TSharedPtr<FJsonObject>* NodeObject;
+		if (NodeValue->TryGetObject(NodeObject))
+		{
+			ReadNode(**NodeObject, OutGraph.Nodes.AddDefaulted_GetRef());
+		}
+	}
+}
+
+void FBlueprintSnapshotReader::ReadNode(const FJsonObject& NodeObject, FBlueprintNodeSnapshot& OutNode)
+{
+	NodeObject.TryGetStringField(TEXT("id"), OutNode.Id);
+	NodeObject.TryGetStringField(TEXT("type"), OutNode.Type);
+	NodeObject.TryGetStringField(TEXT("title"), OutNode.Title);
+
+	FString HashString;
+	if (NodeObject.TryGetStringField(TEXT("hash"), HashString))
+	{
+		ParseHash(HashString, OutNode.Hash);
+	}
+
+	for (const TSharedPtr<FJsonValue>& PinValue : GetArray(NodeObject, TEXT("pins")))
+	{
+		const TSharedPtr<FJsonObject>* PinObject;
+		if (!PinValue->TryGetObject(PinObject))
+		{
+			continue;
+		}
+
+		FBlueprintPinSnapshot& Pin = OutNode.Pins.AddDefaulted_GetRef();
+		(*PinObject)->TryGetStringField(TEXT("name"), Pin.Name);
+		FString Direction;
+		(*PinObject)->TryGetStringField(TEXT("direction"), Direction);
+		Pin.bIsInput = Direction.Equals(TEXT("input"));
+		(*PinObject)->TryGetStringField(TEXT("type"), Pin.Type);
+		(*PinObject)->TryGetStringField(TEXT("default_value"), Pin.DefaultValue);
+
+		// "to" is there whenever the pin had links, even if none resolved
+		const TArray<TSharedPtr<FJsonValue>>* ConnectionValues;
+		Pin.bHasLinks = (*PinObject)->TryGetArrayField(TEXT("to"), ConnectionValues);
+		if (Pin.bHasLinks)
+		{
+			for (const TSharedPtr<FJsonValue>& ConnectionValue : *ConnectionValues)
+			{
+				const TSharedPtr<FJsonObject>* ConnectionObject;
+				if (ConnectionValue->TryGetObject(ConnectionObject))
+				{
+					FBlueprintConnectionSnapshot& Connection = Pin.Connections.AddDefaulted_GetRef();
+					(*ConnectionObject)->TryGetStringField(TEXT("node"), Connection.Node);
+					(*ConnectionObject)->TryGetStringField(TEXT("pin"), Connection.Pin);
+				}
+			}
+		}
+	}
+}
+
+void FBlueprintSnapshotReader::ReadCompactGraphs(const FJsonObject& Root, TArray<FBlueprintGraphSnapshot>& OutGraphs)
+{
+	TArray<FString> Strings;
+	for (const TSharedPtr<FJsonValue>& StringValue : GetArray(Root, TEXT("strings")))
+	{
+		Strings.Add(StringValue->AsString());
+	}
+
+	for (const TSharedPtr<FJsonValue>& GraphValue : GetArray(Root, TEXT("graphs")))
+	{
+		const TSharedPtr<FJsonObject>* GraphObject;
+		if (!GraphValue->TryGetObject(GraphObject))
+		{
+			continue;
+		}
+
+		FBlueprintGraphSnapshot& Graph = OutGraphs.AddDefaulted_GetRef();
+		(*GraphObject)->TryGetStringField(TEXT("name"), Graph.Name);
+
+		FString HashString;
+		if ((*GraphObject)->TryGetStringField(TEXT("hash"), HashString))
+		{
+			ParseHash(HashString, Graph.Hash);
+		}
+
+		// [id, type, title, pins, hash]; links name nodes and pins by index, so every pin is read before any link
+		const TArray<TSharedPtr<FJsonValue>>& NodeValues = GetArray(**GraphObject, TEXT("nodes"));
+		TArray<const TArray<TSharedPtr<FJsonValue>>*> PinLists;
+		Graph.Nodes.Reserve(NodeValues.Num());
+		PinLists.Reserve(NodeValues.Num());
+		for (const TSharedPtr<FJsonValue>& NodeValue : NodeValues)
+		{
+			// A malformed node still takes its place, so the indices of the ones after it hold
+			FBlueprintNodeSnapshot& Node = Graph.Nodes.AddDefaulted_GetRef();
+			const TArray<TSharedPtr<FJsonValue>>* Fields;
+			if (!NodeValue->TryGetArray(Fields))
+			{
+				PinLists.Add(nullptr);
+				continue;
+			}
+
+			Node.Id = GetString(Strings, GetInteger(*Fields, 0));
+			Node.Type = GetString(Strings, GetInteger(*Fields, 1));
+			Node.Title = GetString(Strings, GetInteger(*Fields, 2));
+			if (Fields->IsValidIndex(4))
+			{
+				ParseHash((*Fields)[4]->AsString(), Node.Hash);
+			}
+
+			const TArray<TSharedPtr<FJsonValue>>* PinValues = nullptr;
+			if (Fields->IsValidIndex(3))
+			{
+				(*Fields)[3]->TryGetArray(PinValues);
+			}
+			PinLists.Add(PinValues);
+
+			// [name, direction (0 = input), type, default?, to?]
+			for (int32 PinIndex = 0; PinValues && PinIndex < PinValues->Num(); ++PinIndex)
+			{
+				const TArray<TSharedPtr<FJsonValue>>* PinFields;
+				FBlueprintPinSnapshot& Pin = Node.Pins.AddDefaulted_GetRef();
+				if ((*PinValues)[PinIndex]->TryGetArray(PinFields))
+				{
+					Pin.Name = GetString(Strings, GetInteger(*PinFields, 0));
+					Pin.bIsInput = GetInteger(*PinFields, 1) == 0;
+					Pin.Type = GetString(Strings, GetInteger(*PinFields, 2));
+					Pin.DefaultValue = GetString(Strings, GetInteger(*PinFields, 3, 0));
+					Pin.bHasLinks = PinFields->IsValidIndex(4);
+				}
+			}
+		}
+
+		// Flat [node, pin, ...] indices into the graph, or [-1 - node name, pin name] string indices for links outside it
+		for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); ++NodeIndex)
+		{
+			for (int32 PinIndex = 0; PinLists[NodeIndex] && PinIndex < Graph.Nodes[NodeIndex].Pins.Num(); ++PinIndex)
+			{
+				FBlueprintPinSnapshot& Pin = Graph.Nodes[NodeIndex].Pins[PinIndex];
+				const TArray<TSharedPtr<FJsonValue>>* PinFields;
+				const TArray<TSharedPtr<FJsonValue>>* Links;
+				if (!Pin.bHasLinks || !(*PinLists[NodeIndex])[PinIndex]->TryGetArray(PinFields) || !(*PinFields)[4]->TryGetArray(Links))
+				{
+					continue;
+				}
+
+				for (int32 LinkIndex = 0; LinkIndex + 1 < Links->Num(); LinkIndex += 2)
+				{
+					const int32 TargetNode = GetInteger(*Links, LinkIndex);
+					const int32 TargetPin = GetInteger(*Links, LinkIndex + 1);
+					FBlueprintConnectionSnapshot& Connection = Pin.Connections.AddDefaulted_GetRef();
+					if (TargetNode < 0)
+					{
+						Connection.Node = GetString(Strings, -1 - TargetNode);
+						Connection.Pin = GetString(Strings, TargetPin);
+					}
+					else if (Graph.Nodes.IsValidIndex(TargetNode) && Graph.Nodes[TargetNode].Pins.IsValidIndex(TargetPin))
+					{
+						Connection.Node = Graph.Nodes[TargetNode].Id;
+						Connection.Pin = Graph.Nodes[TargetNode].Pins[TargetPin].Name;
+					}
+				}
+			}
+		}
+	}
+}
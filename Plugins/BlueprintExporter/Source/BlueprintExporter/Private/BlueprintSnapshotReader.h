@@ -0,0 +1,36 @@
+// BlueprintSnapshotReader.h
+// Reads a blueprint's JSON export back into a snapshot
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintExportTypes.h"
+
+class FJsonObject;
+
+/**
+ * Reads the JSON a blueprint was exported to, in any schema (1, 2 or the compact 3), back
+ * into a snapshot, so earlier exports can be compared with each other or with a fresh capture
+ *
+ * Everything the JSON holds comes back. What it doesn't hold stays empty: the package name
+ * and the node symbols. Hashes are read from the file; exports from before they were written
+ * (format version 3 and older) get them computed, which gives other values than a capture
+ * would, since a capture also hashes the symbols. They still compare equal between two such
+ * exports.
+ *
+ * MessagePack files and bundle records aren't read.
+ */
+class FBlueprintSnapshotReader
+{
+public:
+	static bool LoadFile(const FString& FilePath, FBlueprintSnapshot& OutSnapshot);
+
+	static bool ReadJson(const FString& JsonString, FBlueprintSnapshot& OutSnapshot);
+
+private:
+	static void ReadGraph(const FJsonObject& GraphObject, FBlueprintGraphSnapshot& OutGraph);
+	static void ReadNode(const FJsonObject& NodeObject, FBlueprintNodeSnapshot& OutNode);
+
+	/** Schema 3: "graphs" whose nodes and pins refer to "strings" by index */
+	static void ReadCompactGraphs(const FJsonObject& Root, TArray<FBlueprintGraphSnapshot>& OutGraphs);
+};
@@ -0,0 +1,40 @@
+// BlueprintStringTable.cpp
+
+#include "BlueprintStringTable.h"
+
+FBlueprintStringTable::FBlueprintStringTable(const FBlueprintSnapshot& Snapshot)
+{
+	Add(FString());
+
+	for (const FBlueprintGraphSnapshot& Graph : Snapshot.Graphs)
+	{
+		for (const FBlueprintNodeSnapshot& Node : Graph.Nodes)
+		{
+			Add(Node.Id);
+			Add(Node.Type);
+			Add(Node.Title);
+
+			for (const FBlueprintPinSnapshot& Pin : Node.Pins)
+			{
+				Add(Pin.Name);
+				Add(Pin.Type);
+				Add(Pin.DefaultValue);
+
+				// Only needed for links that leave the graph, but free when the names are already in
+				for (const FBlueprintConnectionSnapshot& Connection : Pin.Connections)
+				{
+					Add(Connection.Node);
+					Add(Connection.Pin);
+				}
+			}
+		}
+	}
+}
+
+void FBlueprintStringTable::Add(const FString& String)
+{
+	if (!Indices.Contains(String))
+	{
+		Indices.Add(String, Strings.Add(String));
+	}
+}
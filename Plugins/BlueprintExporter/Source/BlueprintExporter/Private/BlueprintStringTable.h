@@ -0,0 +1,47 @@
+// BlueprintStringTable.h
+// Interned strings of the compact schema
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintExportTypes.h"
+
+/** Map keys compared and hashed case-sensitively (FString's defaults ignore case) */
+template <typename ValueType>
+struct TCaseSensitiveStringKeyFuncs : TDefaultMapKeyFuncs<FString, ValueType, false>
+{
+	static bool Matches(const FString& A, const FString& B)
+	{
+		return A.Equals(B, ESearchCase::CaseSensitive);
+	}
+
+	static uint32 GetKeyHash(const FString& Key)
+	{
+		return FCrc::StrCrc32(*Key);
+	}
+};
+
+/**
+ * Every distinct string of a blueprint's graphs, in order of first use
+ *
+ * Index 0 is always the empty string, so "no value" needs no special encoding.
+ * Collected in one pass over the graphs: for each node its id, type and title,
+ * then for each pin its name, type, default value and the node and pin name of
+ * each connection.
+ */
+class FBlueprintStringTable
+{
+public:
+	explicit FBlueprintStringTable(const FBlueprintSnapshot& Snapshot);
+
+	/** Index of a string that was collected */
+	int32 IndexOf(const FString& String) const { return Indices.FindChecked(String); }
+
+	const TArray<FString>& GetStrings() const { return Strings; }
+
+private:
+	void Add(const FString& String);
+
+	TArray<FString> Strings;
+	TMap<FString, int32, FDefaultSetAllocator, TCaseSensitiveStringKeyFuncs<int32>> Indices;
+};
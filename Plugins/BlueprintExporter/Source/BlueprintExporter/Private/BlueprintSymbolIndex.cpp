@@ -0,0 +1,329 @@
+// BlueprintSymbolIndex.cpp
+
+#include "BlueprintSymbolIndex.h"
+#include "BlueprintExporter.h"
+#include "BlueprintFileWriter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+const TCHAR* FBlueprintSymbolIndex::FileName = TEXT("symbol_index.bin");
+
+static const uint8 SymbolIndexMagic[4] = { 'B', 'P', 'S', 'I' };
+
+// Version of the binary layout, independent of BlueprintExporterFormatVersion: bump only when the
+// layout changes, together with LAYOUT_VERSION in Content/Python/blueprint_symbols.py
+static constexpr uint32 SymbolIndexLayoutVersion = 1;
+
+// Magic plus layout version and the four counts
+static constexpr int32 SymbolIndexHeaderSize = 4 + 5 * sizeof(uint32);
+
+// ============================================================================
+// Encoding Helpers
+// ============================================================================
+
+static void AppendUInt32(TArray<uint8>& Data, uint32 Value)
+{
+	Data.Add(static_cast<uint8>(Value));
+	Data.Add(static_cast<uint8>(Value >> 8));
+	Data.Add(static_cast<uint8>(Value >> 16));
+	Data.Add(static_cast<uint8>(Value >> 24));
+}
+
+static uint32 ReadUInt32(const uint8* Data)
+{
+	return static_cast<uint32>(Data[0])
+		| (static_cast<uint32>(Data[1]) << 8)
+		| (static_cast<uint32>(Data[2]) << 16)
+		| (static_cast<uint32>(Data[3]) << 24);
+}
+
+/** Bytewise order, which is code point order for UTF-8 and what readers binary-search by */
+static bool Utf8Less(const TArray<uint8>& A, const TArray<uint8>& B)
+{
+	const int32 Compare = FMemory::Memcmp(A.GetData(), B.GetData(), FMath::Min(A.Num(), B.Num()));
+	return Compare != 0 ? Compare < 0 : A.Num() < B.Num();
+}
+
+// ============================================================================
+// Index
+// ============================================================================
+
+FBlueprintSymbolIndex::FBlueprintSymbolIndex(const FString& InOutputDirectory, const FString& InFileName)
+	: OutputDirectory(InOutputDirectory)
+	, IndexFileName(InFileName)
+{
+}
+
+void FBlueprintSymbolIndex::Load()
+{
+	Blueprints.Reset();
+
+	const FString IndexPath = FPaths::Combine(OutputDirectory, IndexFileName);
+	TArray<uint8> Data;
+	if (!FPaths::FileExists(IndexPath) || !FFileHelper::LoadFileToArray(Data, *IndexPath))
+	{
+		return;
+	}
+
+	if (!Parse(Data))
+	{
+		UE_LOG(LogBlueprintExporter, Warning, TEXT("Ignoring unreadable symbol index: %s"), *IndexPath);
+		Blueprints.Reset();
+	}
+}
+
+bool FBlueprintSymbolIndex::Parse(const TArray<uint8>& Data)
+{
+	if (Data.Num() < SymbolIndexHeaderSize || FMemory::Memcmp(Data.GetData(), SymbolIndexMagic, 4) != 0
+		|| ReadUInt32(Data.GetData() + 4) != SymbolIndexLayoutVersion)
+	{
+		return false;
+	}
+
+	const int64 StringCount = ReadUInt32(Data.GetData() + 8);
+	const int64 BlueprintCount = ReadUInt32(Data.GetData() + 12);
+	const int64 SymbolCount = ReadUInt32(Data.GetData() + 16);
+	const int64 PostingCount = ReadUInt32(Data.GetData() + 20);
+
+	const int64 OffsetsStart = SymbolIndexHeaderSize;
+	const int64 BlueprintsStart = OffsetsStart + (StringCount + 1) * 4;
+	const int64 SymbolsStart = BlueprintsStart + BlueprintCount * 4;
+	const int64 PostingsStart = SymbolsStart + SymbolCount * 12;
+	const int64 StringDataStart = PostingsStart + PostingCount * 12;
+	if (StringDataStart > Data.Num())
+	{
+		return false;
+	}
+
+	auto ReadAt = [&Data](int64 Offset) { return ReadUInt32(Data.GetData() + Offset); };
+
+	TArray<FString> Strings;
+	Strings.Reserve(StringCount);
+	for (int64 Index = 0; Index < StringCount; ++Index)
+	{
+		const int64 Begin = StringDataStart + ReadAt(OffsetsStart + Index * 4);
+		const int64 End = StringDataStart + ReadAt(OffsetsStart + (Index + 1) * 4);
+		if (Begin > End || End > Data.Num())
+		{
+			return false;
+		}
+
+		const FUTF8ToTCHAR Text(reinterpret_cast<const ANSICHAR*>(Data.GetData() + Begin), static_cast<int32>(End - Begin));
+		Strings.Emplace(Text.Length(), Text.Get());
+	}
+
+	for (int64 Index = 0; Index < BlueprintCount; ++Index)
+	{
+		const uint32 Blueprint = ReadAt(BlueprintsStart + Index * 4);
+		if (!Strings.IsValidIndex(Blueprint))
+		{
+			return false;
+		}
+		Blueprints.Add(Strings[Blueprint]);
+	}
+
+	for (int64 Symbol = 0; Symbol < SymbolCount; ++Symbol)
+	{
+		const int64 Entry = SymbolsStart + Symbol * 12;
+		const uint32 Key = ReadAt(Entry);
+		const int64 FirstPosting = ReadAt(Entry + 4);
+		const int64 NumPostings = ReadAt(Entry + 8);
+		if (!Strings.IsValidIndex(Key) || FirstPosting + NumPostings > PostingCount)
+		{
+			return false;
+		}
+
+		for (int64 Posting = FirstPosting; Posting < FirstPosting + NumPostings; ++Posting)
+		{
+			const int64 PostingEntry = PostingsStart + Posting * 12;
+			const uint32 Blueprint = ReadAt(PostingEntry);
+			const uint32 Graph = ReadAt(PostingEntry + 4);
+			const uint32 Node = ReadAt(PostingEntry + 8);
+			if (!Strings.IsValidIndex(Blueprint) || !Strings.IsValidIndex(Graph) || !Strings.IsValidIndex(Node))
+			{
+				return false;
+			}
+
+			Blueprints.FindOrAdd(Strings[Blueprint]).Add({ Strings[Key], Strings[Graph], Strings[Node] });
+		}
+	}
+
+	return true;
+}
+
+bool FBlueprintSymbolIndex::Save() const
+{
+	// Every string occurrence is encoded once; sorting the occurrences bytewise and
+	// collapsing equal neighbours gives the string table and each occurrence's index
+	TArray<TArray<uint8>> Encoded;
+	auto Encode = [&Encoded](const FString& Text) -> int32
+	{
+		const FTCHARToUTF8 Utf8(*Text, Text.Len());
+		return Encoded.Emplace(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	};
+
+	// Occurrences per blueprint, then symbol, graph and node per reference
+	TArray<int32> BlueprintOccurrences;
+	TArray<int32> ReferenceOccurrences;
+	for (const TPair<FString, TArray<FSymbolReference>>& Pair : Blueprints)
+	{
+		const int32 Blueprint = Encode(Pair.Key);
+		BlueprintOccurrences.Add(Blueprint);
+		for (const FSymbolReference& Reference : Pair.Value)
+		{
+			ReferenceOccurrences.Add(Encode(Reference.Symbol));
+			ReferenceOccurrences.Add(Blueprint);
+			ReferenceOccurrences.Add(Encode(Reference.Graph));
+			ReferenceOccurrences.Add(Encode(Reference.Node));
+		}
+	}
+
+	TArray<int32> Order;
+	Order.SetNumUninitialized(Encoded.Num());
+	for (int32 Index = 0; Index < Order.Num(); ++Index)
+	{
+		Order[Index] = Index;
+	}
+	Order.Sort([&Encoded](int32 A, int32 B) { return Utf8Less(Encoded[A], Encoded[B]); });
+
+	TArray<uint32> StringIds;
+	StringIds.SetNumUninitialized(Encoded.Num());
+	TArray<int32> Strings;
+	for (const int32 Occurrence : Order)
+	{
+		if (Strings.Num() == 0 || Encoded[Strings.Last()] != Encoded[Occurrence])
+		{
+			Strings.Add(Occurrence);
+		}
+		StringIds[Occurrence] = Strings.Num() - 1;
+	}
+
+	TArray<uint32> BlueprintIds;
+	for (const int32 Occurrence : BlueprintOccurrences)
+	{
+		BlueprintIds.Add(StringIds[Occurrence]);
+	}
+	BlueprintIds.Sort();
+
+	// Postings as (symbol, blueprint, graph, node); string ids follow string order, so
+	// sorting the ids sorts the symbols and each symbol's postings
+	struct FPosting
+	{
+		uint32 Ids[4];
+
+		bool operator<(const FPosting& Other) const
+		{
+			for (int32 Field = 0; Field < 4; ++Field)
+			{
+				if (Ids[Field] != Other.Ids[Field])
+				{
+					return Ids[Field] < Other.Ids[Field];
+				}
+			}
+			return false;
+		}
+	};
+
+	TArray<FPosting> Postings;
+	Postings.Reserve(ReferenceOccurrences.Num() / 4);
+	for (int32 Index = 0; Index < ReferenceOccurrences.Num(); Index += 4)
+	{
+		Postings.Add({ { StringIds[ReferenceOccurrences[Index]], StringIds[ReferenceOccurrences[Index + 1]],
+			StringIds[ReferenceOccurrences[Index + 2]], StringIds[ReferenceOccurrences[Index + 3]] } });
+	}
+	Postings.Sort();
+
+	int32 SymbolCount = 0;
+	for (int32 Index = 0; Index < Postings.Num(); ++Index)
+	{
+		if (Index == 0 || Postings[Index].Ids[0] != Postings[Index - 1].Ids[0])
+		{
+			++SymbolCount;
+		}
+	}
+
+	TArray<uint8> Data;
+	Data.Append(SymbolIndexMagic, 4);
+	AppendUInt32(Data, SymbolIndexLayoutVersion);
+	AppendUInt32(Data, Strings.Num());
+	AppendUInt32(Data, BlueprintIds.Num());
+	AppendUInt32(Data, SymbolCount);
+	AppendUInt32(Data, Postings.Num());
+
+	uint32 StringOffset = 0;
+	AppendUInt32(Data, StringOffset);
+	for (const int32 Occurrence : Strings)
+	{
+		StringOffset += Encoded[Occurrence].Num();
+		AppendUInt32(Data, StringOffset);
+	}
+
+	for (const uint32 Blueprint : BlueprintIds)
+	{
+		AppendUInt32(Data, Blueprint);
+	}
+
+	for (int32 First = 0; First < Postings.Num();)
+	{
+		int32 Last = First + 1;
+		while (Last < Postings.Num() && Postings[Last].Ids[0] == Postings[First].Ids[0])
+		{
+			++Last;
+		}
+
+		AppendUInt32(Data, Postings[First].Ids[0]);
+		AppendUInt32(Data, First);
+		AppendUInt32(Data, Last - First);
+		First = Last;
+	}
+
+	for (const FPosting& Posting : Postings)
+	{
+		AppendUInt32(Data, Posting.Ids[1]);
+		AppendUInt32(Data, Posting.Ids[2]);
+		AppendUInt32(Data, Posting.Ids[3]);
+	}
+
+	for (const int32 Occurrence : Strings)
+	{
+		Data.Append(Encoded[Occurrence]);
+	}
+
+	const FString IndexPath = FPaths::Combine(OutputDirectory, IndexFileName);
+	if (FBlueprintFileWriter::WriteIfChanged(IndexPath, Data) == EBlueprintFileWriteResult::Failed)
+	{
+		UE_LOG(LogBlueprintExporter, Error, TEXT("Failed to save symbol index: %s"), *IndexPath);
+		return false;
+	}
+
+	return true;
+}
+
+void FBlueprintSymbolIndex::Update(const FBlueprintSnapshot& Snapshot)
+{
+	TArray<FSymbolReference>& References = Blueprints.FindOrAdd(Snapshot.Path);
+	References.Reset();
+
+	for (const FBlueprintGraphSnapshot& Graph : Snapshot.Graphs)
+	{
+		for (const FBlueprintNodeSnapshot& Node : Graph.Nodes)
+		{
+			if (!Node.Symbol.IsEmpty())
+			{
+				References.Add({ Node.Symbol, Graph.Name, Node.Id });
+			}
+		}
+	}
+}
+
+void FBlueprintSymbolIndex::RemoveStale(const TSet<FName>& LivePackageNames)
+{
+	for (auto It = Blueprints.CreateIterator(); It; ++It)
+	{
+		if (!LivePackageNames.Contains(FName(*FPackageName::ObjectPathToPackageName(It.Key()))))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
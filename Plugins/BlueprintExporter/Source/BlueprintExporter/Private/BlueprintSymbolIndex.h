@@ -0,0 +1,63 @@
+// BlueprintSymbolIndex.h
+// Inverted index from called functions, variables and spawned classes to the nodes that use them
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintExportTypes.h"
+
+/**
+ * Symbol index stored as <OutputDirectory>/symbol_index.bin
+ *
+ * Maps every symbol a node refers to (FBlueprintNodeSnapshot::Symbol, e.g.
+ * "call:K2_DestroyActor@/Script/Engine.Actor") to the (blueprint, graph, node) of each
+ * node referring to it. The file is sorted so readers can binary-search it in place
+ * without loading it (see JSON-SCHEMA.md for the layout):
+ *
+ *   char[4]  "BPSI"
+ *   uint32   layout version, string count, blueprint count, symbol count, posting count
+ *   uint32   string offsets[string count + 1], into the string data
+ *   uint32   blueprints[blueprint count]              asset path strings, sorted
+ *   uint32   symbols[symbol count][3]                 key string, first posting, posting count; sorted by key
+ *   uint32   postings[posting count][3]               blueprint, graph and node id strings
+ *   uint8    string data                              UTF-8, sorted bytewise, so string order is index order
+ *
+ * All integers are little-endian. Exports update it incrementally like the dependency index.
+ * Game thread only.
+ */
+class FBlueprintSymbolIndex
+{
+public:
+	static const TCHAR* FileName;
+
+	explicit FBlueprintSymbolIndex(const FString& InOutputDirectory, const FString& InFileName = FileName);
+
+	/** Load the index; a missing, unreadable or outdated file simply means an empty index */
+	void Load();
+	bool Save() const;
+
+	/** Record (or replace) the symbols of a blueprint's nodes */
+	void Update(const FBlueprintSnapshot& Snapshot);
+
+	/** True if the index has the blueprint (even one whose nodes refer to no symbols) */
+	bool Contains(const FString& AssetPath) const { return Blueprints.Contains(AssetPath); }
+
+	/** Drop blueprints that are no longer in the project */
+	void RemoveStale(const TSet<FName>& LivePackageNames);
+
+private:
+	struct FSymbolReference
+	{
+		FString Symbol;
+		FString Graph;
+		FString Node;
+	};
+
+	bool Parse(const TArray<uint8>& Data);
+
+	FString OutputDirectory;
+	FString IndexFileName;
+
+	// Asset path -> the symbol references of its nodes
+	TMap<FString, TArray<FSymbolReference>> Blueprints;
+};
@@ -0,0 +1,149 @@
+// BlueprintGraphBenchmark.cpp
+
+#include "BlueprintGraphBenchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <utility>
+
+namespace BlueprintGraph
+{
+	const std::vector<FBenchmarkScenario>& GetBenchmarkScenarios()
+	{
+		// NodeCount, FanOut, KnotChainDepth, FunctionGraphs
+		static const std::vector<FBenchmarkScenario> Scenarios = {
+			{ "Small", { 500, 2, 1, 4 } },
+			{ "Medium", { 5000, 2, 2, 16 } },
+			{ "WideFanOut", { 5000, 6, 0, 4 } },
+			{ "KnotChains", { 5000, 2, 8, 4 } },
+			{ "Large", { 100000, 3, 2, 0 } },
+		};
+		return Scenarios;
+	}
+
+	/** A metric as the baseline and the table write it: "-" if it wasn't measured */
+	static std::string FormatMetric(double Value, const char* Format)
+	{
+		if (Value < 0.0)
+		{
+			return "-";
+		}
+
+		char Buffer[64];
+		std::snprintf(Buffer, sizeof(Buffer), Format, Value);
+		return Buffer;
+	}
+
+	std::string FormatResults(const std::vector<FBenchmarkResult>& Results)
+	{
+		std::string Text;
+		char Line[256];
+		std::snprintf(Line, sizeof(Line), "%-12s %-14s %9s %12s %14s %12s\n", "Scenario", "Stage", "Nodes", "ns/node", "allocs/node", "bytes/node");
+		Text += Line;
+
+		for (const FBenchmarkResult& Result : Results)
+		{
+			std::snprintf(Line, sizeof(Line), "%-12s %-14s %9lld %12s %14s %12s\n", Result.Scenario.c_str(), Result.Stage.c_str(),
+				static_cast<long long>(Result.Nodes), FormatMetric(Result.NsPerNode, "%.1f").c_str(),
+				FormatMetric(Result.AllocationsPerNode, "%.3f").c_str(), FormatMetric(Result.BytesPerNode, "%.1f").c_str());
+			Text += Line;
+		}
+		return Text;
+	}
+
+	std::string WriteBaseline(const std::vector<FBenchmarkResult>& Results)
+	{
+		std::string Text = "# Blueprint Exporter benchmark baseline\n# Scenario Stage NsPerNode AllocationsPerNode BytesPerNode\n";
+		for (const FBenchmarkResult& Result : Results)
+		{
+			Text += Result.Scenario + " " + Result.Stage + " " + FormatMetric(Result.NsPerNode, "%.2f") + " "
+				+ FormatMetric(Result.AllocationsPerNode, "%.4f") + " " + FormatMetric(Result.BytesPerNode, "%.2f") + "\n";
+		}
+		return Text;
+	}
+
+	/** A metric as WriteBaseline writes it; false if it is neither a number nor "-" */
+	static bool ParseMetric(const std::string& Text, double& OutValue)
+	{
+		if (Text == "-")
+		{
+			OutValue = -1.0;
+			return true;
+		}
+
+		char* End = nullptr;
+		OutValue = std::strtod(Text.c_str(), &End);
+		return End != Text.c_str() && *End == '\0' && OutValue >= 0.0;
+	}
+
+	std::vector<FBenchmarkResult> ParseBaseline(const std::string& Text)
+	{
+		std::vector<FBenchmarkResult> Results;
+		std::istringstream Lines(Text);
+		std::string Line;
+		while (std::getline(Lines, Line))
+		{
+			if (Line.empty() || Line[0] == '#')
+			{
+				continue;
+			}
+
+			std::istringstream Fields(Line);
+			FBenchmarkResult Result;
+			std::string NsPerNode, AllocationsPerNode, BytesPerNode, Extra;
+			if (!(Fields >> Result.Scenario >> Result.Stage >> NsPerNode >> AllocationsPerNode >> BytesPerNode) || (Fields >> Extra)
+				|| !ParseMetric(NsPerNode, Result.NsPerNode)
+				|| !ParseMetric(AllocationsPerNode, Result.AllocationsPerNode)
+				|| !ParseMetric(BytesPerNode, Result.BytesPerNode))
+			{
+				continue;
+			}
+			Results.push_back(std::move(Result));
+		}
+		return Results;
+	}
+
+	std::vector<FBenchmarkRegression> FindRegressions(const std::vector<FBenchmarkResult>& Baseline, const std::vector<FBenchmarkResult>& Results,
+		const FBenchmarkTolerance& Tolerance)
+	{
+		std::vector<FBenchmarkRegression> Regressions;
+		for (const FBenchmarkResult& Result : Results)
+		{
+			const auto Found = std::find_if(Baseline.begin(), Baseline.end(), [&Result](const FBenchmarkResult& Entry)
+			{
+				return Entry.Scenario == Result.Scenario && Entry.Stage == Result.Stage;
+			});
+			if (Found == Baseline.end())
+			{
+				continue;
+			}
+
+			// Small absolute slack so near-zero metrics don't flag on rounding
+			auto Check = [&Regressions, &Result](const char* Metric, double Expected, double Measured, double Factor, double Slack, bool bIsTiming)
+			{
+				if (Expected >= 0.0 && Measured >= 0.0 && Measured > Expected * Factor + Slack)
+				{
+					Regressions.push_back({ Result.Scenario, Result.Stage, Metric, Expected, Measured, bIsTiming });
+				}
+			};
+			Check("ns/node", Found->NsPerNode, Result.NsPerNode, Tolerance.Time, 1.0, true);
+			Check("allocations/node", Found->AllocationsPerNode, Result.AllocationsPerNode, Tolerance.Allocations, 0.01, false);
+			Check("bytes/node", Found->BytesPerNode, Result.BytesPerNode, Tolerance.Bytes, 0.5, false);
+		}
+		return Regressions;
+	}
+
+	std::string FormatRegression(const FBenchmarkRegression& Regression)
+	{
+		char Change[32] = "";
+		if (Regression.Baseline > 0.0)
+		{
+			std::snprintf(Change, sizeof(Change), " (+%.0f%%)", (Regression.Measured / Regression.Baseline - 1.0) * 100.0);
+		}
+
+		char Values[96];
+		std::snprintf(Values, sizeof(Values), " %.3g -> %.3g", Regression.Baseline, Regression.Measured);
+		return Regression.Scenario + "/" + Regression.Stage + ": " + Regression.Metric + Values + Change;
+	}
+}
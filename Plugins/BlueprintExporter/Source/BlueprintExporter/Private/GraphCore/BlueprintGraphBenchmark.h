@@ -0,0 +1,120 @@
+// BlueprintGraphBenchmark.h
+// Measuring export stages on synthetic graphs, and comparing the results with a stored baseline
+//
+// Shared by the standalone benchmark (Tools/GraphCore/Benchmarks) and the editor's automation
+// benchmark, so both measure the same scenarios and read and write the same baseline format:
+//
+//   # Scenario Stage NsPerNode AllocationsPerNode BytesPerNode
+//   Medium Order 41.2 0.013 -
+//
+// A "-" is a metric the stage doesn't have or the host can't measure.
+
+#pragma once
+
+#include "BlueprintGraphGenerator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace BlueprintGraph
+{
+	struct FBenchmarkScenario
+	{
+		std::string Name;
+		FGeneratorSettings Settings;
+	};
+
+	/** The graphs every benchmark run measures, smallest first */
+	const std::vector<FBenchmarkScenario>& GetBenchmarkScenarios();
+
+	/** One stage measured on one scenario; metrics that weren't measured are negative */
+	struct FBenchmarkResult
+	{
+		std::string Scenario;
+		std::string Stage;
+		int64_t Nodes = 0;
+		double NsPerNode = -1.0;
+		double AllocationsPerNode = -1.0;
+		// Output the stage produced, e.g. JSON text
+		double BytesPerNode = -1.0;
+	};
+
+	/** Allocations made so far by the process; how to count them is up to the host */
+	using FAllocationCounter = uint64_t (*)();
+
+	/**
+	 * Run a stage Iterations times and keep its fastest run and fewest allocations, so warm-up
+	 * and one-off caches don't count
+	 * @param Stage - Runs the stage once; returns the bytes of output it produced, or -1 if it produces none
+	 * @param CountAllocations - Null if the host can't count allocations
+	 */
+	template <typename StageFunctionType>
+	FBenchmarkResult MeasureStage(const std::string& Scenario, const std::string& StageName, int64_t Nodes, int32_t Iterations,
+		FAllocationCounter CountAllocations, StageFunctionType&& Stage)
+	{
+		FBenchmarkResult Result;
+		Result.Scenario = Scenario;
+		Result.Stage = StageName;
+		Result.Nodes = Nodes;
+
+		const double PerNode = Nodes > 0 ? 1.0 / static_cast<double>(Nodes) : 0.0;
+		for (int32_t Iteration = 0; Iteration < std::max(Iterations, 1); ++Iteration)
+		{
+			const uint64_t AllocationsBefore = CountAllocations ? CountAllocations() : 0;
+			const std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+			const int64_t Bytes = Stage();
+			const std::chrono::steady_clock::time_point End = std::chrono::steady_clock::now();
+			const uint64_t AllocationsAfter = CountAllocations ? CountAllocations() : 0;
+
+			const double NsPerNode = std::chrono::duration<double, std::nano>(End - Start).count() * PerNode;
+			Result.NsPerNode = Iteration == 0 ? NsPerNode : std::min(Result.NsPerNode, NsPerNode);
+			if (CountAllocations)
+			{
+				const double AllocationsPerNode = static_cast<double>(AllocationsAfter - AllocationsBefore) * PerNode;
+				Result.AllocationsPerNode = Iteration == 0 ? AllocationsPerNode : std::min(Result.AllocationsPerNode, AllocationsPerNode);
+			}
+			Result.BytesPerNode = Bytes < 0 ? -1.0 : static_cast<double>(Bytes) * PerNode;
+		}
+		return Result;
+	}
+
+	/** A table of the results for logs and consoles */
+	std::string FormatResults(const std::vector<FBenchmarkResult>& Results);
+
+	/** The results in baseline form */
+	std::string WriteBaseline(const std::vector<FBenchmarkResult>& Results);
+
+	/** Results read from a baseline; comments, blank and malformed lines are skipped */
+	std::vector<FBenchmarkResult> ParseBaseline(const std::string& Text);
+
+	/** How much worse than its baseline a metric may get before it counts as a regression */
+	struct FBenchmarkTolerance
+	{
+		// Timings vary between runs and machines
+		double Time = 1.5;
+		double Allocations = 1.1;
+		double Bytes = 1.02;
+	};
+
+	struct FBenchmarkRegression
+	{
+		std::string Scenario;
+		std::string Stage;
+		// "ns/node", "allocations/node" or "bytes/node"
+		std::string Metric;
+		double Baseline = 0.0;
+		double Measured = 0.0;
+		// Timing regressions may be noise; the hosts only warn about them by default
+		bool bIsTiming = false;
+	};
+
+	/** Metrics of Results worse than the same scenario, stage and metric in Baseline; metrics missing from either are skipped */
+	std::vector<FBenchmarkRegression> FindRegressions(const std::vector<FBenchmarkResult>& Baseline, const std::vector<FBenchmarkResult>& Results,
+		const FBenchmarkTolerance& Tolerance = FBenchmarkTolerance());
+
+	/** e.g. "Medium/Order: ns/node 41.2 -> 70.5 (+71%)" */
+	std::string FormatRegression(const FBenchmarkRegression& Regression);
+}
@@ -0,0 +1,161 @@
+// BlueprintGraphDependencies.cpp
+
+#include "BlueprintGraphDependencies.h"
+
+#include <algorithm>
+
+namespace BlueprintGraph
+{
+	// ============================================================================
+	// Per blueprint
+	// ============================================================================
+
+	void CollectDependencies(const FGraph& Graph, std::vector<std::string>& InOutDependencies)
+	{
+		for (const FNode& Node : Graph.Nodes)
+		{
+			if (Node.Kind == ENodeKind::CallFunction && !Node.FunctionClass.empty())
+			{
+				InOutDependencies.push_back(Node.FunctionClass);
+			}
+
+			for (const FPin& Pin : Node.Pins)
+			{
+				if (!Pin.DefaultObject.empty())
+				{
+					InOutDependencies.push_back(Pin.DefaultObject);
+				}
+			}
+		}
+	}
+
+	void SortAndDeduplicate(std::vector<std::string>& Paths)
+	{
+		std::sort(Paths.begin(), Paths.end(), [](const std::string& A, const std::string& B) { return LessPath(A, B); });
+		Paths.erase(std::unique(Paths.begin(), Paths.end(), FPathEqual()), Paths.end());
+	}
+
+	// ============================================================================
+	// Project graph
+	// ============================================================================
+
+	FDependencyGraph FDependencyGraph::Build(const std::vector<FDependencyEntry>& Blueprints)
+	{
+		FDependencyGraph Graph;
+
+		// A dependency on a generated class is a dependency on its blueprint
+		std::unordered_map<std::string, const std::string*, FPathHash, FPathEqual> ClassToBlueprint;
+		for (const FDependencyEntry& Entry : Blueprints)
+		{
+			if (!Entry.ClassPath.empty())
+			{
+				ClassToBlueprint.emplace(Entry.ClassPath, &Entry.Path);
+			}
+		}
+
+		auto Resolve = [&ClassToBlueprint](const std::string& Path) -> const std::string&
+		{
+			const auto Blueprint = ClassToBlueprint.find(Path);
+			return Blueprint != ClassToBlueprint.end() ? *Blueprint->second : Path;
+		};
+
+		for (const FDependencyEntry& Entry : Blueprints)
+		{
+			Graph.Nodes.push_back(Entry.Path);
+			for (const std::string& Dependency : Entry.Dependencies)
+			{
+				Graph.Nodes.push_back(Resolve(Dependency));
+			}
+		}
+		SortAndDeduplicate(Graph.Nodes);
+
+		Graph.NodeIndices.reserve(Graph.Nodes.size() + ClassToBlueprint.size());
+		for (int32_t Node = 0; Node < static_cast<int32_t>(Graph.Nodes.size()); ++Node)
+		{
+			Graph.NodeIndices.emplace(Graph.Nodes[Node], Node);
+		}
+		for (const auto& Pair : ClassToBlueprint)
+		{
+			Graph.NodeIndices.emplace(Pair.first, Graph.NodeIndices.at(*Pair.second));
+		}
+
+		Graph.Forward.resize(Graph.Nodes.size());
+		Graph.Reverse.resize(Graph.Nodes.size());
+
+		for (const FDependencyEntry& Entry : Blueprints)
+		{
+			const int32_t Node = Graph.NodeIndices.at(Entry.Path);
+			std::vector<int32_t>& Edges = Graph.Forward[Node];
+			for (const std::string& Dependency : Entry.Dependencies)
+			{
+				const int32_t DependencyNode = Graph.NodeIndices.at(Resolve(Dependency));
+				if (DependencyNode != Node)
+				{
+					Edges.push_back(DependencyNode);
+				}
+			}
+			std::sort(Edges.begin(), Edges.end());
+			Edges.erase(std::unique(Edges.begin(), Edges.end()), Edges.end());
+
+			for (const int32_t DependencyNode : Edges)
+			{
+				Graph.Reverse[DependencyNode].push_back(Node);
+			}
+		}
+
+		// Reverse lists were filled in entry order
+		for (std::vector<int32_t>& Edges : Graph.Reverse)
+		{
+			std::sort(Edges.begin(), Edges.end());
+		}
+
+		return Graph;
+	}
+
+	int32_t FDependencyGraph::FindNode(const std::string& Path) const
+	{
+		const auto Index = NodeIndices.find(Path);
+		return Index != NodeIndices.end() ? Index->second : -1;
+	}
+
+	std::vector<std::string> FDependencyGraph::Walk(const std::string& Path, bool bReverse, bool bTransitive) const
+	{
+		std::vector<std::string> Result;
+		const int32_t Start = FindNode(Path);
+		if (Start < 0)
+		{
+			return Result;
+		}
+
+		const std::vector<std::vector<int32_t>>& Edges = bReverse ? Reverse : Forward;
+
+		// Breadth-first over node indices; the start node is only reported if a cycle leads back to it
+		std::vector<bool> Visited(Nodes.size(), false);
+		std::vector<int32_t> Queue = Edges[Start];
+		for (const int32_t Node : Queue)
+		{
+			Visited[Node] = true;
+		}
+
+		for (size_t Head = 0; bTransitive && Head < Queue.size(); ++Head)
+		{
+			for (const int32_t Next : Edges[Queue[Head]])
+			{
+				if (!Visited[Next])
+				{
+					Visited[Next] = true;
+					Queue.push_back(Next);
+				}
+			}
+		}
+
+		// Node indices follow path order, so sorting the indices sorts the paths
+		std::sort(Queue.begin(), Queue.end());
+		Result.reserve(Queue.size());
+		for (const int32_t Node : Queue)
+		{
+			Result.push_back(Nodes[Node]);
+		}
+		return Result;
+	}
+}
@@ -0,0 +1,68 @@
+// BlueprintGraphDependencies.h
+// A blueprint's dependencies, and the project-wide dependency graph built from them
+
+#pragma once
+
+#include "BlueprintGraphModel.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace BlueprintGraph
+{
+	/**
+	 * Append what the nodes of Graph depend on: the class of every called function and
+	 * the default object of every object pin. Knots carry neither, so they add nothing.
+	 */
+	void CollectDependencies(const FGraph& Graph, std::vector<std::string>& InOutDependencies);
+
+	/**
+	 * Sort paths with LessPath and drop duplicates, as the exported "dependencies" are
+	 * Paths that differ only in ASCII case are duplicates (object paths are case-insensitive);
+	 * the first in LessPath order is kept.
+	 */
+	void SortAndDeduplicate(std::vector<std::string>& Paths);
+
+	/** One blueprint's node in the dependency graph */
+	struct FDependencyEntry
+	{
+		// Asset path, e.g. /Game/BP_Player.BP_Player
+		std::string Path;
+		// Path of the generated class, e.g. /Game/BP_Player.BP_Player_C; may be empty
+		std::string ClassPath;
+		std::vector<std::string> Dependencies;
+	};
+
+	/**
+	 * The dependency graph in query form
+	 *
+	 * Nodes are sorted paths: every blueprint (by asset path) and everything a blueprint
+	 * depends on. A dependency on a blueprint's generated class is an edge to the
+	 * blueprint itself, so chains through blueprints can be followed.
+	 */
+	struct FDependencyGraph
+	{
+		std::vector<std::string> Nodes;
+
+		// Node path -> index, ignoring case; blueprint generated class paths map to their blueprint's node
+		std::unordered_map<std::string, int32_t, FPathHash, FPathEqual> NodeIndices;
+
+		// Sorted node indices per node
+		std::vector<std::vector<int32_t>> Forward;
+		std::vector<std::vector<int32_t>> Reverse;
+
+		static FDependencyGraph Build(const std::vector<FDependencyEntry>& Blueprints);
+
+		/** Node of an asset, blueprint or generated class path, or -1 */
+		int32_t FindNode(const std::string& Path) const;
+
+		/**
+		 * Paths reachable from Path, sorted
+		 * @param bReverse - Follow reverse edges (what depends on Path) instead of forward ones
+		 * @param bTransitive - Follow edges to any depth instead of only direct ones
+		 */
+		std::vector<std::string> Walk(const std::string& Path, bool bReverse, bool bTransitive) const;
+	};
+}
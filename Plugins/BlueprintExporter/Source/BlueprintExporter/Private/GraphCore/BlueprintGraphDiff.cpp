@@ -0,0 +1,98 @@
+// BlueprintGraphDiff.cpp
+
+#include "BlueprintGraphDiff.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+namespace BlueprintGraph
+{
+	static void Pair(FNodeMatching& Matching, int32_t OldIndex, int32_t NewIndex)
+	{
+		Matching.NewForOld[OldIndex] = NewIndex;
+		Matching.OldForNew[NewIndex] = OldIndex;
+	}
+
+	/** (key, index) of the nodes still unpaired, sorted: by key, then in export order */
+	static std::vector<std::pair<uint64_t, int32_t>> GetUnpaired(const std::vector<FDiffNodeKey>& Nodes, const std::vector<int32_t>& Counterparts,
+		uint64_t FDiffNodeKey::*Key)
+	{
+		std::vector<std::pair<uint64_t, int32_t>> Unpaired;
+		for (int32_t Index = 0; Index < static_cast<int32_t>(Nodes.size()); ++Index)
+		{
+			if (Counterparts[Index] < 0)
+			{
+				Unpaired.emplace_back(Nodes[Index].*Key, Index);
+			}
+		}
+		std::sort(Unpaired.begin(), Unpaired.end());
+		return Unpaired;
+	}
+
+	/** Pair the unpaired nodes whose keys are equal, first to first */
+	static void MatchByKey(const std::vector<FDiffNodeKey>& OldNodes, const std::vector<FDiffNodeKey>& NewNodes, uint64_t FDiffNodeKey::*Key,
+		FNodeMatching& Matching)
+	{
+		const std::vector<std::pair<uint64_t, int32_t>> OldUnpaired = GetUnpaired(OldNodes, Matching.NewForOld, Key);
+		if (OldUnpaired.empty())
+		{
+			return;
+		}
+		const std::vector<std::pair<uint64_t, int32_t>> NewUnpaired = GetUnpaired(NewNodes, Matching.OldForNew, Key);
+
+		// Both sorted by key: a merge pairs each run of equal keys in order
+		size_t OldPosition = 0;
+		size_t NewPosition = 0;
+		while (OldPosition < OldUnpaired.size() && NewPosition < NewUnpaired.size())
+		{
+			const uint64_t OldKey = OldUnpaired[OldPosition].first;
+			const uint64_t NewKey = NewUnpaired[NewPosition].first;
+			if (OldKey < NewKey)
+			{
+				++OldPosition;
+			}
+			else if (NewKey < OldKey)
+			{
+				++NewPosition;
+			}
+			else
+			{
+				Pair(Matching, OldUnpaired[OldPosition++].second, NewUnpaired[NewPosition++].second);
+			}
+		}
+	}
+
+	FNodeMatching MatchNodes(const std::vector<FDiffNodeKey>& OldNodes, const std::vector<FDiffNodeKey>& NewNodes)
+	{
+		FNodeMatching Matching;
+		Matching.NewForOld.assign(OldNodes.size(), -1);
+		Matching.OldForNew.assign(NewNodes.size(), -1);
+
+		// Ids are unique, but a malformed export may repeat one; its first node keeps it
+		std::unordered_map<std::string_view, int32_t> OldIndices;
+		OldIndices.reserve(OldNodes.size());
+		for (int32_t OldIndex = 0; OldIndex < static_cast<int32_t>(OldNodes.size()); ++OldIndex)
+		{
+			OldIndices.emplace(OldNodes[OldIndex].Id, OldIndex);
+		}
+
+		for (int32_t NewIndex = 0; NewIndex < static_cast<int32_t>(NewNodes.size()); ++NewIndex)
+		{
+			const auto Found = OldIndices.find(NewNodes[NewIndex].Id);
+			if (Found != OldIndices.end() && Matching.NewForOld[Found->second] < 0)
+			{
+				Pair(Matching, Found->second, NewIndex);
+			}
+		}
+
+		MatchByKey(OldNodes, NewNodes, &FDiffNodeKey::Hash, Matching);
+		MatchByKey(OldNodes, NewNodes, &FDiffNodeKey::Shape, Matching);
+		return Matching;
+	}
+
+	bool IsUnchanged(const FDiffNodeKey& OldNode, const FDiffNodeKey& NewNode)
+	{
+		return OldNode.Hash != 0 && OldNode.Hash == NewNode.Hash;
+	}
+}
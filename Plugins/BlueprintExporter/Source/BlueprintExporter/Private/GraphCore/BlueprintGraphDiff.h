@@ -0,0 +1,48 @@
+// BlueprintGraphDiff.h
+// Pairing the nodes of two exports of a graph, for the semantic diff
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace BlueprintGraph
+{
+	/** What the pairing knows of an exported node */
+	struct FDiffNodeKey
+	{
+		// Export id, unique within the graph
+		std::string_view Id;
+		// Structural hash of the node's content; equal hashes mean equal nodes
+		uint64_t Hash = 0;
+		// Hash of what a node keeps when it is edited, e.g. its type and title
+		uint64_t Shape = 0;
+	};
+
+	/** Pairs of nodes of two versions of a graph, by index; -1 for a node without a counterpart */
+	struct FNodeMatching
+	{
+		std::vector<int32_t> NewForOld;
+		std::vector<int32_t> OldForNew;
+	};
+
+	/**
+	 * Pair the nodes of two versions of a graph
+	 *
+	 * Three passes, each over the nodes the passes before left unpaired:
+	 * 1. The same id: the same node, edited or not.
+	 * 2. The same hash: a node deleted and recreated under a new id, unchanged otherwise.
+	 * 3. The same shape: a node recreated and edited, e.g. a call to the same function with
+	 *    other pin values.
+	 * Passes 2 and 3 pair equal keys in export order, first to first, so repeated nodes pair
+	 * up in order. Old nodes left unpaired were removed, new ones added. O(n log n).
+	 */
+	FNodeMatching MatchNodes(const std::vector<FDiffNodeKey>& OldNodes, const std::vector<FDiffNodeKey>& NewNodes);
+
+	/**
+	 * Whether two paired nodes are the same, without comparing them: equal hashes, whatever the
+	 * ids, so a node recreated unchanged is not a change. A hash of 0 is an export without one.
+	 */
+	bool IsUnchanged(const FDiffNodeKey& OldNode, const FDiffNodeKey& NewNode);
+}
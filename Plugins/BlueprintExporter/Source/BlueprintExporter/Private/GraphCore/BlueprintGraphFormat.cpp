@@ -0,0 +1,70 @@
+// BlueprintGraphFormat.cpp
+
+#include "BlueprintGraphFormat.h"
+
+namespace BlueprintGraph
+{
+	std::string GetNodeTypeName(const FNode& Node)
+	{
+		switch (Node.Kind)
+		{
+		case ENodeKind::Event: return "Event";
+		case ENodeKind::FunctionEntry: return "FunctionEntry";
+		case ENodeKind::CallFunction: return "CallFunction";
+		case ENodeKind::VariableGet: return "VariableGet";
+		case ENodeKind::VariableSet: return "VariableSet";
+		default: return Node.ClassName;
+		}
+	}
+
+	std::string GetNodeSymbol(const FNode& Node)
+	{
+		const char* Kind = nullptr;
+		switch (Node.Kind)
+		{
+		case ENodeKind::CallFunction: Kind = "call:"; break;
+		case ENodeKind::VariableGet: Kind = "get:"; break;
+		case ENodeKind::VariableSet: Kind = "set:"; break;
+		case ENodeKind::Construct:
+			return Node.MemberClass.empty() ? std::string() : "spawn:" + Node.MemberClass;
+		default:
+			return std::string();
+		}
+
+		if (Node.MemberName.empty())
+		{
+			return std::string();
+		}
+
+		std::string Symbol = Kind;
+		Symbol.reserve(Symbol.size() + Node.MemberName.size() + 1 + Node.MemberClass.size());
+		Symbol += Node.MemberName;
+		Symbol += '@';
+		Symbol += Node.MemberClass;
+		return Symbol;
+	}
+
+	std::string FormatPinType(std::string_view Category, std::string_view SubCategoryObject, bool bIsArray)
+	{
+		std::string Type;
+		Type.reserve(Category.size() + SubCategoryObject.size() + 10);
+
+		if (bIsArray)
+		{
+			Type += "Array<";
+		}
+		Type += Category;
+		if (!SubCategoryObject.empty())
+		{
+			Type += '<';
+			Type += SubCategoryObject;
+			Type += '>';
+		}
+		if (bIsArray)
+		{
+			Type += '>';
+		}
+
+		return Type;
+	}
+}
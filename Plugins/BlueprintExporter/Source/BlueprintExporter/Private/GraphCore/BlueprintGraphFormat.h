@@ -0,0 +1,28 @@
+// BlueprintGraphFormat.h
+// The exported strings describing nodes and pin types
+
+#pragma once
+
+#include "BlueprintGraphModel.h"
+
+#include <string>
+#include <string_view>
+
+namespace BlueprintGraph
+{
+	/** The exported node type: "Event", "FunctionEntry", "CallFunction", "VariableGet", "VariableSet" or the node class */
+	std::string GetNodeTypeName(const FNode& Node);
+
+	/**
+	 * What the node calls, reads, writes or spawns, as a symbol index key:
+	 * "call:<Function>@<Class>", "get:<Variable>@<Class>", "set:<Variable>@<Class>" or
+	 * "spawn:<Class>"; empty for every other node
+	 */
+	std::string GetNodeSymbol(const FNode& Node);
+
+	/**
+	 * The exported type of a pin or variable, e.g. "object<Actor>" or "Array<int>"
+	 * @param SubCategoryObject - Name of the sub-category object, empty if none
+	 */
+	std::string FormatPinType(std::string_view Category, std::string_view SubCategoryObject, bool bIsArray);
+}
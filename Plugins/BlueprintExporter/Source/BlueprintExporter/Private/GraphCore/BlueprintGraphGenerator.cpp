@@ -0,0 +1,312 @@
+// BlueprintGraphGenerator.cpp
+
+#include "BlueprintGraphGenerator.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+namespace BlueprintGraph
+{
+	namespace
+	{
+		/** xorshift32: the same sequence on every platform, which the std distributions don't promise */
+		class FXorShiftRandom
+		{
+		public:
+			explicit FXorShiftRandom(uint32_t Seed)
+				: State(Seed ? Seed : 0x9E3779B9u)
+			{
+			}
+
+			uint32_t Next()
+			{
+				State ^= State << 13;
+				State ^= State >> 17;
+				State ^= State << 5;
+				return State;
+			}
+
+			/** In [0, Count) */
+			int32_t Index(size_t Count) { return static_cast<int32_t>(Next() % Count); }
+
+			bool Percent(uint32_t Chance) { return Next() % 100 < Chance; }
+
+		private:
+			uint32_t State;
+		};
+
+		const char* const BlueprintClass = "/Game/Synthetic/BP_Synthetic.BP_Synthetic_C";
+		const char* const LibraryClasses[] = { "/Script/Engine.KismetMathLibrary", "/Script/Engine.KismetSystemLibrary", "/Script/Engine.GameplayStatics" };
+		const char* const DataTypes[] = { "float", "bool", "int", "string", "object<Actor>", "struct<Vector>" };
+
+		// Distinct functions and variables referenced, so symbols repeat as they do in real blueprints
+		constexpr uint32_t NumMembers = 64;
+		constexpr uint32_t NumSpawnedClasses = 8;
+
+		// Data inputs link to one of the most recent outputs, as nearby nodes do in the editor
+		constexpr size_t LinkWindow = 32;
+
+		/** The editor node class a generated node stands for; nodes are named after it, "K2Node_CallFunction_12" */
+		enum class ENodeClass : int32_t
+		{
+			Event,
+			FunctionEntry,
+			CallFunction,
+			VariableGet,
+			VariableSet,
+			IfThenElse,
+			SpawnActor,
+			Knot,
+			Count
+		};
+
+		const char* const NodeClassNames[] = { "K2Node_Event", "K2Node_FunctionEntry", "K2Node_CallFunction", "K2Node_VariableGet",
+			"K2Node_VariableSet", "K2Node_IfThenElse", "K2Node_SpawnActorFromClass", "K2Node_Knot" };
+
+		class FGraphBuilder
+		{
+		public:
+			FGraphBuilder(FGraph& InGraph, const FGeneratorSettings& InSettings, FXorShiftRandom& InRandom)
+				: Graph(InGraph)
+				, Settings(InSettings)
+				, Random(InRandom)
+			{
+			}
+
+			void AddEvent()
+			{
+				const int32_t Index = Counters[static_cast<int32_t>(ENodeClass::Event)];
+				const int32_t Node = NewNode(ENodeClass::Event, ENodeKind::Event, "Event ReceiveEvent_" + std::to_string(Index));
+				FNode& EventNode = Graph.Nodes[Node];
+				EventNode.bIsEntryPoint = true;
+				EventNode.MemberName = "ReceiveEvent_" + std::to_string(Index);
+				EventNode.MemberClass = "/Script/Engine.Actor";
+
+				const FPinRef Delegate = Graph.AddPin(Node, "OutputDelegate", false);
+				Graph.Nodes[Node].Pins[Delegate.Pin].bIsDelegate = true;
+				Graph.Nodes[Node].Pins[Delegate.Pin].Type = "delegate";
+				AddExecOutput(Node, "then");
+			}
+
+			void AddFunctionEntry()
+			{
+				const int32_t Node = NewNode(ENodeClass::FunctionEntry, ENodeKind::FunctionEntry, Graph.Name);
+				Graph.Nodes[Node].bIsEntryPoint = true;
+				AddExecOutput(Node, "then");
+				AddDataOutput(Node, "Param");
+			}
+
+			/** One node of a random kind, linked to what came before it */
+			void AddNode()
+			{
+				const uint32_t Roll = Random.Next() % 100;
+				if (Roll < 45)
+				{
+					AddCall(true);
+				}
+				else if (Roll < 55)
+				{
+					AddCall(false);
+				}
+				else if (Roll < 75)
+				{
+					const uint32_t Member = Random.Next() % NumMembers;
+					const int32_t Node = NewNode(ENodeClass::VariableGet, ENodeKind::VariableGet, "Get Variable_" + std::to_string(Member));
+					SetMember(Node, "Variable_" + std::to_string(Member), BlueprintClass);
+					AddDataOutput(Node, Graph.Nodes[Node].MemberName);
+				}
+				else if (Roll < 87)
+				{
+					const uint32_t Member = Random.Next() % NumMembers;
+					const int32_t Node = NewNode(ENodeClass::VariableSet, ENodeKind::VariableSet, "Set Variable_" + std::to_string(Member));
+					SetMember(Node, "Variable_" + std::to_string(Member), BlueprintClass);
+					AddExecInput(Node);
+					AddExecOutput(Node, "then");
+					AddDataInput(Node, Graph.Nodes[Node].MemberName);
+					AddDataOutput(Node, "Output_Get");
+				}
+				else if (Roll < 95)
+				{
+					const int32_t Node = NewNode(ENodeClass::IfThenElse, ENodeKind::Other, "Branch");
+					AddExecInput(Node);
+					AddDataInput(Node, "Condition");
+					AddExecOutput(Node, "then");
+					AddExecOutput(Node, "else");
+				}
+				else
+				{
+					const std::string Spawned = "BP_Spawned_" + std::to_string(Random.Next() % NumSpawnedClasses);
+					const int32_t Node = NewNode(ENodeClass::SpawnActor, ENodeKind::Construct, "SpawnActor " + Spawned);
+					Graph.Nodes[Node].MemberClass = "/Game/Synthetic/" + Spawned + "." + Spawned + "_C";
+					AddExecInput(Node);
+					const FPinRef Class = Graph.AddPin(Node, "Class", true);
+					FPin& ClassPin = Graph.Nodes[Node].Pins[Class.Pin];
+					ClassPin.Type = "class<Actor>";
+					ClassPin.DefaultObject = Graph.Nodes[Node].MemberClass;
+					AddExecOutput(Node, "then");
+					AddDataOutput(Node, "ReturnValue");
+				}
+			}
+
+		private:
+			int32_t NewNode(ENodeClass Class, ENodeKind Kind, std::string Title)
+			{
+				const int32_t ClassIndex = static_cast<int32_t>(Class);
+				const int32_t Node = Graph.AddNode(std::string(NodeClassNames[ClassIndex]) + "_" + std::to_string(Counters[ClassIndex]++), Kind);
+				Graph.Nodes[Node].Title = std::move(Title);
+				if (Kind == ENodeKind::Other || Kind == ENodeKind::Construct)
+				{
+					Graph.Nodes[Node].ClassName = NodeClassNames[ClassIndex];
+				}
+				return Node;
+			}
+
+			void SetMember(int32_t Node, std::string MemberName, const char* MemberClass)
+			{
+				Graph.Nodes[Node].MemberName = std::move(MemberName);
+				Graph.Nodes[Node].MemberClass = MemberClass;
+			}
+
+			void AddCall(bool bImpure)
+			{
+				const uint32_t Member = Random.Next() % NumMembers;
+				const int32_t Node = NewNode(ENodeClass::CallFunction, ENodeKind::CallFunction, "Function " + std::to_string(Member));
+				const char* MemberClass = Random.Percent(50) ? BlueprintClass : LibraryClasses[Member % 3];
+				SetMember(Node, "Function_" + std::to_string(Member), MemberClass);
+				Graph.Nodes[Node].FunctionClass = MemberClass;
+
+				if (bImpure)
+				{
+					AddExecInput(Node);
+					AddExecOutput(Node, "then");
+				}
+				for (int32_t Input = 0; Input < Settings.FanOut; ++Input)
+				{
+					AddDataInput(Node, "Input_" + std::to_string(Input));
+				}
+				AddDataOutput(Node, "ReturnValue");
+			}
+
+			/** Continue one of the open exec chains, mostly the latest */
+			void AddExecInput(int32_t Node)
+			{
+				const FPinRef In = Graph.AddPin(Node, "execute", true, true);
+				if (OpenExecOutputs.empty())
+				{
+					return;
+				}
+
+				const size_t Index = Random.Percent(70) ? OpenExecOutputs.size() - 1 : Random.Index(OpenExecOutputs.size());
+				Graph.Link(OpenExecOutputs[Index], In);
+				std::swap(OpenExecOutputs[Index], OpenExecOutputs.back());
+				OpenExecOutputs.pop_back();
+			}
+
+			void AddExecOutput(int32_t Node, std::string PinName)
+			{
+				OpenExecOutputs.push_back(Graph.AddPin(Node, std::move(PinName), false, true));
+			}
+
+			void AddDataInput(int32_t Node, std::string PinName)
+			{
+				const FPinRef In = Graph.AddPin(Node, std::move(PinName), true);
+				Graph.Nodes[Node].Pins[In.Pin].Type = DataTypes[Random.Next() % 6];
+				if (DataOutputs.empty())
+				{
+					Graph.Nodes[Node].Pins[In.Pin].DefaultValue = "0";
+					return;
+				}
+
+				const size_t Window = std::min(DataOutputs.size(), LinkWindow);
+				FPinRef Source = DataOutputs[DataOutputs.size() - Window + Random.Index(Window)];
+
+				// Every fourth link goes through a reroute chain
+				if (Settings.KnotChainDepth > 0 && NumDataLinks++ % 4 == 0)
+				{
+					for (int32_t Depth = 0; Depth < Settings.KnotChainDepth; ++Depth)
+					{
+						const int32_t Knot = NewNode(ENodeClass::Knot, ENodeKind::Other, "Reroute Node");
+						Graph.Nodes[Knot].bIsKnot = true;
+						const FPinRef KnotIn = Graph.AddPin(Knot, "InputPin", true);
+						const FPinRef KnotOut = Graph.AddPin(Knot, "OutputPin", false);
+						Graph.Link(Source, KnotIn);
+						Source = KnotOut;
+					}
+				}
+				Graph.Link(Source, In);
+			}
+
+			void AddDataOutput(int32_t Node, std::string PinName)
+			{
+				const FPinRef Out = Graph.AddPin(Node, std::move(PinName), false);
+				Graph.Nodes[Node].Pins[Out.Pin].Type = DataTypes[Random.Next() % 6];
+				DataOutputs.push_back(Out);
+			}
+
+			FGraph& Graph;
+			const FGeneratorSettings& Settings;
+			FXorShiftRandom& Random;
+
+			// Exec outputs not linked yet; an exec output links to one input, as in the editor
+			std::vector<FPinRef> OpenExecOutputs;
+			std::vector<FPinRef> DataOutputs;
+			int32_t NumDataLinks = 0;
+			int32_t Counters[static_cast<int32_t>(ENodeClass::Count)] = {};
+		};
+	}
+
+	std::vector<FGraph> GenerateGraphs(const FGeneratorSettings& Settings)
+	{
+		FXorShiftRandom Random(Settings.Seed);
+
+		const int32_t NumGraphs = 1 + std::max(Settings.FunctionGraphs, 0);
+		const int32_t NodesPerGraph = std::max(Settings.NodeCount, 0) / NumGraphs;
+
+		std::vector<FGraph> Graphs(NumGraphs);
+		for (int32_t GraphIndex = 0; GraphIndex < NumGraphs; ++GraphIndex)
+		{
+			FGraph& Graph = Graphs[GraphIndex];
+			Graph.Name = GraphIndex == 0 ? "EventGraph" : "Function_" + std::to_string(GraphIndex - 1);
+
+			// The event graph also takes what doesn't divide evenly
+			const int32_t NumNodes = GraphIndex == 0 ? std::max(Settings.NodeCount, 0) - NodesPerGraph * (NumGraphs - 1) : NodesPerGraph;
+			if (NumNodes == 0)
+			{
+				continue;
+			}
+			Graph.Nodes.reserve(NumNodes + (Settings.KnotChainDepth > 0 ? NumNodes * Settings.FanOut * Settings.KnotChainDepth / 4 : 0));
+
+			FGraphBuilder Builder(Graph, Settings, Random);
+			int32_t NumEntryPoints = 1;
+			if (GraphIndex == 0)
+			{
+				NumEntryPoints = std::max(NumNodes / 64, 1);
+				for (int32_t Event = 0; Event < NumEntryPoints; ++Event)
+				{
+					Builder.AddEvent();
+				}
+			}
+			else
+			{
+				Builder.AddFunctionEntry();
+			}
+
+			for (int32_t Node = NumEntryPoints; Node < NumNodes; ++Node)
+			{
+				Builder.AddNode();
+			}
+		}
+		return Graphs;
+	}
+
+	int64_t CountNodes(const std::vector<FGraph>& Graphs)
+	{
+		int64_t Count = 0;
+		for (const FGraph& Graph : Graphs)
+		{
+			Count += static_cast<int64_t>(Graph.Nodes.size());
+		}
+		return Count;
+	}
+}
@@ -0,0 +1,36 @@
+// BlueprintGraphGenerator.h
+// Synthetic blueprint graphs of a chosen size and shape, for benchmarks and tests
+//
+// The graphs look like the editor's: events or a function entry, chains of function
+// calls and variable sets with branches, pure getters feeding their inputs, reroute
+// chains on some links and a few spawns. The same settings and seed always produce
+// the same graphs, on every platform.
+
+#pragma once
+
+#include "BlueprintGraphModel.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace BlueprintGraph
+{
+	struct FGeneratorSettings
+	{
+		// Nodes across all graphs, knots not included
+		int32_t NodeCount = 1000;
+		// Linked data inputs per function call; data outputs end up with about as many links
+		int32_t FanOut = 2;
+		// Knots on every fourth data link; 0 links directly
+		int32_t KnotChainDepth = 0;
+		// Function graphs besides the event graph; the nodes are split evenly between all graphs
+		int32_t FunctionGraphs = 0;
+		uint32_t Seed = 1;
+	};
+
+	/** The event graph, then the function graphs, as a blueprint's graphs are captured */
+	std::vector<FGraph> GenerateGraphs(const FGeneratorSettings& Settings);
+
+	/** Nodes of all graphs, knots included */
+	int64_t CountNodes(const std::vector<FGraph>& Graphs);
+}
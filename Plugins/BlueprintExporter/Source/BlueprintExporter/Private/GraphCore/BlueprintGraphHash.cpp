@@ -0,0 +1,97 @@
+// BlueprintGraphHash.cpp
+
+#include "BlueprintGraphHash.h"
+
+namespace BlueprintGraph
+{
+	static constexpr uint64_t FnvPrime = 0x100000001b3ull;
+
+	void FStructuralHash::AddBytes(const unsigned char* Data, size_t Length)
+	{
+		for (size_t Index = 0; Index < Length; ++Index)
+		{
+			State = (State ^ Data[Index]) * FnvPrime;
+		}
+	}
+
+	void FStructuralHash::AddString(std::string_view String)
+	{
+		AddInteger(static_cast<int64_t>(String.size()));
+		AddBytes(reinterpret_cast<const unsigned char*>(String.data()), String.size());
+	}
+
+	void FStructuralHash::AddInteger(int64_t Value)
+	{
+		// Little-endian whatever the platform
+		const uint64_t Bits = static_cast<uint64_t>(Value);
+		unsigned char Bytes[8];
+		for (int32_t Index = 0; Index < 8; ++Index)
+		{
+			Bytes[Index] = static_cast<unsigned char>(Bits >> (Index * 8));
+		}
+		AddBytes(Bytes, sizeof(Bytes));
+	}
+
+	void FStructuralHash::AddBool(bool bValue)
+	{
+		const unsigned char Byte = bValue ? 1 : 0;
+		AddBytes(&Byte, 1);
+	}
+
+	uint64_t FStructuralHash::Finish() const
+	{
+		uint64_t Hash = State;
+		Hash ^= Hash >> 33;
+		Hash *= 0xff51afd7ed558ccdull;
+		Hash ^= Hash >> 33;
+		Hash *= 0xc4ceb9fe1a85ec53ull;
+		Hash ^= Hash >> 33;
+		return Hash;
+	}
+
+	std::string FormatHash(uint64_t Hash)
+	{
+		static constexpr char Digits[] = "0123456789abcdef";
+		std::string Text(16, '0');
+		for (int32_t Index = 15; Index >= 0; --Index)
+		{
+			Text[Index] = Digits[Hash & 0xf];
+			Hash >>= 4;
+		}
+		return Text;
+	}
+
+	bool ParseHash(std::string_view Text, uint64_t& OutHash)
+	{
+		if (Text.size() != 16)
+		{
+			return false;
+		}
+
+		uint64_t Hash = 0;
+		for (const char Char : Text)
+		{
+			uint64_t Digit;
+			if (Char >= '0' && Char <= '9')
+			{
+				Digit = static_cast<uint64_t>(Char - '0');
+			}
+			else if (Char >= 'a' && Char <= 'f')
+			{
+				Digit = static_cast<uint64_t>(Char - 'a' + 10);
+			}
+			else if (Char >= 'A' && Char <= 'F')
+			{
+				Digit = static_cast<uint64_t>(Char - 'A' + 10);
+			}
+			else
+			{
+				return false;
+			}
+			Hash = (Hash << 4) | Digit;
+		}
+
+		OutHash = Hash;
+		return true;
+	}
+}
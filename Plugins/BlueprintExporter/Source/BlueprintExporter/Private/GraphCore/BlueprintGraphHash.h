@@ -0,0 +1,47 @@
+// BlueprintGraphHash.h
+// Stable 64-bit hashing for the structural hashes in the export
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace BlueprintGraph
+{
+	/**
+	 * Incremental hash of a sequence of fields
+	 *
+	 * The same fields give the same hash on every run, platform and compiler: 64-bit FNV-1a
+	 * over an encoding in which strings are prefixed with their byte length (so "ab", "c"
+	 * and "a", "bc" differ) and integers are 8 bytes little-endian, finished with the
+	 * MurmurHash3 64-bit mix so that a one-byte change reaches every bit. Not cryptographic.
+	 */
+	class FStructuralHash
+	{
+	public:
+		/** UTF-8 bytes */
+		void AddString(std::string_view String);
+
+		void AddInteger(int64_t Value);
+
+		void AddBool(bool bValue);
+
+		/** Another hash, e.g. a child's in a Merkle tree */
+		void AddHash(uint64_t Hash) { AddInteger(static_cast<int64_t>(Hash)); }
+
+		uint64_t Finish() const;
+
+	private:
+		void AddBytes(const unsigned char* Data, size_t Length);
+
+		uint64_t State = 0xcbf29ce484222325ull;
+	};
+
+	/** 16 lowercase hex digits, as the export writes hashes */
+	std::string FormatHash(uint64_t Hash);
+
+	/** Inverse of FormatHash; false unless Text is exactly 16 hex digits */
+	bool ParseHash(std::string_view Text, uint64_t& OutHash);
+}
@@ -0,0 +1,144 @@
+// BlueprintGraphKnots.cpp
+
+#include "BlueprintGraphKnots.h"
+
+#include <utility>
+
+namespace BlueprintGraph
+{
+	FKnotMap::FKnotMap(const FGraph& InGraph)
+		: Graph(InGraph)
+		, PinOffsets(InGraph.MakePinOffsets())
+		, Slots(PinOffsets.back(), -1)
+		, InProgress(PinOffsets.back(), false)
+	{
+		for (int32_t NodeIndex = 0; NodeIndex < static_cast<int32_t>(Graph.Nodes.size()); ++NodeIndex)
+		{
+			const FNode& Node = Graph.Nodes[NodeIndex];
+			if (Node.bIsKnot)
+			{
+				continue;
+			}
+
+			for (int32_t PinIndex = 0; PinIndex < static_cast<int32_t>(Node.Pins.size()); ++PinIndex)
+			{
+				const std::vector<FPinRef>& Links = Node.Pins[PinIndex].Links;
+				bool bHasKnotLink = false;
+				for (const FPinRef& LinkedPin : Links)
+				{
+					bHasKnotLink |= IsKnotPin(LinkedPin);
+				}
+				if (!bHasKnotLink)
+				{
+					continue;
+				}
+
+				std::vector<FPinRef> Collapsed;
+				for (const FPinRef& LinkedPin : Links)
+				{
+					if (IsKnotPin(LinkedPin))
+					{
+						// Endpoints may reallocate while resolving; index it afterwards
+						const int32_t KnotSlot = ResolveKnot(LinkedPin);
+						Collapsed.insert(Collapsed.end(), Endpoints[KnotSlot].begin(), Endpoints[KnotSlot].end());
+					}
+					else
+					{
+						Collapsed.push_back(LinkedPin);
+					}
+				}
+
+				Slots[PinOffsets[NodeIndex] + PinIndex] = static_cast<int32_t>(Endpoints.size());
+				Endpoints.push_back(std::move(Collapsed));
+			}
+		}
+	}
+
+	FPinRef FKnotMap::FindOppositeKnotPin(FPinRef KnotPin) const
+	{
+		const FNode& Knot = Graph.Nodes[KnotPin.Node];
+		const bool bIsInput = Knot.Pins[KnotPin.Pin].bIsInput;
+		for (int32_t PinIndex = 0; PinIndex < static_cast<int32_t>(Knot.Pins.size()); ++PinIndex)
+		{
+			if (Knot.Pins[PinIndex].bIsInput != bIsInput)
+			{
+				return { KnotPin.Node, PinIndex };
+			}
+		}
+		return {};
+	}
+
+	int32_t FKnotMap::ResolveKnot(FPinRef RootPin)
+	{
+		if (Slots[DenseIndex(RootPin)] >= 0)
+		{
+			return Slots[DenseIndex(RootPin)];
+		}
+
+		// Depth-first over the knot chain with an explicit stack; a knot's endpoints are
+		// the endpoints of everything linked to its opposite pin, in link order
+		struct FFrame
+		{
+			FPinRef KnotPin;
+			FPinRef OppositePin;
+			int32_t NextLink;
+		};
+
+		std::vector<FFrame> Stack;
+
+		auto Enter = [&Stack, this](FPinRef KnotPin)
+		{
+			InProgress[DenseIndex(KnotPin)] = true;
+			Slots[DenseIndex(KnotPin)] = static_cast<int32_t>(Endpoints.size());
+			Endpoints.emplace_back();
+			Stack.push_back({ KnotPin, FindOppositeKnotPin(KnotPin), 0 });
+		};
+
+		Enter(RootPin);
+		while (!Stack.empty())
+		{
+			FFrame& Frame = Stack.back();
+			const int32_t FrameSlot = Slots[DenseIndex(Frame.KnotPin)];
+
+			const std::vector<FPinRef>* OppositeLinks = Frame.OppositePin.Node >= 0 ? &Graph.GetPin(Frame.OppositePin).Links : nullptr;
+			if (!OppositeLinks || Frame.NextLink >= static_cast<int32_t>(OppositeLinks->size()))
+			{
+				const FPinRef FinishedPin = Frame.KnotPin;
+				InProgress[DenseIndex(FinishedPin)] = false;
+				Stack.pop_back();
+
+				if (!Stack.empty())
+				{
+					const std::vector<FPinRef>& Finished = Endpoints[FrameSlot];
+					std::vector<FPinRef>& Parent = Endpoints[Slots[DenseIndex(Stack.back().KnotPin)]];
+					Parent.insert(Parent.end(), Finished.begin(), Finished.end());
+				}
+				continue;
+			}
+
+			const FPinRef LinkedPin = (*OppositeLinks)[Frame.NextLink++];
+			if (!IsKnotPin(LinkedPin))
+			{
+				Endpoints[FrameSlot].push_back(LinkedPin);
+				continue;
+			}
+
+			const int32_t LinkedSlot = Slots[DenseIndex(LinkedPin)];
+			if (LinkedSlot >= 0)
+			{
+				// A knot still on the stack means a loop: cut it here
+				if (!InProgress[DenseIndex(LinkedPin)])
+				{
+					const std::vector<FPinRef>& Known = Endpoints[LinkedSlot];
+					Endpoints[FrameSlot].insert(Endpoints[FrameSlot].end(), Known.begin(), Known.end());
+				}
+				continue;
+			}
+
+			// Invalidates Frame; it is fetched again at the top of the loop
+			Enter(LinkedPin);
+		}
+
+		return Slots[DenseIndex(RootPin)];
+	}
+}
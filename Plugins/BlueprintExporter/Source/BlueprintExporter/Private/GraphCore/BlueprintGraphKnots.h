@@ -0,0 +1,59 @@
+// BlueprintGraphKnots.h
+// Per-graph collapse of reroute (knot) node chains
+
+#pragma once
+
+#include "BlueprintGraphModel.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace BlueprintGraph
+{
+	/**
+	 * Maps every pin that links into a knot chain to the real pins at the other end
+	 *
+	 * Built in one pass per graph, with each knot resolved once however many pins
+	 * reach it (linear in the number of links). Knot loops are cut instead of
+	 * recursing forever: a chain that leads back into itself contributes nothing.
+	 * Holds a reference to the graph, which must outlive it.
+	 */
+	class FKnotMap
+	{
+	public:
+		explicit FKnotMap(const FGraph& InGraph);
+
+		/**
+		 * The pins Pin is connected to with knot nodes collapsed, in link order
+		 * Pins without knot links return their own Links.
+		 */
+		const std::vector<FPinRef>& GetLinkedPins(FPinRef Pin) const
+		{
+			const int32_t Slot = Slots[PinOffsets[Pin.Node] + Pin.Pin];
+			return Slot >= 0 ? Endpoints[Slot] : Graph.GetPin(Pin).Links;
+		}
+
+		bool IsKnotPin(FPinRef Pin) const { return Graph.Nodes[Pin.Node].bIsKnot; }
+
+	private:
+		/** Endpoints reached by entering a knot through RootPin (memoized); returns the slot */
+		int32_t ResolveKnot(FPinRef RootPin);
+
+		/** The first pin of a knot facing the other way, or an invalid reference */
+		FPinRef FindOppositeKnotPin(FPinRef KnotPin) const;
+
+		int32_t DenseIndex(FPinRef Pin) const { return PinOffsets[Pin.Node] + Pin.Pin; }
+
+		const FGraph& Graph;
+		std::vector<int32_t> PinOffsets;
+
+		// Dense pin index -> index into Endpoints, or -1. Non-knot pins get a slot only if
+		// they have at least one knot link (their collapsed links); knot pins get one when
+		// resolved (the endpoints reached through them)
+		std::vector<int32_t> Slots;
+		std::vector<std::vector<FPinRef>> Endpoints;
+
+		// Dense pin index -> knot pin currently on the resolve stack
+		std::vector<bool> InProgress;
+	};
+}
@@ -0,0 +1,88 @@
+// BlueprintGraphModel.cpp
+
+#include "BlueprintGraphModel.h"
+
+#include <utility>
+
+namespace BlueprintGraph
+{
+	int32_t FGraph::AddNode(std::string NodeName, ENodeKind Kind)
+	{
+		FNode& Node = Nodes.emplace_back();
+		Node.Name = std::move(NodeName);
+		Node.Kind = Kind;
+		return static_cast<int32_t>(Nodes.size()) - 1;
+	}
+
+	FPinRef FGraph::AddPin(int32_t Node, std::string PinName, bool bIsInput, bool bIsExec)
+	{
+		std::vector<FPin>& Pins = Nodes[Node].Pins;
+		FPin& Pin = Pins.emplace_back();
+		Pin.Name = std::move(PinName);
+		Pin.bIsInput = bIsInput;
+		Pin.bIsExec = bIsExec;
+		if (bIsExec)
+		{
+			Pin.Type = "exec";
+		}
+		return { Node, static_cast<int32_t>(Pins.size()) - 1 };
+	}
+
+	void FGraph::Link(FPinRef A, FPinRef B)
+	{
+		Nodes[A.Node].Pins[A.Pin].Links.push_back(B);
+		Nodes[B.Node].Pins[B.Pin].Links.push_back(A);
+	}
+
+	std::vector<int32_t> FGraph::MakePinOffsets() const
+	{
+		std::vector<int32_t> Offsets;
+		Offsets.reserve(Nodes.size() + 1);
+		int32_t NumPins = 0;
+		for (const FNode& Node : Nodes)
+		{
+			Offsets.push_back(NumPins);
+			NumPins += static_cast<int32_t>(Node.Pins.size());
+		}
+		Offsets.push_back(NumPins);
+		return Offsets;
+	}
+
+	static unsigned char ToLowerAscii(unsigned char Char)
+	{
+		return Char >= 'A' && Char <= 'Z' ? static_cast<unsigned char>(Char + ('a' - 'A')) : Char;
+	}
+
+	int CompareNames(std::string_view A, std::string_view B)
+	{
+		const size_t Length = A.size() < B.size() ? A.size() : B.size();
+		for (size_t Index = 0; Index < Length; ++Index)
+		{
+			const unsigned char CharA = ToLowerAscii(static_cast<unsigned char>(A[Index]));
+			const unsigned char CharB = ToLowerAscii(static_cast<unsigned char>(B[Index]));
+			if (CharA != CharB)
+			{
+				return CharA < CharB ? -1 : 1;
+			}
+		}
+		return A.size() == B.size() ? 0 : (A.size() < B.size() ? -1 : 1);
+	}
+
+	bool LessPath(std::string_view A, std::string_view B)
+	{
+		const int Order = CompareNames(A, B);
+		return Order != 0 ? Order < 0 : A < B;
+	}
+
+	size_t FPathHash::operator()(std::string_view Path) const
+	{
+		// FNV-1a over the lowercased bytes
+		uint64_t Hash = 14695981039346656037ull;
+		for (const char Char : Path)
+		{
+			Hash ^= ToLowerAscii(static_cast<unsigned char>(Char));
+			Hash *= 1099511628211ull;
+		}
+		return static_cast<size_t>(Hash);
+	}
+}
@@ -0,0 +1,127 @@
+// BlueprintGraphModel.h
+// Engine-independent graph model: nodes, pins and links (C++17, no dependencies)
+//
+// Everything the graph algorithms of the exporter work on: knot collapsing, execution
+// ordering, dependency collection and the node type/symbol strings. In the editor
+// FBlueprintGraphAdapter fills it from a UEdGraph; the tests and tools under
+// Tools/GraphCore build it directly. Nodes and pins refer to each other by index, so
+// the model can be copied and compared freely.
+//
+// Strings are UTF-8.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace BlueprintGraph
+{
+	/** What a node does, as far as its exported type and symbol are concerned */
+	enum class ENodeKind : uint8_t
+	{
+		Other,
+		Event,
+		FunctionEntry,
+		CallFunction,
+		VariableGet,
+		VariableSet,
+		// Spawn Actor, Construct Object, Create Widget...
+		Construct
+	};
+
+	/** A pin of the graph: the node's index in FGraph::Nodes, the pin's index in FNode::Pins */
+	struct FPinRef
+	{
+		int32_t Node = -1;
+		int32_t Pin = -1;
+
+		bool operator==(const FPinRef& Other) const { return Node == Other.Node && Pin == Other.Pin; }
+		bool operator!=(const FPinRef& Other) const { return !(*this == Other); }
+	};
+
+	struct FPin
+	{
+		std::string Name;
+		bool bIsInput = false;
+		bool bIsExec = false;
+		// Delegate pins are followed by the ordering but never exported
+		bool bIsDelegate = false;
+		std::string Type;
+		std::string DefaultValue;
+		// Path of the default object of an object pin, a dependency of the blueprint
+		std::string DefaultObject;
+		// Links as the editor holds them, both ways, knots included
+		std::vector<FPinRef> Links;
+	};
+
+	struct FNode
+	{
+		// Unique within the graph; also the export id
+		std::string Name;
+		std::string Title;
+		ENodeKind Kind = ENodeKind::Other;
+		// Node class, the exported type of Other nodes
+		std::string ClassName;
+		// CallFunction, VariableGet, VariableSet: the member and the path of the class owning it
+		// (self members resolved to the blueprint's class); Construct: the spawned class in MemberClass
+		std::string MemberName;
+		std::string MemberClass;
+		// CallFunction: path of the function's class as referenced, a dependency of the blueprint
+		std::string FunctionClass;
+		// Reroute node: collapsed away, never exported
+		bool bIsKnot = false;
+		// Execution starts here (events, function entries)
+		bool bIsEntryPoint = false;
+		std::vector<FPin> Pins;
+	};
+
+	struct FGraph
+	{
+		std::string Name;
+		std::vector<FNode> Nodes;
+
+		const FNode& GetNode(FPinRef Ref) const { return Nodes[Ref.Node]; }
+		const FPin& GetPin(FPinRef Ref) const { return Nodes[Ref.Node].Pins[Ref.Pin]; }
+
+		bool IsValid(FPinRef Ref) const
+		{
+			return Ref.Node >= 0 && Ref.Node < static_cast<int32_t>(Nodes.size())
+				&& Ref.Pin >= 0 && Ref.Pin < static_cast<int32_t>(Nodes[Ref.Node].Pins.size());
+		}
+
+		/** Append a node; returns its index */
+		int32_t AddNode(std::string NodeName, ENodeKind Kind = ENodeKind::Other);
+
+		/** Append a pin to Node; returns its reference */
+		FPinRef AddPin(int32_t Node, std::string PinName, bool bIsInput, bool bIsExec = false);
+
+		/** Link two pins both ways, like UEdGraphPin::MakeLinkTo */
+		void Link(FPinRef A, FPinRef B);
+
+		/** Dense index of every pin: pin P of node N is PinOffsets[N] + P; the last entry is the pin count */
+		std::vector<int32_t> MakePinOffsets() const;
+	};
+
+	/**
+	 * Order names the way the editor's FString operator< does: ASCII case-insensitively, by
+	 * code point otherwise (UTF-8 byte order is code point order)
+	 * @return Negative, zero or positive like strcmp
+	 */
+	int CompareNames(std::string_view A, std::string_view B);
+
+	/** Strict total order for paths: CompareNames, then bytewise so case variants stay apart and deterministic */
+	bool LessPath(std::string_view A, std::string_view B);
+
+	/** Hash and equality that agree with CompareNames: unordered path keys that ignore ASCII case, like FString keys */
+	struct FPathHash
+	{
+		size_t operator()(std::string_view Path) const;
+	};
+
+	struct FPathEqual
+	{
+		bool operator()(std::string_view A, std::string_view B) const { return CompareNames(A, B) == 0; }
+	};
+}
@@ -0,0 +1,207 @@
+// BlueprintGraphOrdering.cpp
+
+#include "BlueprintGraphOrdering.h"
+#include "BlueprintGraphKnots.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace BlueprintGraph
+{
+	/** Rank Count items by name with CompareNames, equal names sharing a rank */
+	template <typename NameFunctionType, typename SetRankFunctionType>
+	static void RankByName(int32_t Count, NameFunctionType GetName, SetRankFunctionType SetRank)
+	{
+		std::vector<int32_t> Order(Count);
+		std::iota(Order.begin(), Order.end(), 0);
+		std::stable_sort(Order.begin(), Order.end(), [&GetName](int32_t A, int32_t B)
+		{
+			return CompareNames(GetName(A), GetName(B)) < 0;
+		});
+
+		int32_t Rank = 0;
+		for (int32_t Position = 0; Position < Count; ++Position)
+		{
+			if (Position > 0 && CompareNames(GetName(Order[Position - 1]), GetName(Order[Position])) < 0)
+			{
+				Rank = Position;
+			}
+			SetRank(Order[Position], Rank);
+		}
+	}
+
+	FNodeOrdering::FNodeOrdering(const FGraph& Graph, const FKnotMap& Knots)
+		: DenseIndices(Graph.Nodes.size(), -1)
+		, PinOffsets(Graph.MakePinOffsets())
+		, PinRanks(PinOffsets.back(), 0)
+	{
+		// 1. Dense indices (knots are collapsed and never exported)
+		for (int32_t NodeIndex = 0; NodeIndex < static_cast<int32_t>(Graph.Nodes.size()); ++NodeIndex)
+		{
+			if (!Graph.Nodes[NodeIndex].bIsKnot)
+			{
+				DenseIndices[NodeIndex] = static_cast<int32_t>(Nodes.size());
+				Nodes.push_back(NodeIndex);
+			}
+		}
+
+		const int32_t NumNodes = static_cast<int32_t>(Nodes.size());
+		OrderedNodes.reserve(NumNodes);
+		Visited.assign(NumNodes, false);
+
+		// 2. Sort keys, computed once
+		NodeRanks.assign(NumNodes, 0);
+		RankByName(NumNodes,
+			[this, &Graph](int32_t Dense) -> const std::string& { return Graph.Nodes[Nodes[Dense]].Name; },
+			[this](int32_t Dense, int32_t Rank) { NodeRanks[Dense] = Rank; });
+
+		for (const int32_t NodeIndex : Nodes)
+		{
+			const std::vector<FPin>& Pins = Graph.Nodes[NodeIndex].Pins;
+			const int32_t FirstPin = PinOffsets[NodeIndex];
+			RankByName(static_cast<int32_t>(Pins.size()),
+				[&Pins](int32_t Pin) -> const std::string& { return Pins[Pin].Name; },
+				[this, FirstPin](int32_t Pin, int32_t Rank) { PinRanks[FirstPin + Pin] = Rank; });
+		}
+
+		// 3. Adjacency, sorted once per graph
+		InputOffsets.reserve(NumNodes + 1);
+		ExecOffsets.reserve(NumNodes + 1);
+		std::vector<int32_t> ExecOutputs;
+		for (const int32_t NodeIndex : Nodes)
+		{
+			InputOffsets.push_back(static_cast<int32_t>(InputTargets.size()));
+			ExecOffsets.push_back(static_cast<int32_t>(ExecTargets.size()));
+
+			const std::vector<FPin>& Pins = Graph.Nodes[NodeIndex].Pins;
+
+			// Input dependencies, in pin order
+			for (int32_t Pin = 0; Pin < static_cast<int32_t>(Pins.size()); ++Pin)
+			{
+				if (Pins[Pin].bIsInput)
+				{
+					AppendSortedLinks({ NodeIndex, Pin }, Knots, InputTargets);
+				}
+			}
+
+			// Exec successors, exec outputs in name order
+			ExecOutputs.clear();
+			for (int32_t Pin = 0; Pin < static_cast<int32_t>(Pins.size()); ++Pin)
+			{
+				if (!Pins[Pin].bIsInput && Pins[Pin].bIsExec)
+				{
+					ExecOutputs.push_back(Pin);
+				}
+			}
+			const int32_t FirstPin = PinOffsets[NodeIndex];
+			std::stable_sort(ExecOutputs.begin(), ExecOutputs.end(), [this, FirstPin](int32_t A, int32_t B)
+			{
+				return PinRanks[FirstPin + A] < PinRanks[FirstPin + B];
+			});
+
+			for (const int32_t Pin : ExecOutputs)
+			{
+				AppendSortedLinks({ NodeIndex, Pin }, Knots, ExecTargets);
+			}
+		}
+		InputOffsets.push_back(static_cast<int32_t>(InputTargets.size()));
+		ExecOffsets.push_back(static_cast<int32_t>(ExecTargets.size()));
+
+		// 4. Entry points by name, then whatever they didn't reach, by name
+		std::vector<int32_t> ByRank(NumNodes);
+		std::iota(ByRank.begin(), ByRank.end(), 0);
+		std::stable_sort(ByRank.begin(), ByRank.end(), [this](int32_t A, int32_t B) { return NodeRanks[A] < NodeRanks[B]; });
+
+		for (const int32_t Dense : ByRank)
+		{
+			if (Graph.Nodes[Nodes[Dense]].bIsEntryPoint)
+			{
+				Walk(Dense);
+			}
+		}
+
+		for (const int32_t Dense : ByRank)
+		{
+			if (!Visited[Dense])
+			{
+				Visited[Dense] = true;
+				OrderedNodes.push_back(Nodes[Dense]);
+			}
+		}
+	}
+
+	void FNodeOrdering::AppendSortedLinks(FPinRef Pin, const FKnotMap& Knots, std::vector<int32_t>& OutTargets)
+	{
+		LinkScratch.clear();
+		for (const FPinRef& LinkedPin : Knots.GetLinkedPins(Pin))
+		{
+			const int32_t Dense = DenseIndices[LinkedPin.Node];
+			if (Dense < 0)
+			{
+				continue;
+			}
+
+			const int32_t PinRank = PinRanks[PinOffsets[LinkedPin.Node] + LinkedPin.Pin];
+			const int64_t SortKey = (static_cast<int64_t>(NodeRanks[Dense]) << 32) | static_cast<uint32_t>(PinRank);
+			LinkScratch.push_back({ Dense, SortKey });
+		}
+
+		std::stable_sort(LinkScratch.begin(), LinkScratch.end(), [](const FLink& A, const FLink& B) { return A.SortKey < B.SortKey; });
+
+		for (const FLink& Link : LinkScratch)
+		{
+			OutTargets.push_back(Link.Dense);
+		}
+	}
+
+	void FNodeOrdering::Walk(int32_t Root)
+	{
+		if (Visited[Root])
+		{
+			return;
+		}
+
+		// Each frame first walks its input dependencies, then emits its node, then walks
+		// its exec successors; nodes are marked when entered so cycles end there
+		struct FFrame
+		{
+			int32_t Node;
+			int32_t Cursor;
+			bool bEmitted;
+		};
+
+		std::vector<FFrame> Stack;
+		Visited[Root] = true;
+		Stack.push_back({ Root, InputOffsets[Root], false });
+
+		while (!Stack.empty())
+		{
+			FFrame& Frame = Stack.back();
+
+			const std::vector<int32_t>& Offsets = Frame.bEmitted ? ExecOffsets : InputOffsets;
+			const std::vector<int32_t>& Targets = Frame.bEmitted ? ExecTargets : InputTargets;
+
+			if (Frame.Cursor < Offsets[Frame.Node + 1])
+			{
+				const int32_t Next = Targets[Frame.Cursor++];
+				if (!Visited[Next])
+				{
+					Visited[Next] = true;
+					// Invalidates Frame; it is fetched again at the top of the loop
+					Stack.push_back({ Next, InputOffsets[Next], false });
+				}
+				continue;
+			}
+
+			if (!Frame.bEmitted)
+			{
+				OrderedNodes.push_back(Nodes[Frame.Node]);
+				Frame.bEmitted = true;
+				Frame.Cursor = ExecOffsets[Frame.Node];
+				continue;
+			}
+
+			Stack.pop_back();
+		}
+	}
+}
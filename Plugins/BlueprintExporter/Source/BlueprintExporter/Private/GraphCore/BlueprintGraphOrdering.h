@@ -0,0 +1,70 @@
+// BlueprintGraphOrdering.h
+// Execution-flow node order for a graph, computed iteratively over dense node indices
+
+#pragma once
+
+#include "BlueprintGraphModel.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace BlueprintGraph
+{
+	class FKnotMap;
+
+	/**
+	 * Orders the nodes of a graph the way they are exported
+	 *
+	 *   1. Entry points (events, function entries) sorted by name
+	 *   2. From each entry point, depth-first: a node's input dependencies first
+	 *      (inputs in pin order, links sorted by node then pin name), then the node,
+	 *      then its exec successors (exec outputs sorted by pin name)
+	 *   3. Every node not reached, sorted by name
+	 *
+	 * Names are compared once up front to give each node and pin an integer rank,
+	 * adjacency lists are built and sorted once, and the walk uses an explicit stack,
+	 * so very long exec chains cost no recursion depth and no string compares.
+	 * Equal names keep graph order.
+	 */
+	class FNodeOrdering
+	{
+	public:
+		FNodeOrdering(const FGraph& Graph, const FKnotMap& Knots);
+
+		/** Indices into FGraph::Nodes of every node except knots, in export order */
+		const std::vector<int32_t>& GetOrderedNodes() const { return OrderedNodes; }
+
+	private:
+		/** Dense node indices linked from Pin, sorted by (node rank, pin rank) */
+		void AppendSortedLinks(FPinRef Pin, const FKnotMap& Knots, std::vector<int32_t>& OutTargets);
+
+		/** Depth-first walk from Root, appending to OrderedNodes */
+		void Walk(int32_t Root);
+
+		// Dense index -> graph node index (graph order, knots excluded), and back (-1 for knots)
+		std::vector<int32_t> Nodes;
+		std::vector<int32_t> DenseIndices;
+
+		// Position of each node / pin when sorted by name (equal names share a rank)
+		std::vector<int32_t> NodeRanks;
+		std::vector<int32_t> PinOffsets;
+		std::vector<int32_t> PinRanks;
+
+		// Per dense node: [Offsets[i], Offsets[i + 1]) into Targets
+		std::vector<int32_t> InputOffsets;
+		std::vector<int32_t> InputTargets;
+		std::vector<int32_t> ExecOffsets;
+		std::vector<int32_t> ExecTargets;
+
+		// Reused by AppendSortedLinks
+		struct FLink
+		{
+			int32_t Dense;
+			int64_t SortKey;
+		};
+		std::vector<FLink> LinkScratch;
+
+		std::vector<bool> Visited;
+		std::vector<int32_t> OrderedNodes;
+	};
+}
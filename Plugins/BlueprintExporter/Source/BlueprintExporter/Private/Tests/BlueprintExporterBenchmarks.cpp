@@ -0,0 +1,211 @@
+// BlueprintExporterBenchmarks.cpp
+// Export stage benchmarks on synthetic graphs, run as an editor automation test
+//
+// Session Frontend → Automation → BlueprintExporter.Performance.Benchmarks, or
+//   UnrealEditor-Cmd MyProject.uproject -ExecCmds="Automation RunTests BlueprintExporter.Performance;Quit" -unattended
+//
+// Measures the stages the standalone benchmark (Tools/GraphCore) can't: Capture (graph
+// model to snapshot, knots and ordering included), Json, Markdown and Diff (against a copy
+// with every 16th node edited), alongside the Knots and Order stages both share. Results
+// are logged and written in baseline form to Saved/BlueprintExporter/BenchmarkResults.txt;
+// copy that over Tools/GraphCore/Benchmarks/EditorBaseline.txt to accept them. Allocation
+// and output size regressions against the baseline fail the test, timing regressions only
+// warn. A missing or empty baseline fails it too, so the editor stages are never left
+// unchecked.
+
+#include "BlueprintExporter.h"
+#include "BlueprintGraphAdapter.h"
+#include "BlueprintSnapshotDiff.h"
+#include "BlueprintSnapshotHash.h"
+#include "GraphCore/BlueprintGraphBenchmark.h"
+#include "GraphCore/BlueprintGraphKnots.h"
+#include "GraphCore/BlueprintGraphOrdering.h"
+#include "HAL/MemoryBase.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace BlueprintExporterBenchmarks
+{
+	// Fastest of this many runs per stage
+	constexpr int32 Iterations = 3;
+
+#if STATS
+	/** Allocations so far, process-wide, as counted by allocators that report their calls */
+	static uint64_t CountAllocations()
+	{
+		return static_cast<uint64>(FMalloc::TotalMallocCalls) + static_cast<uint64>(FMalloc::TotalReallocCalls);
+	}
+
+	static const BlueprintGraph::FAllocationCounter AllocationCounter = &CountAllocations;
+#else
+	// Only stats builds count allocations; the results leave them out
+	static const BlueprintGraph::FAllocationCounter AllocationCounter = nullptr;
+#endif
+
+	/** Blueprint-level data around the generated graphs, so the JSON and Markdown have every section */
+	static void FillSnapshot(const FString& ScenarioName, const std::vector<BlueprintGraph::FGraph>& Graphs, FBlueprintSnapshot& OutSnapshot)
+	{
+		OutSnapshot.Name = TEXT("BP_") + ScenarioName;
+		OutSnapshot.Path = FString::Printf(TEXT("/Game/Synthetic/BP_%s.BP_%s"), *ScenarioName, *ScenarioName);
+		OutSnapshot.PackageName = TEXT("/Game/Synthetic/BP_") + ScenarioName;
+		OutSnapshot.ParentClass = TEXT("Actor");
+		OutSnapshot.GeneratedClass = OutSnapshot.Name + TEXT("_C");
+
+		for (int32 GraphIndex = 1; GraphIndex < static_cast<int32>(Graphs.size()); ++GraphIndex)
+		{
+			FBlueprintFunctionSnapshot& Function = OutSnapshot.Functions.AddDefaulted_GetRef();
+			Function.Name = FBlueprintGraphAdapter::FromUtf8(Graphs[GraphIndex].Name);
+			Function.GraphIndex = GraphIndex;
+		}
+
+		for (int32 Variable = 0; Variable < 64; ++Variable)
+		{
+			FBlueprintVariableSnapshot& VarSnapshot = OutSnapshot.Variables.AddDefaulted_GetRef();
+			VarSnapshot.Name = FString::Printf(TEXT("Variable_%d"), Variable);
+			VarSnapshot.Type = TEXT("float");
+			VarSnapshot.Category = TEXT("Default");
+		}
+
+		OutSnapshot.Dependencies = FBlueprintGraphAdapter::GetDependencies(Graphs);
+	}
+
+	static void RunScenario(const BlueprintGraph::FBenchmarkScenario& Scenario, std::vector<BlueprintGraph::FBenchmarkResult>& OutResults)
+	{
+		const std::vector<BlueprintGraph::FGraph> Graphs = BlueprintGraph::GenerateGraphs(Scenario.Settings);
+		const int64_t Nodes = BlueprintGraph::CountNodes(Graphs);
+		const FString ScenarioName = FBlueprintGraphAdapter::FromUtf8(Scenario.Name);
+
+		OutResults.push_back(BlueprintGraph::MeasureStage(Scenario.Name, "Knots", Nodes, Iterations, AllocationCounter, [&Graphs]()
+		{
+			for (const BlueprintGraph::FGraph& Graph : Graphs)
+			{
+				const BlueprintGraph::FKnotMap Knots(Graph);
+			}
+			return int64_t(-1);
+		}));
+
+		std::vector<BlueprintGraph::FKnotMap> KnotMaps(Graphs.begin(), Graphs.end());
+		OutResults.push_back(BlueprintGraph::MeasureStage(Scenario.Name, "Order", Nodes, Iterations, AllocationCounter, [&Graphs, &KnotMaps]()
+		{
+			for (size_t GraphIndex = 0; GraphIndex < Graphs.size(); ++GraphIndex)
+			{
+				const BlueprintGraph::FNodeOrdering Ordering(Graphs[GraphIndex], KnotMaps[GraphIndex]);
+			}
+			return int64_t(-1);
+		}));
+
+		FBlueprintSnapshot Snapshot;
+		OutResults.push_back(BlueprintGraph::MeasureStage(Scenario.Name, "Capture", Nodes, Iterations, AllocationCounter, [&Graphs, &Snapshot]()
+		{
+			Snapshot.Graphs.Reset(static_cast<int32>(Graphs.size()));
+			for (const BlueprintGraph::FGraph& Graph : Graphs)
+			{
+				UBlueprintExporterLibrary::CaptureGraph(Graph, Snapshot.Graphs.AddDefaulted_GetRef());
+			}
+			return int64_t(-1);
+		}));
+		FillSnapshot(ScenarioName, Graphs, Snapshot);
+
+		// The synthetic graphs are ASCII, so characters are the UTF-8 bytes written
+		OutResults.push_back(BlueprintGraph::MeasureStage(Scenario.Name, "Json", Nodes, Iterations, AllocationCounter, [&Snapshot]()
+		{
+			FString Json;
+			UBlueprintExporterLibrary::SnapshotToJsonString(Snapshot, true, Json);
+			return int64_t(Json.Len());
+		}));
+
+		OutResults.push_back(BlueprintGraph::MeasureStage(Scenario.Name, "Markdown", Nodes, Iterations, AllocationCounter, [&Snapshot]()
+		{
+			return int64_t(UBlueprintExporterLibrary::GenerateMarkdown(Snapshot).Len());
+		}));
+
+		// An edited version: a default value changed on every 16th node that has an input pin
+		FBlueprintSnapshot EditedSnapshot = Snapshot;
+		for (FBlueprintGraphSnapshot& Graph : EditedSnapshot.Graphs)
+		{
+			for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); NodeIndex += 16)
+			{
+				for (FBlueprintPinSnapshot& Pin : Graph.Nodes[NodeIndex].Pins)
+				{
+					if (Pin.bIsInput)
+					{
+						Pin.DefaultValue += TEXT("1");
+						break;
+					}
+				}
+			}
+			FBlueprintSnapshotHash::UpdateGraph(Graph);
+		}
+		Snapshot.Hash = FBlueprintSnapshotHash::HashBlueprint(Snapshot);
+		EditedSnapshot.Hash = FBlueprintSnapshotHash::HashBlueprint(EditedSnapshot);
+
+		OutResults.push_back(BlueprintGraph::MeasureStage(Scenario.Name, "Diff", Nodes, Iterations, AllocationCounter, [&Snapshot, &EditedSnapshot]()
+		{
+			FBlueprintDiff Diff;
+			FBlueprintSnapshotDiff::DiffSnapshots(Snapshot, EditedSnapshot, Diff);
+			return int64_t(-1);
+		}));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBlueprintExporterBenchmarkTest, "BlueprintExporter.Performance.Benchmarks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FBlueprintExporterBenchmarkTest::RunTest(const FString& Parameters)
+{
+	std::vector<BlueprintGraph::FBenchmarkResult> Results;
+	for (const BlueprintGraph::FBenchmarkScenario& Scenario : BlueprintGraph::GetBenchmarkScenarios())
+	{
+		BlueprintExporterBenchmarks::RunScenario(Scenario, Results);
+	}
+
+	TArray<FString> Lines;
+	FBlueprintGraphAdapter::FromUtf8(BlueprintGraph::FormatResults(Results)).ParseIntoArrayLines(Lines);
+	for (const FString& Line : Lines)
+	{
+		UE_LOG(LogBlueprintExporter, Display, TEXT("%s"), *Line);
+	}
+
+	const FString ResultsPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("BlueprintExporter"), TEXT("BenchmarkResults.txt"));
+	if (!FFileHelper::SaveStringToFile(FBlueprintGraphAdapter::FromUtf8(BlueprintGraph::WriteBaseline(Results)), *ResultsPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		AddWarning(FString::Printf(TEXT("Failed to write %s"), *ResultsPath));
+	}
+
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("BlueprintExporter"));
+	const FString BaselinePath = Plugin.IsValid() ? FPaths::Combine(Plugin->GetBaseDir(), TEXT("Tools/GraphCore/Benchmarks/EditorBaseline.txt")) : FString();
+
+	FString BaselineText;
+	if (BaselinePath.IsEmpty() || !FFileHelper::LoadFileToString(BaselineText, *BaselinePath))
+	{
+		AddError(FString::Printf(TEXT("No editor baseline at %s; copy %s there to record one"), *BaselinePath, *ResultsPath));
+		return true;
+	}
+
+	const std::vector<BlueprintGraph::FBenchmarkResult> Baseline = BlueprintGraph::ParseBaseline(FBlueprintGraphAdapter::ToUtf8(BaselineText));
+	if (Baseline.empty())
+	{
+		AddError(FString::Printf(TEXT("%s has no entries; copy %s over it to record a baseline"), *BaselinePath, *ResultsPath));
+		return true;
+	}
+
+	for (const BlueprintGraph::FBenchmarkRegression& Regression : BlueprintGraph::FindRegressions(Baseline, Results))
+	{
+		const FString Message = FBlueprintGraphAdapter::FromUtf8(BlueprintGraph::FormatRegression(Regression));
+		if (Regression.bIsTiming)
+		{
+			AddWarning(Message);
+		}
+		else
+		{
+			AddError(Message);
+		}
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,159 @@
+// BlueprintAutoExportSubsystem.h
+// Re-exports blueprints in the background as they are saved
+// Place this in: Plugins/BlueprintExporter/Source/BlueprintExporter/Public/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "Tickable.h"
+#include "AssetRegistry/AssetData.h"
+#include "UObject/ObjectSaveContext.h"
+#include "BlueprintAutoExportSubsystem.generated.h"
+
+/**
+ * Per-session statistics for the auto-export service
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTEXPORTER_API FBlueprintAutoExportStats
+{
+	GENERATED_BODY()
+
+	/** Save/update events received for blueprints */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	int32 EventsReceived = 0;
+
+	/** Events folded into an export that was already pending (debounced) */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	int32 EventsCoalesced = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	int32 ExportedCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	int32 FailedCount = 0;
+
+	/** Blueprints waiting for their debounce period or for tick budget */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	int32 PendingCount = 0;
+
+	/** Game-thread time spent capturing blueprints */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	float TotalCaptureMs = 0.0f;
+
+	/** Longest single capture */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	float MaxCaptureMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	FString LastExportedBlueprint;
+};
+
+/**
+ * Auto-export service
+ *
+ * Listens for blueprint package saves and asset registry updates, waits until a
+ * blueprint has been quiet for the debounce period, then re-exports it on the editor
+ * tick. Blueprints open in an editor go first. Each tick exports about as many blueprints
+ * as their average capture time fits into the tick budget, and at least one.
+ *
+ * Exports go through FBlueprintBulkExporter like any other subset of the project, so
+ * they honour the bundle and format settings and update the manifest, the dependency,
+ * symbol and project indexes as they are on disk, next to other exports of the directory.
+ *
+ * Python: unreal.get_editor_subsystem(unreal.BlueprintAutoExportSubsystem).start()
+ */
+UCLASS()
+class BLUEPRINTEXPORTER_API UBlueprintAutoExportSubsystem : public UEditorSubsystem, public FTickableEditorObject
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableEditorObject
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickable() const override { return bRunning && !bPaused; }
+	virtual TStatId GetStatId() const override;
+
+	/** Start listening for blueprint saves */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter|Auto Export")
+	void Start();
+
+	/** Stop listening and drop anything still queued */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter|Auto Export")
+	void Stop();
+
+	/** Keep collecting events but don't export until resumed */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter|Auto Export")
+	void Pause();
+
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter|Auto Export")
+	void Resume();
+
+	UFUNCTION(BlueprintPure, Category = "Blueprint Exporter|Auto Export")
+	bool IsRunning() const { return bRunning; }
+
+	UFUNCTION(BlueprintPure, Category = "Blueprint Exporter|Auto Export")
+	bool IsPaused() const { return bPaused; }
+
+	UFUNCTION(BlueprintPure, Category = "Blueprint Exporter|Auto Export")
+	FBlueprintAutoExportStats GetStats() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter|Auto Export")
+	void ResetStats();
+
+	/** Queue a blueprint package for export as if it had just been saved */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter|Auto Export")
+	void QueueBlueprint(const FString& PackageName);
+
+private:
+	struct FReadyExport
+	{
+		FName PackageName;
+		// Higher first; blueprints open in an editor get priority
+		int32 Priority = 0;
+		// Lower first among equal priorities (oldest event wins)
+		uint64 Sequence = 0;
+	};
+
+	struct FReadyExportPredicate
+	{
+		bool operator()(const FReadyExport& A, const FReadyExport& B) const
+		{
+			return A.Priority != B.Priority ? A.Priority > B.Priority : A.Sequence < B.Sequence;
+		}
+	};
+
+	void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+	void OnAssetUpdated(const FAssetData& AssetData);
+	void NotifyChanged(FName PackageName);
+
+	/** Move blueprints whose debounce period has elapsed into the ready queue */
+	void PromoteDebounced(double Now);
+
+	/** Export the blueprints of the packages as one batch */
+	void ExportPackages(const TArray<FName>& PackageNames);
+	int32 GetPriority(FName PackageName) const;
+
+	bool bRunning = false;
+	bool bPaused = false;
+
+	// Package -> time of the most recent save/update event
+	TMap<FName, double> Debouncing;
+
+	// Heap ordered by FReadyExportPredicate
+	TArray<FReadyExport> ReadyQueue;
+	TSet<FName> ReadySet;
+	uint64 NextSequence = 0;
+
+	FString OutputDirectory;
+
+	FBlueprintAutoExportStats Stats;
+
+	FDelegateHandle PackageSavedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+};
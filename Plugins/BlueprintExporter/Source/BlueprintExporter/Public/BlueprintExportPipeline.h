@@ -0,0 +1,209 @@
+// BlueprintExportPipeline.h
+// Single-pass export pipeline: capture a blueprint once, write it through several sinks
+// Place this in: Plugins/BlueprintExporter/Source/BlueprintExporter/Public/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintExportTypes.h"
+
+#include <atomic>
+
+class UBlueprint;
+struct FBlueprintExportConfig;
+enum class EBlueprintFileWriteResult : uint8;
+
+/**
+ * Options for the JSON output
+ */
+struct FBlueprintJsonOptions
+{
+	bool bPrettyPrint = true;
+
+	/**
+	 * Schema 2: functions reference their graph in the top-level "graphs" array by id
+	 * instead of embedding a second copy of it (see JSON-SCHEMA.md)
+	 */
+	bool bFunctionGraphsById = false;
+
+	/**
+	 * Schema 3: graph strings interned in a per-file table, nodes and pins as arrays,
+	 * connections by node and pin index; implies bFunctionGraphsById (see JSON-SCHEMA.md)
+	 */
+	bool bCompactSchema = false;
+};
+
+/**
+ * Output format for the export pipeline
+ * Receives the captured snapshot of each blueprint and writes one file.
+ * Write may be called concurrently from worker threads during a parallel export.
+ * Files are saved through SaveOutput, which leaves files whose content is unchanged untouched.
+ */
+class BLUEPRINTEXPORTER_API IBlueprintExportSink
+{
+public:
+	virtual ~IBlueprintExportSink() = default;
+
+	/** Short format name used in log messages (e.g. "JSON") */
+	virtual const TCHAR* GetFormatName() const = 0;
+
+	/** The file Write produces for a given base path */
+	virtual FString GetOutputPath(const FString& BasePath) const = 0;
+
+	/**
+	 * Write one blueprint
+	 * @param Snapshot - Captured blueprint data
+	 * @param BasePath - Output path without extension (sinks append their own)
+	 * @param OutBytes - Receives the size of the output, whether written or found unchanged on disk
+	 * @return True if the output was written
+	 */
+	virtual bool Write(const FBlueprintSnapshot& Snapshot, const FString& BasePath, int64& OutBytes) = 0;
+
+	/** Files this sink wrote */
+	int32 GetWrittenFileCount() const { return WrittenFileCount.load(std::memory_order_relaxed); }
+
+	/** Files this sink skipped because they already held the same content */
+	int32 GetUnchangedFileCount() const { return UnchangedFileCount.load(std::memory_order_relaxed); }
+
+protected:
+	/** Save a file unless it already holds Bytes (through a temporary file and a rename); OutBytes, if set, receives its size */
+	bool SaveOutput(const FString& FilePath, TArrayView<const uint8> Bytes, int64* OutBytes) const;
+
+	/** Save text as UTF-8 unless the file already holds it; OutBytes, if set, receives its size */
+	bool SaveOutput(const FString& FilePath, FStringView Text, int64* OutBytes) const;
+
+private:
+	bool CountWrite(EBlueprintFileWriteResult Result) const;
+
+	mutable std::atomic<int32> WrittenFileCount{ 0 };
+	mutable std::atomic<int32> UnchangedFileCount{ 0 };
+};
+
+/**
+ * Writes <BasePath>.json
+ */
+class BLUEPRINTEXPORTER_API FBlueprintJsonSink : public IBlueprintExportSink
+{
+public:
+	explicit FBlueprintJsonSink(bool bInPrettyPrint = true)
+	{
+		Options.bPrettyPrint = bInPrettyPrint;
+	}
+
+	explicit FBlueprintJsonSink(const FBlueprintJsonOptions& InOptions)
+		: Options(InOptions)
+	{
+	}
+
+	virtual const TCHAR* GetFormatName() const override { return TEXT("JSON"); }
+	virtual FString GetOutputPath(const FString& BasePath) const override { return BasePath + TEXT(".json"); }
+	virtual bool Write(const FBlueprintSnapshot& Snapshot, const FString& BasePath, int64& OutBytes) override;
+
+	/** Write to an explicit file path instead of <BasePath>.json */
+	bool WriteFile(const FBlueprintSnapshot& Snapshot, const FString& FilePath, int64* OutBytes = nullptr) const;
+
+private:
+	FBlueprintJsonOptions Options;
+};
+
+/**
+ * Writes <BasePath>.msgpack: the JSON schema encoded as MessagePack
+ * Objects are maps with the same keys, in the same order, as the JSON output.
+ */
+class BLUEPRINTEXPORTER_API FBlueprintMsgPackSink : public IBlueprintExportSink
+{
+public:
+	/** bPrettyPrint doesn't apply; the other options select the schema as for JSON */
+	explicit FBlueprintMsgPackSink(const FBlueprintJsonOptions& InOptions = FBlueprintJsonOptions())
+		: Options(InOptions)
+	{
+	}
+
+	virtual const TCHAR* GetFormatName() const override { return TEXT("MessagePack"); }
+	virtual FString GetOutputPath(const FString& BasePath) const override { return BasePath + TEXT(".msgpack"); }
+	virtual bool Write(const FBlueprintSnapshot& Snapshot, const FString& BasePath, int64& OutBytes) override;
+
+	/** Write to an explicit file path instead of <BasePath>.msgpack */
+	bool WriteFile(const FBlueprintSnapshot& Snapshot, const FString& FilePath, int64* OutBytes = nullptr) const;
+
+	/** Encode a captured blueprint */
+	static bool SnapshotToBytes(const FBlueprintSnapshot& Snapshot, const FBlueprintJsonOptions& Options, TArray<uint8>& OutBytes);
+
+private:
+	FBlueprintJsonOptions Options;
+};
+
+/**
+ * Writes <BasePath>.md
+ */
+class BLUEPRINTEXPORTER_API FBlueprintMarkdownSink : public IBlueprintExportSink
+{
+public:
+	virtual const TCHAR* GetFormatName() const override { return TEXT("Markdown"); }
+	virtual FString GetOutputPath(const FString& BasePath) const override { return BasePath + TEXT(".md"); }
+	virtual bool Write(const FBlueprintSnapshot& Snapshot, const FString& BasePath, int64& OutBytes) override;
+
+	/** Write to an explicit file path instead of <BasePath>.md */
+	bool WriteFile(const FBlueprintSnapshot& Snapshot, const FString& FilePath, int64* OutBytes = nullptr) const;
+};
+
+/**
+ * Captures each blueprint once and hands the snapshot to every registered sink
+ */
+class BLUEPRINTEXPORTER_API FBlueprintExportPipeline
+{
+public:
+	/** Pipeline with the JSON sink and, optionally, the Markdown sink */
+	static FBlueprintExportPipeline CreateDefault(bool bPrettyPrint, bool bGenerateMarkdown);
+
+	/** Pipeline with the data sink (JSON or MessagePack), Markdown sink and output options selected by an export configuration */
+	static FBlueprintExportPipeline CreateDefault(const FBlueprintExportConfig& Config);
+
+	/** Schema options selected by an export configuration */
+	static FBlueprintJsonOptions MakeJsonOptions(const FBlueprintExportConfig& Config);
+
+	/**
+	 * Register an output sink
+	 * @param Sink - The sink to add
+	 * @param bRequired - If true, a failed write fails the whole export; otherwise it is only logged
+	 */
+	void AddSink(const TSharedRef<IBlueprintExportSink>& Sink, bool bRequired = true);
+
+	/**
+	 * Capture a blueprint and write it through all sinks
+	 * @param Blueprint - The blueprint to export
+	 * @param BasePath - Output path without extension
+	 * @return True if every required sink succeeded
+	 */
+	bool ExportBlueprint(UBlueprint* Blueprint, const FString& BasePath) const;
+
+	/**
+	 * Write an already captured snapshot through all sinks
+	 * @param OutBytes - If set, receives the total size of the sinks' files, as produced (no file is stat'ed)
+	 */
+	bool WriteSnapshot(const FBlueprintSnapshot& Snapshot, const FString& BasePath, int64* OutBytes = nullptr) const;
+
+	/** Every file the sinks produce for a given base path */
+	TArray<FString> GetOutputPaths(const FString& BasePath) const;
+
+	/** Files written by all sinks so far */
+	int32 GetWrittenFileCount() const;
+
+	/** Files all sinks left untouched because their content hadn't changed */
+	int32 GetUnchangedFileCount() const;
+
+	/**
+	 * Build the output path for an asset, mirroring the project folder structure
+	 * e.g., /Game/Characters/BP_Player -> OutputDirectory/Characters/BP_Player
+	 */
+	static FString MakeOutputBasePath(const FString& OutputDirectory, const FString& PackageName, const FString& AssetName);
+
+private:
+	struct FSinkEntry
+	{
+		TSharedRef<IBlueprintExportSink> Sink;
+		bool bRequired;
+	};
+
+	TArray<FSinkEntry> Sinks;
+};
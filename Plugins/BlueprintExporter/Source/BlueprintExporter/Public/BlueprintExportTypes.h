@@ -0,0 +1,129 @@
+// BlueprintExportTypes.h
+// Plain-data snapshot of a blueprint, captured once and shared by every export sink
+// Place this in: Plugins/BlueprintExporter/Source/BlueprintExporter/Public/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Version of the exported output
+ * Bump whenever the same blueprint would export to different bytes, so incremental exports redo everything
+ */
+static constexpr int32 BlueprintExporterFormatVersion = 5;
+
+/**
+ * A resolved pin-to-pin connection (knot nodes already collapsed)
+ */
+struct FBlueprintConnectionSnapshot
+{
+	FString Node;
+	FString Pin;
+};
+
+/**
+ * A single pin on a node
+ */
+struct FBlueprintPinSnapshot
+{
+	FString Name;
+	bool bIsInput = false;
+	FString Type;
+	FString DefaultValue;
+
+	// True if the pin had any links, even if they all resolved to dead-end knots
+	bool bHasLinks = false;
+	TArray<FBlueprintConnectionSnapshot> Connections;
+};
+
+/**
+ * A single graph node (knot nodes are never captured)
+ */
+struct FBlueprintNodeSnapshot
+{
+	FString Id;
+	FString Type;
+	FString Title;
+	TArray<FBlueprintPinSnapshot> Pins;
+
+	// What the node calls, reads, writes or spawns, as a symbol index key (not part of the JSON):
+	// "call:<Function>@<Class>", "get:<Variable>@<Class>", "set:<Variable>@<Class>" or "spawn:<Class>"
+	FString Symbol;
+
+	// Structural hash of the type, title and pins, not the id (see FBlueprintSnapshotHash)
+	uint64 Hash = 0;
+};
+
+/**
+ * A graph with its nodes in execution-flow order
+ */
+struct FBlueprintGraphSnapshot
+{
+	FString Name;
+	TArray<FBlueprintNodeSnapshot> Nodes;
+
+	// Rolled up from the name and each node's id and hash
+	uint64 Hash = 0;
+};
+
+struct FBlueprintVariableSnapshot
+{
+	FString Name;
+	FString Type;
+	FString Category;
+	bool bIsExposed = false;
+	FString DefaultValue;
+};
+
+struct FBlueprintParameterSnapshot
+{
+	FString Name;
+	FString Type;
+};
+
+/**
+ * A function and the graph that implements it
+ */
+struct FBlueprintFunctionSnapshot
+{
+	FString Name;
+	TArray<FBlueprintParameterSnapshot> Parameters;
+
+	// Index into FBlueprintSnapshot::Graphs, so each function graph is only walked once
+	int32 GraphIndex = INDEX_NONE;
+};
+
+struct FBlueprintComponentSnapshot
+{
+	FString Name;
+	FString Class;
+};
+
+/**
+ * Everything the exporter knows about one blueprint
+ * Holds no UObject pointers, so it can outlive the blueprint it was captured from
+ */
+struct FBlueprintSnapshot
+{
+	FString Name;
+	FString Path;
+	FString PackageName;
+
+	// Empty when the blueprint has no parent/generated class
+	FString ParentClass;
+	FString GeneratedClass;
+
+	TArray<FBlueprintGraphSnapshot> Graphs;
+	TArray<FBlueprintVariableSnapshot> Variables;
+	TArray<FBlueprintFunctionSnapshot> Functions;
+	TArray<FBlueprintComponentSnapshot> Components;
+	TArray<FString> Dependencies;
+
+	// Rolled up from the graph hashes and everything else exported; equal hashes mean equal exports
+	uint64 Hash = 0;
+
+	const FBlueprintGraphSnapshot* GetFunctionGraph(const FBlueprintFunctionSnapshot& Function) const
+	{
+		return Graphs.IsValidIndex(Function.GraphIndex) ? &Graphs[Function.GraphIndex] : nullptr;
+	}
+};
@@ -11,48 +11,218 @@
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 #include "EdGraph/EdGraphPin.h"
+#include "BlueprintExportTypes.h"
 #include "BlueprintExporter.generated.h"
 
+struct FAssetData;
+struct FBlueprintJsonOptions;
+class FBlueprintPinTypeNames;
+
+namespace BlueprintGraph
+{
+	struct FGraph;
+	struct FPinRef;
+	class FKnotMap;
+}
+
 // Custom log category for Blueprint Exporter
 DECLARE_LOG_CATEGORY_EXTERN(LogBlueprintExporter, Log, All);
 
+/** File format of the per-blueprint data file */
+UENUM(BlueprintType)
+enum class EBlueprintExportFormat : uint8
+{
+	/** <Name>.json, human readable */
+	Json UMETA(DisplayName = "JSON"),
+	/** <Name>.msgpack, the same schema as MessagePack; smaller and faster to parse */
+	MessagePack UMETA(DisplayName = "MessagePack")
+};
+
 /**
- * Project settings for Blueprint Exporter
+ * Configuration for blueprint export operations
  */
-UCLASS(Config=Editor, DefaultConfig, meta=(DisplayName="Blueprint Exporter"))
-class BLUEPRINTEXPORTER_API UBlueprintExporterSettings : public UDeveloperSettings
+USTRUCT(BlueprintType)
+struct BLUEPRINTEXPORTER_API FBlueprintExportConfig
 {
 	GENERATED_BODY()
 
-public:
-	UPROPERTY(Config, EditAnywhere, Category = "Export Settings", meta = (DisplayName = "Output Directory"))
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter")
 	FString OutputDirectory = TEXT("Exported/Blueprints");
 
-	UPROPERTY(Config, EditAnywhere, Category = "Export Settings", meta = (DisplayName = "Generate Markdown Files"))
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter")
 	bool bGenerateMarkdown = true;
 
-	UPROPERTY(Config, EditAnywhere, Category = "Export Settings", meta = (DisplayName = "Pretty Print JSON"))
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter")
 	bool bPrettyPrintJson = true;
 
-	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter")
+	EBlueprintExportFormat Format = EBlueprintExportFormat::Json;
+
+	/** Bulk exports write one NDJSON bundle with an offset index instead of files per blueprint */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter")
+	bool bBundleExport = false;
+
+	/** zlib-compress bundle records that get smaller for it */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter")
+	bool bCompressBundleRecords = false;
+
+	/** Write each function graph once, in "graphs", and reference it from the function by id (JSON schema 2) */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter")
+	bool bFunctionGraphsById = false;
+
+	/** Intern graph strings in a per-file table and refer to nodes and pins by index (JSON schema 3) */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter")
+	bool bCompactSchema = false;
+
+	/** Format and write files on task-graph workers while the game thread captures the next blueprint */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter|Performance")
+	bool bParallelExport = true;
+
+	/** Maximum captured blueprints waiting to be written (0 = twice the worker thread count) */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter|Performance")
+	int32 MaxInFlightExports = 0;
+
+	/** Skip blueprints unchanged since the last export (exports of deleted blueprints are removed either way) */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter|Performance")
+	bool bIncrementalExport = true;
+
+	/** Packages loaded asynchronously ahead of the one being exported (0 = load each one when needed) */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter|Performance")
+	int32 MaxPrefetchPackages = 8;
+
+	/** Estimated memory the prefetched packages may occupy; the window shrinks to stay under it */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter|Performance")
+	int32 PrefetchMemoryBudgetMB = 1024;
+
+	/** Unload exported packages and collect garbage when editor memory goes over this (0 = keep everything loaded) */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter|Performance")
+	int32 MemoryBudgetMB = 0;
+};
+
+/** Outcome of exporting one blueprint in a batch */
+UENUM(BlueprintType)
+enum class EBlueprintExportStatus : uint8
+{
+	Exported,
+	/** Skipped: unchanged since the last export */
+	Unchanged,
+	Failed
 };
 
 /**
- * Configuration for blueprint export operations
+ * Per-asset status and timing returned by the batch export functions
  */
 USTRUCT(BlueprintType)
-struct BLUEPRINTEXPORTER_API FBlueprintExportConfig
+struct BLUEPRINTEXPORTER_API FBlueprintExportResult
 {
 	GENERATED_BODY()
 
-	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter")
+	/** Object path of the blueprint, or the path as given if it could not be found */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	FString AssetPath;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	EBlueprintExportStatus Status = EBlueprintExportStatus::Failed;
+
+	/** Written data file, JSON or MessagePack (empty unless exported) */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	FString OutputPath;
+
+	/** Game thread time spent loading the package */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	float LoadMs = 0.0f;
+
+	/** Game thread time spent capturing the blueprint */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	float CaptureMs = 0.0f;
+
+	/** Time spent formatting and writing the files (on a worker in parallel mode) */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	float WriteMs = 0.0f;
+
+	/** Nodes captured across the blueprint's graphs (0 unless loaded and captured) */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	int32 NodeCount = 0;
+
+	/** Size of the exported files, or of the bundle record in bundle mode (0 unless exported) */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Exporter")
+	int64 OutputBytes = 0;
+};
+
+/**
+ * Project settings for Blueprint Exporter
+ */
+UCLASS(Config=Editor, DefaultConfig, meta=(DisplayName="Blueprint Exporter"))
+class BLUEPRINTEXPORTER_API UBlueprintExporterSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Config, EditAnywhere, Category = "Export Settings", meta = (DisplayName = "Output Directory"))
 	FString OutputDirectory = TEXT("Exported/Blueprints");
 
-	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter")
+	UPROPERTY(Config, EditAnywhere, Category = "Export Settings", meta = (DisplayName = "Generate Markdown Files"))
 	bool bGenerateMarkdown = true;
 
-	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Exporter")
+	UPROPERTY(Config, EditAnywhere, Category = "Export Settings", meta = (DisplayName = "Pretty Print JSON", EditCondition = "Format == EBlueprintExportFormat::Json"))
 	bool bPrettyPrintJson = true;
+
+	/** MessagePack is meant for tools; it carries the same schema as the JSON (see JSON-SCHEMA.md) */
+	UPROPERTY(Config, EditAnywhere, Category = "Export Settings", meta = (DisplayName = "Data Format"))
+	EBlueprintExportFormat Format = EBlueprintExportFormat::Json;
+
+	/**
+	 * Export all blueprints into a single blueprints.ndjson, one JSON record per line, with
+	 * blueprints.index.json giving each record's byte offset and length. No Markdown is written.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Export Settings", meta = (DisplayName = "Bundle Export"))
+	bool bBundleExport = false;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Export Settings", meta = (DisplayName = "Compress Bundle Records", EditCondition = "bBundleExport"))
+	bool bCompressBundleRecords = false;
+
+	/** Off keeps the original schema, where every function embeds a copy of its graph */
+	UPROPERTY(Config, EditAnywhere, Category = "Export Settings", meta = (DisplayName = "Reference Function Graphs By Id", EditCondition = "!bCompactSchema"))
+	bool bFunctionGraphsById = false;
+
+	/** Much smaller files for tools; convert back with Content/Python/blueprint_compact_schema.py */
+	UPROPERTY(Config, EditAnywhere, Category = "Export Settings", meta = (DisplayName = "Compact Schema"))
+	bool bCompactSchema = false;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (DisplayName = "Parallel Export"))
+	bool bParallelExport = true;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (DisplayName = "Max In-Flight Exports", ClampMin = "0", EditCondition = "bParallelExport"))
+	int32 MaxInFlightExports = 0;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (DisplayName = "Incremental Export"))
+	bool bIncrementalExport = true;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (DisplayName = "Max Prefetch Packages", ClampMin = "0"))
+	int32 MaxPrefetchPackages = 8;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (DisplayName = "Prefetch Memory Budget (MB)", ClampMin = "1"))
+	int32 PrefetchMemoryBudgetMB = 1024;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (DisplayName = "Memory Budget (MB)", ClampMin = "0"))
+	int32 MemoryBudgetMB = 0;
+
+	/** Start the auto-export service when the editor starts */
+	UPROPERTY(Config, EditAnywhere, Category = "Auto Export", meta = (DisplayName = "Auto Export On Save"))
+	bool bAutoExportOnSave = false;
+
+	/** Wait this long after the last save of a blueprint before exporting it */
+	UPROPERTY(Config, EditAnywhere, Category = "Auto Export", meta = (DisplayName = "Debounce (Seconds)", ClampMin = "0.0"))
+	float AutoExportDebounceSeconds = 2.0f;
+
+	/** Game-thread time the service may spend per editor tick */
+	UPROPERTY(Config, EditAnywhere, Category = "Auto Export", meta = (DisplayName = "Tick Budget (ms)", ClampMin = "0.1"))
+	float AutoExportTickBudgetMs = 5.0f;
+
+	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+
+	/** Export configuration matching these settings */
+	FBlueprintExportConfig ToExportConfig() const;
 };
 
 /**
@@ -95,6 +265,7 @@ public:
 
 	/**
 	 * Export all project blueprints to directory (JSON and Markdown)
+	 * Always a full export of a JSON file per blueprint; the project settings are not used.
 	 * @param OutputDirectory - Directory to export to
 	 * @param bPrettyPrint - Whether to format JSON with indentation (default: true)
 	 * @param bGenerateMarkdown - Whether to generate Markdown files alongside JSON (default: true)
@@ -103,43 +274,118 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
 	static int32 ExportAllBlueprints(const FString& OutputDirectory, bool bPrettyPrint = true, bool bGenerateMarkdown = true);
 
+	/**
+	 * Export all project blueprints as the project settings configure it (format, bundle, schema, incremental)
+	 * @param OutputDirectory - Directory to export to, relative to the project (empty: the project setting)
+	 * @return Number of blueprints whose exports are up to date (written, or skipped as unchanged)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
+	static int32 ExportAllBlueprintsWithSettings(const FString& OutputDirectory = TEXT(""));
+
 	/**
 	 * Export all project blueprints using configuration struct
 	 * @param Config - Export configuration
-	 * @return Number of blueprints exported
+	 * @return Number of blueprints whose exports are up to date (written, or skipped as unchanged)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
 	static int32 ExportAllBlueprintsWithConfig(const FBlueprintExportConfig& Config);
 
+	/**
+	 * Export all project blueprints to an absolute directory using configuration struct
+	 * (Config.OutputDirectory is ignored)
+	 */
+	static int32 ExportAllBlueprintsToDirectory(const FString& OutputDirectory, const FBlueprintExportConfig& Config);
+
+	/**
+	 * Export the given blueprints natively, without returning their JSON
+	 * @param AssetPaths - Object paths (/Game/Path/BP_Name.BP_Name) or package names (/Game/Path/BP_Name)
+	 * @param Config - Export configuration (OutputDirectory is relative to the project directory)
+	 * @return One result per asset path, in the same order
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
+	static TArray<FBlueprintExportResult> ExportBlueprintBatch(const TArray<FString>& AssetPaths, const FBlueprintExportConfig& Config);
+
+	/**
+	 * Export every blueprint under the given content paths natively
+	 * @param PackagePaths - Content paths to search (e.g. /Game/Characters)
+	 * @param bRecursive - Whether to include sub-folders
+	 * @param Config - Export configuration (OutputDirectory is relative to the project directory)
+	 * @return One result per blueprint found
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter")
+	static TArray<FBlueprintExportResult> ExportBlueprintsInPaths(const TArray<FString>& PackagePaths, bool bRecursive, const FBlueprintExportConfig& Config);
+
+	/**
+	 * Blueprints that depend on an asset or class, from the dependency index of the last export
+	 * @param Path - Asset or class path (e.g. /Game/BP_Weapon.BP_Weapon, /Game/BP_Weapon.BP_Weapon_C, /Script/Engine.Actor)
+	 * @param bTransitive - Also include blueprints that depend on it indirectly
+	 * @param OutputDirectory - Export directory, relative to the project (empty: the project setting)
+	 * @return Asset paths, sorted
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter|Dependencies")
+	static TArray<FString> FindDependents(const FString& Path, bool bTransitive = true, const FString& OutputDirectory = TEXT(""));
+
+	/**
+	 * What a blueprint depends on, from the dependency index of the last export
+	 * @param Path - Blueprint asset or generated class path
+	 * @param bTransitive - Also include the dependencies of blueprints it depends on
+	 * @param OutputDirectory - Export directory, relative to the project (empty: the project setting)
+	 * @return Asset and class paths, sorted
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter|Dependencies")
+	static TArray<FString> FindDependencies(const FString& Path, bool bTransitive = true, const FString& OutputDirectory = TEXT(""));
+
+	/**
+	 * Semantic diff of two exports: what was added, removed and changed in graphs, nodes, pins,
+	 * variables, functions and components, ignoring node order and nodes recreated unchanged
+	 * @param OldPath - Exported JSON file, or export directory with a project index; relative to the project
+	 * @param NewPath - The same for the newer export
+	 * @param bMarkdown - Return Markdown for review instead of JSON
+	 * @return The diff, or empty if either export couldn't be read
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter|Diff")
+	static FString DiffExports(const FString& OldPath, const FString& NewPath, bool bMarkdown = false);
+
+	/**
+	 * Semantic diff of a blueprint as it is now against an earlier export of it
+	 * @param Blueprint - The blueprint, captured as it is in the editor
+	 * @param ExportedFile - Its exported JSON file, relative to the project
+	 * @param bMarkdown - Return Markdown for review instead of JSON
+	 * @return The diff, or empty if the blueprint was invalid or the file couldn't be read
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Exporter|Diff")
+	static FString DiffBlueprintWithExport(UBlueprint* Blueprint, const FString& ExportedFile, bool bMarkdown = false);
+
+	/**
+	 * Capture everything the exporter needs from a blueprint in a single pass
+	 * @param Blueprint - The blueprint to capture
+	 * @param OutSnapshot - Receives the captured data
+	 * @return True if the blueprint was valid
+	 */
+	static bool CaptureBlueprint(UBlueprint* Blueprint, FBlueprintSnapshot& OutSnapshot);
+
+	/** Format a captured blueprint as a JSON string */
+	static bool SnapshotToJsonString(const FBlueprintSnapshot& Snapshot, bool bPrettyPrint, FString& OutJson);
+	static bool SnapshotToJsonString(const FBlueprintSnapshot& Snapshot, const FBlueprintJsonOptions& Options, FString& OutJson);
+
+	/** Format a captured blueprint as Markdown, the same document the Python exporter renders from its JSON */
+	static FString GenerateMarkdown(const FBlueprintSnapshot& Snapshot);
+
+	/** Capture a graph already read into the graph model: knots collapsed, nodes in execution order (also used by the benchmarks) */
+	static void CaptureGraph(const BlueprintGraph::FGraph& Graph, FBlueprintGraphSnapshot& OutGraph);
+
 private:
-	// Internal serialization and generation functions
-	static FString GenerateMarkdownFromJson(TSharedPtr<FJsonObject> JsonObject, UBlueprint* Blueprint);
-
-	// Internal serialization functions
-	static TSharedPtr<FJsonObject> SerializeBlueprint(UBlueprint* Blueprint);
-	static TSharedPtr<FJsonObject> SerializeGraph(UEdGraph* Graph);
-	static TSharedPtr<FJsonObject> SerializeNode(UEdGraphNode* Node);
-	static TSharedPtr<FJsonObject> SerializePin(UEdGraphPin* Pin);
-	static TArray<TSharedPtr<FJsonValue>> SerializeVariables(UBlueprint* Blueprint);
-	static TArray<TSharedPtr<FJsonValue>> SerializeFunctions(UBlueprint* Blueprint);
-	static TArray<TSharedPtr<FJsonValue>> SerializeComponents(UBlueprint* Blueprint);
-	static TArray<TSharedPtr<FJsonValue>> ExtractDependencies(UBlueprint* Blueprint);
+	// Internal capture functions (blueprint -> graph model -> snapshot)
+	static void CaptureNode(const BlueprintGraph::FGraph& Graph, int32 NodeIndex, const BlueprintGraph::FKnotMap& Knots, FBlueprintNodeSnapshot& OutNode);
+	static void CapturePin(const BlueprintGraph::FGraph& Graph, BlueprintGraph::FPinRef PinRef, const BlueprintGraph::FKnotMap& Knots, FBlueprintPinSnapshot& OutPin);
+	static void CaptureVariables(UBlueprint* Blueprint, FBlueprintPinTypeNames& TypeNames, TArray<FBlueprintVariableSnapshot>& OutVariables);
+	static void CaptureFunctions(UBlueprint* Blueprint, const TMap<UEdGraph*, int32>& GraphIndices, FBlueprintPinTypeNames& TypeNames, TArray<FBlueprintFunctionSnapshot>& OutFunctions);
+	static void CaptureComponents(UBlueprint* Blueprint, TArray<FBlueprintComponentSnapshot>& OutComponents);
+
+	/** Export a subset of the project's blueprints to Config.OutputDirectory */
+	static TArray<FBlueprintExportResult> ExportAssetBatch(const TArray<FAssetData>& Assets, const FBlueprintExportConfig& Config);
 
 	// Helper functions
-	static FString PinTypeToString(const FEdGraphPinType& PinType);
-	static FString NodeTypeToString(UEdGraphNode* Node);
 	static FString GetNodeCategory(UEdGraphNode* Node);
 	static TArray<UEdGraphNode*> GetConnectedNodes(UEdGraphNode* Node);
-
-	// Knot node resolution
-	static TArray<UEdGraphPin*> ResolveKnotChainMulti(UEdGraphPin* Pin);
-
-	// Execution-flow ordering helpers
-	static bool IsEntryPointNode(UEdGraphNode* Node);
-	static TArray<UEdGraphPin*> GetSortedExecOutputPins(UEdGraphNode* Node);
-	static void ExportNodeRecursive(
-		UEdGraphNode* Node,
-		TSet<UEdGraphNode*>& UnexportedNodes,
-		TArray<TSharedPtr<FJsonValue>>& OrderedNodesArray
-	);
 };
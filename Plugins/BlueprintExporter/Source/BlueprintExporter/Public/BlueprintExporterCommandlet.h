@@ -0,0 +1,52 @@
+// BlueprintExporterCommandlet.h
+// Headless project-wide export for build machines
+// Place this in: Plugins/BlueprintExporter/Source/BlueprintExporter/Public/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BlueprintExporterCommandlet.generated.h"
+
+/**
+ * Runs the same export as ExportAllBlueprintsWithSettings without the editor UI
+ *
+ * UnrealEditor-Cmd <Project>.uproject -run=BlueprintExporter [options]
+ *
+ *   -Output=<Dir>          Output directory, absolute or relative to the project (default: project setting)
+ *   -Shard=<i>/<N>         Only export blueprints whose package name hashes to shard i of N (0-based)
+ *   -Filter=<Path>[,...]   Only export packages under these paths, e.g. /Game/Characters
+ *   -Exclude=<Path>[,...]  Skip packages under these paths
+ *   -Summary=<File>        Where to write the JSON summary (default: export_summary.json in the output directory)
+ *   -Full                  Ignore the manifest and export everything
+ *   -Markdown / -NoMarkdown, -Pretty / -Compact   Override the project settings
+ *   -Format=Json|MessagePack  Data file format (default: project setting)
+ *   -CompactSchema         Write the interned compact schema (schema 3)
+ *   -Bundle                Write one blueprints.ndjson bundle plus offset index instead of a file per blueprint
+ *   -CompressBundle        Bundle with zlib-compressed records (implies -Bundle)
+ *   -MemoryBudgetMB=<MB>   Unload exported packages when memory goes over this
+ *   -DiffAgainst=<Dir>     After exporting, compare the export with an earlier one in Dir and write
+ *                          export_diff.json and export_diff.md to the output directory (JSON exports only, not sharded)
+ *
+ * Shards are stable across machines (CRC of the package name), so N processes
+ * given the same project and N each export a disjoint part of it. Each shard keeps
+ * its own manifest (and bundle), so shards can share one output directory.
+ *
+ * Returns 0 when every blueprint exported, 1 if any failed, 2 for bad arguments.
+ */
+UCLASS()
+class BLUEPRINTEXPORTER_API UBlueprintExporterCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBlueprintExporterCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	/** Parse "i/N"; false unless 0 <= i < N */
+	static bool ParseShard(const FString& ShardString, int32& OutIndex, int32& OutCount);
+
+	/** Stable shard of a package (same on every machine and run) */
+	static int32 GetShardIndex(FName PackageName, int32 ShardCount);
+};
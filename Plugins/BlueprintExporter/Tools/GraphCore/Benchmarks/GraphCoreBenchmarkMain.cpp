@@ -0,0 +1,285 @@
+// GraphCoreBenchmarkMain.cpp
+// Benchmarks the engine-independent export stages on synthetic graphs
+//
+//   BlueprintGraphCoreBenchmarks [--scenario <Name>] [--iterations <N>]
+//       [--baseline <File>] [--write-baseline <File>] [--fail-on-time]
+//
+// Stages: Knots (FKnotMap), Order (FNodeOrdering, the execution-flow walk), Dependencies,
+// Symbols (node types and symbol keys) and Diff (MatchNodes against an edited copy).
+// Capture, JSON and Markdown need the engine; the BlueprintExporter.Performance.Benchmarks
+// automation test measures them, and the whole snapshot diff, in the editor.
+//
+// With --baseline, allocation and output size regressions fail the run (exit code 1);
+// timing regressions only warn unless --fail-on-time is given, timings being machine-bound.
+
+#include "BlueprintGraphBenchmark.h"
+#include "BlueprintGraphDependencies.h"
+#include "BlueprintGraphDiff.h"
+#include "BlueprintGraphFormat.h"
+#include "BlueprintGraphHash.h"
+#include "BlueprintGraphKnots.h"
+#include "BlueprintGraphOrdering.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+// ============================================================================
+// Allocation counting
+// ============================================================================
+
+static std::atomic<uint64_t> GAllocations{ 0 };
+
+void* operator new(std::size_t Size)
+{
+	GAllocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* Memory = std::malloc(Size ? Size : 1))
+	{
+		return Memory;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t Size)
+{
+	return operator new(Size);
+}
+
+void operator delete(void* Memory) noexcept
+{
+	std::free(Memory);
+}
+
+void operator delete[](void* Memory) noexcept
+{
+	std::free(Memory);
+}
+
+void operator delete(void* Memory, std::size_t) noexcept
+{
+	std::free(Memory);
+}
+
+void operator delete[](void* Memory, std::size_t) noexcept
+{
+	std::free(Memory);
+}
+
+static uint64_t CountAllocations()
+{
+	return GAllocations.load(std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Stages
+// ============================================================================
+
+static void RunScenario(const BlueprintGraph::FBenchmarkScenario& Scenario, int32_t Iterations, std::vector<BlueprintGraph::FBenchmarkResult>& OutResults)
+{
+	using namespace BlueprintGraph;
+
+	const std::vector<FGraph> Graphs = GenerateGraphs(Scenario.Settings);
+	const int64_t Nodes = CountNodes(Graphs);
+
+	OutResults.push_back(MeasureStage(Scenario.Name, "Knots", Nodes, Iterations, &CountAllocations, [&Graphs]()
+	{
+		for (const FGraph& Graph : Graphs)
+		{
+			const FKnotMap Knots(Graph);
+		}
+		return int64_t(-1);
+	}));
+
+	// Ordering only; the knot maps are built beforehand
+	std::vector<FKnotMap> KnotMaps(Graphs.begin(), Graphs.end());
+	OutResults.push_back(MeasureStage(Scenario.Name, "Order", Nodes, Iterations, &CountAllocations, [&Graphs, &KnotMaps]()
+	{
+		for (size_t GraphIndex = 0; GraphIndex < Graphs.size(); ++GraphIndex)
+		{
+			const FNodeOrdering Ordering(Graphs[GraphIndex], KnotMaps[GraphIndex]);
+		}
+		return int64_t(-1);
+	}));
+
+	OutResults.push_back(MeasureStage(Scenario.Name, "Dependencies", Nodes, Iterations, &CountAllocations, [&Graphs]()
+	{
+		std::vector<std::string> Dependencies;
+		for (const FGraph& Graph : Graphs)
+		{
+			CollectDependencies(Graph, Dependencies);
+		}
+		SortAndDeduplicate(Dependencies);
+		return int64_t(-1);
+	}));
+
+	OutResults.push_back(MeasureStage(Scenario.Name, "Symbols", Nodes, Iterations, &CountAllocations, [&Graphs]()
+	{
+		int64_t Bytes = 0;
+		for (const FGraph& Graph : Graphs)
+		{
+			for (const FNode& Node : Graph.Nodes)
+			{
+				if (!Node.bIsKnot)
+				{
+					Bytes += static_cast<int64_t>(GetNodeTypeName(Node).size() + GetNodeSymbol(Node).size());
+				}
+			}
+		}
+		return Bytes;
+	}));
+
+	// Keys of the exported nodes, and of a version with every 16th node edited and every 64th recreated
+	// A deque, so the keys' views of the new ids stay valid as it grows
+	std::deque<std::string> RecreatedIds;
+	std::vector<std::vector<FDiffNodeKey>> OldKeys(Graphs.size());
+	std::vector<std::vector<FDiffNodeKey>> NewKeys(Graphs.size());
+	for (size_t GraphIndex = 0; GraphIndex < Graphs.size(); ++GraphIndex)
+	{
+		for (const FNode& Node : Graphs[GraphIndex].Nodes)
+		{
+			if (!Node.bIsKnot)
+			{
+				FStructuralHash Shape;
+				Shape.AddString(GetNodeTypeName(Node));
+				Shape.AddString(Node.Title);
+				FStructuralHash Hash;
+				Hash.AddHash(Shape.Finish());
+				for (const FPin& Pin : Node.Pins)
+				{
+					Hash.AddString(Pin.Name);
+					Hash.AddInteger(static_cast<int64_t>(Pin.Links.size()));
+				}
+				OldKeys[GraphIndex].push_back({ Node.Name, Hash.Finish(), Shape.Finish() });
+			}
+		}
+		NewKeys[GraphIndex] = OldKeys[GraphIndex];
+		for (size_t NodeIndex = 0; NodeIndex < NewKeys[GraphIndex].size(); NodeIndex += 16)
+		{
+			FDiffNodeKey& Key = NewKeys[GraphIndex][NodeIndex];
+			Key.Hash ^= 1;
+			if (NodeIndex % 64 == 0)
+			{
+				RecreatedIds.push_back(std::string(Key.Id) + "_Recreated");
+				Key.Id = RecreatedIds.back();
+			}
+		}
+	}
+	OutResults.push_back(MeasureStage(Scenario.Name, "Diff", Nodes, Iterations, &CountAllocations, [&OldKeys, &NewKeys]()
+	{
+		for (size_t GraphIndex = 0; GraphIndex < OldKeys.size(); ++GraphIndex)
+		{
+			const FNodeMatching Matching = MatchNodes(OldKeys[GraphIndex], NewKeys[GraphIndex]);
+		}
+		return int64_t(-1);
+	}));
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+static bool ReadFile(const char* Path, std::string& OutText)
+{
+	std::ifstream File(Path, std::ios::binary);
+	if (!File)
+	{
+		return false;
+	}
+	std::ostringstream Text;
+	Text << File.rdbuf();
+	OutText = Text.str();
+	return true;
+}
+
+int main(int ArgCount, char** Args)
+{
+	const char* ScenarioFilter = nullptr;
+	const char* BaselinePath = nullptr;
+	const char* WriteBaselinePath = nullptr;
+	int32_t Iterations = 5;
+	bool bFailOnTime = false;
+
+	for (int Index = 1; Index < ArgCount; ++Index)
+	{
+		const bool bHasValue = Index + 1 < ArgCount;
+		if (!std::strcmp(Args[Index], "--scenario") && bHasValue)
+		{
+			ScenarioFilter = Args[++Index];
+		}
+		else if (!std::strcmp(Args[Index], "--iterations") && bHasValue)
+		{
+			Iterations = std::atoi(Args[++Index]);
+		}
+		else if (!std::strcmp(Args[Index], "--baseline") && bHasValue)
+		{
+			BaselinePath = Args[++Index];
+		}
+		else if (!std::strcmp(Args[Index], "--write-baseline") && bHasValue)
+		{
+			WriteBaselinePath = Args[++Index];
+		}
+		else if (!std::strcmp(Args[Index], "--fail-on-time"))
+		{
+			bFailOnTime = true;
+		}
+		else
+		{
+			std::cerr << "Usage: " << Args[0] << " [--scenario <Name>] [--iterations <N>] [--baseline <File>] [--write-baseline <File>] [--fail-on-time]\n";
+			return 2;
+		}
+	}
+
+	std::vector<BlueprintGraph::FBenchmarkResult> Results;
+	for (const BlueprintGraph::FBenchmarkScenario& Scenario : BlueprintGraph::GetBenchmarkScenarios())
+	{
+		if (!ScenarioFilter || Scenario.Name == ScenarioFilter)
+		{
+			RunScenario(Scenario, Iterations, Results);
+		}
+	}
+
+	if (Results.empty())
+	{
+		std::cerr << "No scenario named " << ScenarioFilter << "\n";
+		return 2;
+	}
+
+	std::cout << BlueprintGraph::FormatResults(Results);
+
+	if (WriteBaselinePath)
+	{
+		std::ofstream File(WriteBaselinePath, std::ios::binary);
+		File << BlueprintGraph::WriteBaseline(Results);
+		if (!File)
+		{
+			std::cerr << "Failed to write " << WriteBaselinePath << "\n";
+			return 2;
+		}
+		std::cout << "Baseline written to " << WriteBaselinePath << "\n";
+	}
+
+	bool bFailed = false;
+	if (BaselinePath)
+	{
+		std::string Text;
+		if (!ReadFile(BaselinePath, Text))
+		{
+			std::cerr << "Failed to read " << BaselinePath << "\n";
+			return 2;
+		}
+
+		for (const BlueprintGraph::FBenchmarkRegression& Regression : BlueprintGraph::FindRegressions(BlueprintGraph::ParseBaseline(Text), Results))
+		{
+			const bool bFails = !Regression.bIsTiming || bFailOnTime;
+			std::cout << (bFails ? "REGRESSION " : "WARNING ") << BlueprintGraph::FormatRegression(Regression) << "\n";
+			bFailed |= bFails;
+		}
+	}
+
+	return bFailed ? 1 : 0;
+}
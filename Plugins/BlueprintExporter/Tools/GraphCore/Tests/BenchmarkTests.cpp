@@ -0,0 +1,117 @@
+// BenchmarkTests.cpp
+
+#include "BlueprintGraphBenchmark.h"
+#include "GraphCoreTest.h"
+
+using namespace BlueprintGraph;
+
+static FBenchmarkResult MakeResult(const char* Scenario, const char* Stage, double NsPerNode, double AllocationsPerNode, double BytesPerNode)
+{
+	FBenchmarkResult Result;
+	Result.Scenario = Scenario;
+	Result.Stage = Stage;
+	Result.NsPerNode = NsPerNode;
+	Result.AllocationsPerNode = AllocationsPerNode;
+	Result.BytesPerNode = BytesPerNode;
+	return Result;
+}
+
+static uint64_t GTestAllocations = 0;
+
+static uint64_t CountTestAllocations()
+{
+	return GTestAllocations;
+}
+
+GRAPH_TEST(Benchmark_MeasureStage)
+{
+	GTestAllocations = 0;
+	int32_t Runs = 0;
+	const FBenchmarkResult Result = MeasureStage("Scenario", "Stage", 10, 3, &CountTestAllocations, [&Runs]()
+	{
+		// The first run allocates more, like a cache warming up
+		GTestAllocations += Runs++ == 0 ? 50 : 20;
+		return int64_t(400);
+	});
+
+	CHECK_EQUAL(Runs, 3);
+	CHECK_EQUAL(Result.Nodes, int64_t(10));
+	CHECK_EQUAL(Result.AllocationsPerNode, 2.0);
+	CHECK_EQUAL(Result.BytesPerNode, 40.0);
+	CHECK(Result.NsPerNode >= 0.0);
+
+	const FBenchmarkResult Unmeasured = MeasureStage("Scenario", "Stage", 10, 1, nullptr, []() { return int64_t(-1); });
+	CHECK(Unmeasured.AllocationsPerNode < 0.0);
+	CHECK(Unmeasured.BytesPerNode < 0.0);
+}
+
+GRAPH_TEST(Benchmark_BaselineRoundTrip)
+{
+	const std::vector<FBenchmarkResult> Results = {
+		MakeResult("Small", "Knots", 12.5, 0.25, -1.0),
+		MakeResult("Large", "Json", 850.0, -1.0, 412.75),
+	};
+	const std::vector<FBenchmarkResult> Parsed = ParseBaseline(WriteBaseline(Results));
+
+	CHECK_EQUAL(Parsed.size(), size_t(2));
+	CHECK_EQUAL(Parsed[0].Scenario, std::string("Small"));
+	CHECK_EQUAL(Parsed[0].Stage, std::string("Knots"));
+	CHECK_EQUAL(Parsed[0].NsPerNode, 12.5);
+	CHECK_EQUAL(Parsed[0].AllocationsPerNode, 0.25);
+	CHECK(Parsed[0].BytesPerNode < 0.0);
+	CHECK(Parsed[1].AllocationsPerNode < 0.0);
+	CHECK_EQUAL(Parsed[1].BytesPerNode, 412.75);
+}
+
+GRAPH_TEST(Benchmark_ParseBaselineSkipsBadLines)
+{
+	const std::vector<FBenchmarkResult> Parsed = ParseBaseline(
+		"# comment\n"
+		"\n"
+		"Small Knots 1 2\n"
+		"Small Knots 1 2 3 4\n"
+		"Small Knots x 2 3\n"
+		"Small Order 1 - 3\n");
+
+	CHECK_EQUAL(Parsed.size(), size_t(1));
+	CHECK_EQUAL(Parsed[0].Stage, std::string("Order"));
+}
+
+GRAPH_TEST(Benchmark_FindRegressions)
+{
+	const std::vector<FBenchmarkResult> Baseline = {
+		MakeResult("Small", "Knots", 10.0, 1.0, -1.0),
+		MakeResult("Small", "Json", 100.0, 5.0, 200.0),
+	};
+	const std::vector<FBenchmarkResult> Results = {
+		// Slower, but within the timing tolerance; fewer allocations
+		MakeResult("Small", "Knots", 14.0, 0.5, -1.0),
+		MakeResult("Small", "Json", 200.0, 6.0, 201.0),
+		// Not in the baseline
+		MakeResult("Large", "Json", 1000.0, 100.0, 1000.0),
+	};
+
+	const std::vector<FBenchmarkRegression> Regressions = FindRegressions(Baseline, Results);
+	CHECK_EQUAL(Regressions.size(), size_t(2));
+	if (Regressions.size() == 2)
+	{
+		CHECK_EQUAL(Regressions[0].Metric, std::string("ns/node"));
+		CHECK(Regressions[0].bIsTiming);
+		CHECK_EQUAL(Regressions[1].Metric, std::string("allocations/node"));
+		CHECK(!Regressions[1].bIsTiming);
+		CHECK_EQUAL(FormatRegression(Regressions[0]), std::string("Small/Json: ns/node 100 -> 200 (+100%)"));
+	}
+}
+
+GRAPH_TEST(Benchmark_ScenariosAreUnique)
+{
+	const std::vector<FBenchmarkScenario>& Scenarios = GetBenchmarkScenarios();
+	CHECK(!Scenarios.empty());
+	for (size_t A = 0; A < Scenarios.size(); ++A)
+	{
+		for (size_t B = A + 1; B < Scenarios.size(); ++B)
+		{
+			CHECK(Scenarios[A].Name != Scenarios[B].Name);
+		}
+	}
+}
@@ -0,0 +1,114 @@
+// DependencyTests.cpp
+
+#include "BlueprintGraphDependencies.h"
+#include "GraphCoreTest.h"
+#include "TestGraphs.h"
+
+using namespace BlueprintGraph;
+using namespace GraphCoreTest;
+
+using FNames = std::vector<std::string>;
+
+GRAPH_TEST(Dependencies_CallsAndDefaultObjects)
+{
+	FGraph Graph;
+	const int32_t Call = Graph.AddNode("CallFunction_0", ENodeKind::CallFunction);
+	Graph.Nodes[Call].FunctionClass = "/Script/Engine.KismetSystemLibrary";
+	const FPinRef Target = Graph.AddPin(Call, "Target", true);
+	Graph.Nodes[Target.Node].Pins[Target.Pin].DefaultObject = "/Game/Data/DA_Weapon.DA_Weapon";
+
+	// Only call nodes contribute their function class
+	const int32_t Get = Graph.AddNode("VariableGet_0", ENodeKind::VariableGet);
+	Graph.Nodes[Get].FunctionClass = "/Script/Ignored.Class";
+
+	const int32_t SelfCall = Graph.AddNode("CallFunction_1", ENodeKind::CallFunction);
+	(void)SelfCall;
+
+	std::vector<std::string> Dependencies;
+	CollectDependencies(Graph, Dependencies);
+	CHECK_EQUAL(Dependencies, (FNames{ "/Script/Engine.KismetSystemLibrary", "/Game/Data/DA_Weapon.DA_Weapon" }));
+}
+
+GRAPH_TEST(Dependencies_SortAndDeduplicate)
+{
+	FNames Paths{ "/Script/Engine.Actor", "/Game/b", "/Game/A", "/Script/Engine.Actor", "/Game/a", "/Game/b" };
+	SortAndDeduplicate(Paths);
+	CHECK_EQUAL(Paths, (FNames{ "/Game/A", "/Game/b", "/Script/Engine.Actor" }));
+}
+
+GRAPH_TEST(Dependencies_CaseOnlyDuplicates)
+{
+	// Object paths ignore case: one dependency, whichever spelling the nodes used
+	FNames Paths{ "/Game/foo.Foo", "/Game/Foo.Foo", "/Script/Engine.Actor", "/Script/engine.actor" };
+	SortAndDeduplicate(Paths);
+	CHECK_EQUAL(Paths, (FNames{ "/Game/Foo.Foo", "/Script/Engine.Actor" }));
+
+	// Also across blueprints in the project graph, and in lookups
+	std::vector<FDependencyEntry> Entries(3);
+	Entries[0] = { "/Game/BP_A.BP_A", "/Game/BP_A.BP_A_C", { "/Game/Foo.Foo" } };
+	Entries[1] = { "/Game/BP_B.BP_B", "/Game/BP_B.BP_B_C", { "/Game/foo.Foo", "/Game/bp_a.BP_A_C" } };
+	Entries[2] = { "/Game/Foo.Foo", "", {} };
+	const FDependencyGraph Graph = FDependencyGraph::Build(Entries);
+	CHECK_EQUAL(Graph.Nodes, (FNames{ "/Game/BP_A.BP_A", "/Game/BP_B.BP_B", "/Game/Foo.Foo" }));
+	CHECK_EQUAL(Graph.FindNode("/game/FOO.foo"), Graph.FindNode("/Game/Foo.Foo"));
+	CHECK(Graph.Walk("/Game/Foo.Foo", true, false) == (FNames{ "/Game/BP_A.BP_A", "/Game/BP_B.BP_B" }));
+	CHECK(Graph.Forward[Graph.FindNode("/Game/BP_B.BP_B")] == (std::vector<int32_t>{ Graph.FindNode("/Game/BP_A.BP_A"), Graph.FindNode("/Game/Foo.Foo") }));
+}
+
+static FDependencyGraph MakeProjectGraph()
+{
+	// BP_Player -> BP_Weapon (through its class) -> BP_Projectile -> Actor
+	// BP_Enemy -> BP_Weapon, and a self dependency
+	std::vector<FDependencyEntry> Entries(4);
+	Entries[0] = { "/Game/BP_Player.BP_Player", "/Game/BP_Player.BP_Player_C", { "/Game/BP_Weapon.BP_Weapon_C", "/Script/Engine.Character" } };
+	Entries[1] = { "/Game/BP_Weapon.BP_Weapon", "/Game/BP_Weapon.BP_Weapon_C", { "/Game/BP_Projectile.BP_Projectile_C" } };
+	Entries[2] = { "/Game/BP_Projectile.BP_Projectile", "/Game/BP_Projectile.BP_Projectile_C", { "/Script/Engine.Actor" } };
+	Entries[3] = { "/Game/BP_Enemy.BP_Enemy", "/Game/BP_Enemy.BP_Enemy_C", { "/Game/BP_Weapon.BP_Weapon_C", "/Game/BP_Enemy.BP_Enemy_C" } };
+	return FDependencyGraph::Build(Entries);
+}
+
+GRAPH_TEST(DependencyGraph_NodesSortedAndClassesResolved)
+{
+	const FDependencyGraph Graph = MakeProjectGraph();
+	CHECK_EQUAL(Graph.Nodes, (FNames{
+		"/Game/BP_Enemy.BP_Enemy",
+		"/Game/BP_Player.BP_Player",
+		"/Game/BP_Projectile.BP_Projectile",
+		"/Game/BP_Weapon.BP_Weapon",
+		"/Script/Engine.Actor",
+		"/Script/Engine.Character" }));
+
+	CHECK_EQUAL(Graph.FindNode("/Game/BP_Weapon.BP_Weapon_C"), Graph.FindNode("/Game/BP_Weapon.BP_Weapon"));
+	CHECK_EQUAL(Graph.FindNode("/Game/Missing"), -1);
+
+	// The self dependency is dropped
+	CHECK(Graph.Forward[Graph.FindNode("/Game/BP_Enemy.BP_Enemy")] == (std::vector<int32_t>{ Graph.FindNode("/Game/BP_Weapon.BP_Weapon") }));
+}
+
+GRAPH_TEST(DependencyGraph_Walk)
+{
+	const FDependencyGraph Graph = MakeProjectGraph();
+
+	CHECK_EQUAL(Graph.Walk("/Game/BP_Player.BP_Player", false, false),
+		(FNames{ "/Game/BP_Weapon.BP_Weapon", "/Script/Engine.Character" }));
+	CHECK_EQUAL(Graph.Walk("/Game/BP_Player.BP_Player_C", false, true),
+		(FNames{ "/Game/BP_Projectile.BP_Projectile", "/Game/BP_Weapon.BP_Weapon", "/Script/Engine.Actor", "/Script/Engine.Character" }));
+
+	CHECK_EQUAL(Graph.Walk("/Game/BP_Weapon.BP_Weapon", true, false),
+		(FNames{ "/Game/BP_Enemy.BP_Enemy", "/Game/BP_Player.BP_Player" }));
+	CHECK_EQUAL(Graph.Walk("/Script/Engine.Actor", true, true),
+		(FNames{ "/Game/BP_Enemy.BP_Enemy", "/Game/BP_Player.BP_Player", "/Game/BP_Projectile.BP_Projectile", "/Game/BP_Weapon.BP_Weapon" }));
+
+	CHECK(Graph.Walk("/Game/Missing", true, true).empty());
+}
+
+GRAPH_TEST(DependencyGraph_CycleReportsStart)
+{
+	std::vector<FDependencyEntry> Entries(2);
+	Entries[0] = { "/Game/A.A", "/Game/A.A_C", { "/Game/B.B_C" } };
+	Entries[1] = { "/Game/B.B", "/Game/B.B_C", { "/Game/A.A_C" } };
+	const FDependencyGraph Graph = FDependencyGraph::Build(Entries);
+
+	CHECK_EQUAL(Graph.Walk("/Game/A.A", false, false), (FNames{ "/Game/B.B" }));
+	CHECK_EQUAL(Graph.Walk("/Game/A.A", false, true), (FNames{ "/Game/A.A", "/Game/B.B" }));
+}
@@ -0,0 +1,90 @@
+// DiffTests.cpp
+
+#include "BlueprintGraphDiff.h"
+#include "GraphCoreTest.h"
+
+using namespace BlueprintGraph;
+
+using FIndices = std::vector<int32_t>;
+
+GRAPH_TEST(Diff_SameIdsInAnotherOrder)
+{
+	// Edited nodes keep their id, whatever their hash; reordering pairs nothing differently
+	const std::vector<FDiffNodeKey> Old{ { "A", 1, 10 }, { "B", 2, 20 }, { "C", 3, 30 } };
+	const std::vector<FDiffNodeKey> New{ { "C", 3, 30 }, { "A", 9, 10 }, { "B", 2, 20 } };
+
+	const FNodeMatching Matching = MatchNodes(Old, New);
+	CHECK_EQUAL(Matching.NewForOld, (FIndices{ 1, 2, 0 }));
+	CHECK_EQUAL(Matching.OldForNew, (FIndices{ 2, 0, 1 }));
+}
+
+GRAPH_TEST(Diff_RecreatedNodes)
+{
+	const std::vector<FDiffNodeKey> Old{
+		{ "Call_1", 1, 10 },   // recreated as Call_7, unchanged
+		{ "Call_2", 2, 10 },   // recreated as Call_8 with other pin values
+		{ "Get_1", 3, 30 },    // removed
+	};
+	const std::vector<FDiffNodeKey> New{
+		{ "Call_8", 5, 10 },
+		{ "Call_7", 1, 10 },
+		{ "Set_1", 6, 40 },    // added
+	};
+
+	// The hash pass claims Call_1 before the shape pass could pair it with Call_8
+	const FNodeMatching Matching = MatchNodes(Old, New);
+	CHECK_EQUAL(Matching.NewForOld, (FIndices{ 1, 0, -1 }));
+	CHECK_EQUAL(Matching.OldForNew, (FIndices{ 1, 0, -1 }));
+}
+
+GRAPH_TEST(Diff_RecreatedUnchangedIsNoChange)
+{
+	// How DiffSnapshots treats a graph's pairs: only those that aren't unchanged are compared
+	const std::vector<FDiffNodeKey> Old{ { "Call_1", 1, 10 }, { "Call_2", 2, 10 }, { "Get_1", 3, 30 }, { "Old_1", 0, 50 } };
+	const std::vector<FDiffNodeKey> New{ { "Call_7", 1, 10 }, { "Call_8", 5, 10 }, { "Get_1", 3, 30 }, { "Old_1", 0, 50 } };
+
+	const FNodeMatching Matching = MatchNodes(Old, New);
+	CHECK_EQUAL(Matching.OldForNew, (FIndices{ 0, 1, 2, 3 }));
+
+	std::vector<bool> Unchanged;
+	for (size_t NewIndex = 0; NewIndex < New.size(); ++NewIndex)
+	{
+		Unchanged.push_back(IsUnchanged(Old[Matching.OldForNew[NewIndex]], New[NewIndex]));
+	}
+	// Recreated unchanged, recreated and edited, kept, and an export without hashes
+	CHECK(Unchanged == (std::vector<bool>{ true, false, true, false }));
+}
+
+GRAPH_TEST(Diff_IdsBeforeHashes)
+{
+	// B kept its id but now has A's old content; A was recreated as C
+	const std::vector<FDiffNodeKey> Old{ { "A", 1, 10 }, { "B", 2, 10 } };
+	const std::vector<FDiffNodeKey> New{ { "B", 1, 10 }, { "C", 2, 10 } };
+
+	const FNodeMatching Matching = MatchNodes(Old, New);
+	CHECK_EQUAL(Matching.NewForOld, (FIndices{ 1, 0 }));
+}
+
+GRAPH_TEST(Diff_RepeatedKeysPairInOrder)
+{
+	const std::vector<FDiffNodeKey> Old{ { "P1", 7, 1 }, { "X", 8, 2 }, { "P2", 7, 1 }, { "P3", 7, 1 } };
+	const std::vector<FDiffNodeKey> New{ { "Q1", 7, 1 }, { "Q2", 7, 1 }, { "X", 8, 2 } };
+
+	const FNodeMatching Matching = MatchNodes(Old, New);
+	CHECK_EQUAL(Matching.NewForOld, (FIndices{ 0, 2, 1, -1 }));
+	CHECK_EQUAL(Matching.OldForNew, (FIndices{ 0, 2, 1 }));
+}
+
+GRAPH_TEST(Diff_DuplicateAndMissingIds)
+{
+	// A repeated id goes to its first node; the second can still pair by hash
+	const std::vector<FDiffNodeKey> Old{ { "A", 1, 10 }, { "A", 2, 20 } };
+	const std::vector<FDiffNodeKey> New{ { "A", 2, 20 }, { "B", 2, 20 } };
+
+	const FNodeMatching Matching = MatchNodes(Old, New);
+	CHECK_EQUAL(Matching.NewForOld, (FIndices{ 0, 1 }));
+
+	CHECK(MatchNodes({}, {}).NewForOld.empty());
+	CHECK_EQUAL(MatchNodes(Old, {}).NewForOld, (FIndices{ -1, -1 }));
+	CHECK_EQUAL(MatchNodes({}, New).OldForNew, (FIndices{ -1, -1 }));
+}
@@ -0,0 +1,55 @@
+// FormatTests.cpp
+
+#include "BlueprintGraphFormat.h"
+#include "GraphCoreTest.h"
+
+using namespace BlueprintGraph;
+
+static FNode MakeNode(ENodeKind Kind, const std::string& MemberName = "", const std::string& MemberClass = "")
+{
+	FNode Node;
+	Node.Kind = Kind;
+	Node.ClassName = "K2Node_Test";
+	Node.MemberName = MemberName;
+	Node.MemberClass = MemberClass;
+	return Node;
+}
+
+GRAPH_TEST(Format_NodeTypeNames)
+{
+	CHECK_EQUAL(GetNodeTypeName(MakeNode(ENodeKind::Event)), std::string("Event"));
+	CHECK_EQUAL(GetNodeTypeName(MakeNode(ENodeKind::FunctionEntry)), std::string("FunctionEntry"));
+	CHECK_EQUAL(GetNodeTypeName(MakeNode(ENodeKind::CallFunction)), std::string("CallFunction"));
+	CHECK_EQUAL(GetNodeTypeName(MakeNode(ENodeKind::VariableGet)), std::string("VariableGet"));
+	CHECK_EQUAL(GetNodeTypeName(MakeNode(ENodeKind::VariableSet)), std::string("VariableSet"));
+	CHECK_EQUAL(GetNodeTypeName(MakeNode(ENodeKind::Construct)), std::string("K2Node_Test"));
+	CHECK_EQUAL(GetNodeTypeName(MakeNode(ENodeKind::Other)), std::string("K2Node_Test"));
+}
+
+GRAPH_TEST(Format_NodeSymbols)
+{
+	CHECK_EQUAL(GetNodeSymbol(MakeNode(ENodeKind::CallFunction, "PrintString", "/Script/Engine.KismetSystemLibrary")),
+		std::string("call:PrintString@/Script/Engine.KismetSystemLibrary"));
+	CHECK_EQUAL(GetNodeSymbol(MakeNode(ENodeKind::VariableGet, "Health", "/Game/BP_Player.BP_Player_C")),
+		std::string("get:Health@/Game/BP_Player.BP_Player_C"));
+	CHECK_EQUAL(GetNodeSymbol(MakeNode(ENodeKind::VariableSet, "Health", "/Game/BP_Player.BP_Player_C")),
+		std::string("set:Health@/Game/BP_Player.BP_Player_C"));
+	CHECK_EQUAL(GetNodeSymbol(MakeNode(ENodeKind::Construct, "", "/Game/BP_Projectile.BP_Projectile_C")),
+		std::string("spawn:/Game/BP_Projectile.BP_Projectile_C"));
+
+	// An unresolved member class still names the member
+	CHECK_EQUAL(GetNodeSymbol(MakeNode(ENodeKind::CallFunction, "Missing")), std::string("call:Missing@"));
+
+	CHECK(GetNodeSymbol(MakeNode(ENodeKind::CallFunction)).empty());
+	CHECK(GetNodeSymbol(MakeNode(ENodeKind::Construct)).empty());
+	CHECK(GetNodeSymbol(MakeNode(ENodeKind::Event, "ReceiveBeginPlay", "/Script/Engine.Actor")).empty());
+	CHECK(GetNodeSymbol(MakeNode(ENodeKind::Other, "Anything", "/Script/Engine.Actor")).empty());
+}
+
+GRAPH_TEST(Format_PinTypes)
+{
+	CHECK_EQUAL(FormatPinType("bool", "", false), std::string("bool"));
+	CHECK_EQUAL(FormatPinType("object", "Actor", false), std::string("object<Actor>"));
+	CHECK_EQUAL(FormatPinType("int", "", true), std::string("Array<int>"));
+	CHECK_EQUAL(FormatPinType("struct", "Vector", true), std::string("Array<struct<Vector>>"));
+}
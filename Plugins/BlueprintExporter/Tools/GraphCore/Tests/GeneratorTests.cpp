@@ -0,0 +1,139 @@
+// GeneratorTests.cpp
+
+#include "BlueprintGraphGenerator.h"
+#include "GraphCoreTest.h"
+
+#include <algorithm>
+
+using namespace BlueprintGraph;
+
+static int64_t CountKnots(const std::vector<FGraph>& Graphs)
+{
+	int64_t Count = 0;
+	for (const FGraph& Graph : Graphs)
+	{
+		for (const FNode& Node : Graph.Nodes)
+		{
+			Count += Node.bIsKnot ? 1 : 0;
+		}
+	}
+	return Count;
+}
+
+GRAPH_TEST(Generator_NodeCountAndGraphs)
+{
+	FGeneratorSettings Settings;
+	Settings.NodeCount = 1003;
+	Settings.FunctionGraphs = 4;
+	const std::vector<FGraph> Graphs = GenerateGraphs(Settings);
+
+	CHECK_EQUAL(Graphs.size(), size_t(5));
+	CHECK_EQUAL(Graphs[0].Name, std::string("EventGraph"));
+	CHECK_EQUAL(Graphs[4].Name, std::string("Function_3"));
+	CHECK_EQUAL(Graphs[0].Nodes.size(), size_t(203));
+	CHECK_EQUAL(Graphs[1].Nodes.size(), size_t(200));
+	CHECK_EQUAL(CountNodes(Graphs), int64_t(1003));
+	CHECK_EQUAL(CountKnots(Graphs), int64_t(0));
+
+	CHECK(Graphs[0].Nodes[0].Kind == ENodeKind::Event);
+	CHECK(Graphs[1].Nodes[0].Kind == ENodeKind::FunctionEntry);
+	CHECK(Graphs[1].Nodes[0].bIsEntryPoint);
+}
+
+GRAPH_TEST(Generator_IsDeterministic)
+{
+	FGeneratorSettings Settings;
+	Settings.NodeCount = 300;
+	Settings.KnotChainDepth = 2;
+	const std::vector<FGraph> First = GenerateGraphs(Settings);
+	const std::vector<FGraph> Second = GenerateGraphs(Settings);
+
+	CHECK_EQUAL(First[0].Nodes.size(), Second[0].Nodes.size());
+	bool bSame = true;
+	for (size_t Node = 0; Node < First[0].Nodes.size() && bSame; ++Node)
+	{
+		const FNode& A = First[0].Nodes[Node];
+		const FNode& B = Second[0].Nodes[Node];
+		bSame = A.Name == B.Name && A.MemberName == B.MemberName && A.Pins.size() == B.Pins.size();
+		for (size_t Pin = 0; Pin < A.Pins.size() && bSame; ++Pin)
+		{
+			bSame = A.Pins[Pin].Links == B.Pins[Pin].Links && A.Pins[Pin].Type == B.Pins[Pin].Type;
+		}
+	}
+	CHECK(bSame);
+
+	Settings.Seed = 2;
+	const std::vector<FGraph> Other = GenerateGraphs(Settings);
+	CHECK(Other[0].Nodes.size() != First[0].Nodes.size() || Other[0].Nodes[5].Name != First[0].Nodes[5].Name
+		|| Other[0].Nodes[5].MemberName != First[0].Nodes[5].MemberName);
+}
+
+GRAPH_TEST(Generator_KnotChainsAndFanOut)
+{
+	FGeneratorSettings Settings;
+	Settings.NodeCount = 2000;
+	Settings.FanOut = 4;
+	Settings.KnotChainDepth = 3;
+	const std::vector<FGraph> Graphs = GenerateGraphs(Settings);
+	const FGraph& Graph = Graphs[0];
+
+	// Knots come in whole chains and every one of them is linked on both sides
+	const int64_t Knots = CountKnots(Graphs);
+	CHECK(Knots > 0);
+	CHECK_EQUAL(Knots % 3, int64_t(0));
+	CHECK_EQUAL(CountNodes(Graphs) - Knots, int64_t(2000));
+
+	int32_t Calls = 0;
+	for (const FNode& Node : Graph.Nodes)
+	{
+		if (Node.bIsKnot)
+		{
+			CHECK(Node.Pins.size() == 2 && Node.Pins[0].Links.size() == 1 && Node.Pins[1].Links.size() == 1);
+		}
+		if (Node.Kind == ENodeKind::CallFunction)
+		{
+			++Calls;
+			CHECK(!Node.FunctionClass.empty());
+		}
+	}
+	CHECK(Calls > 0);
+}
+
+GRAPH_TEST(Generator_GraphsAreWellFormed)
+{
+	FGeneratorSettings Settings;
+	Settings.NodeCount = 5000;
+	Settings.KnotChainDepth = 2;
+	const std::vector<FGraph> Graphs = GenerateGraphs(Settings);
+	const FGraph& Graph = Graphs[0];
+
+	bool bLinksValid = true;
+	size_t MaxExecOutputLinks = 0;
+	for (int32_t Node = 0; Node < static_cast<int32_t>(Graph.Nodes.size()); ++Node)
+	{
+		for (int32_t Pin = 0; Pin < static_cast<int32_t>(Graph.Nodes[Node].Pins.size()); ++Pin)
+		{
+			const FPin& ThisPin = Graph.Nodes[Node].Pins[Pin];
+			for (const FPinRef& Link : ThisPin.Links)
+			{
+				bLinksValid &= Graph.IsValid(Link) && Graph.GetPin(Link).bIsInput != ThisPin.bIsInput;
+			}
+			if (ThisPin.bIsExec && !ThisPin.bIsInput)
+			{
+				MaxExecOutputLinks = std::max(MaxExecOutputLinks, ThisPin.Links.size());
+			}
+		}
+	}
+	CHECK(bLinksValid);
+	CHECK_EQUAL(MaxExecOutputLinks, size_t(1));
+}
+
+GRAPH_TEST(Generator_ZeroNodes)
+{
+	FGeneratorSettings Settings;
+	Settings.NodeCount = 0;
+	Settings.FunctionGraphs = 2;
+	const std::vector<FGraph> Graphs = GenerateGraphs(Settings);
+	CHECK_EQUAL(Graphs.size(), size_t(3));
+	CHECK_EQUAL(CountNodes(Graphs), int64_t(0));
+}
@@ -0,0 +1,100 @@
+// GraphCoreTest.h
+// Minimal self-registering test harness for the graph core tests (no dependencies)
+//
+//   GRAPH_TEST(Ordering_EntryPointsFirst)
+//   {
+//       CHECK(Ordered.size() == 3);
+//       CHECK_EQUAL(Names(Graph, Ordered), (std::vector<std::string>{ "A", "B", "C" }));
+//   }
+//
+// A failed check reports its expression and location and fails the test; the test goes on.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace GraphCoreTest
+{
+	using FTestFunction = void (*)();
+
+	struct FTest
+	{
+		const char* Name;
+		FTestFunction Function;
+	};
+
+	inline std::vector<FTest>& GetTests()
+	{
+		static std::vector<FTest> Tests;
+		return Tests;
+	}
+
+	/** Failed checks of the running test */
+	inline int& GetFailures()
+	{
+		static int Failures = 0;
+		return Failures;
+	}
+
+	struct FRegistrar
+	{
+		FRegistrar(const char* Name, FTestFunction Function)
+		{
+			GetTests().push_back({ Name, Function });
+		}
+	};
+
+	template <typename ValueType>
+	std::string ToString(const ValueType& Value)
+	{
+		std::ostringstream Stream;
+		Stream << Value;
+		return Stream.str();
+	}
+
+	template <typename ValueType>
+	std::string ToString(const std::vector<ValueType>& Values)
+	{
+		std::string Text = "{";
+		for (size_t Index = 0; Index < Values.size(); ++Index)
+		{
+			Text += (Index ? ", " : " ") + ToString(Values[Index]);
+		}
+		return Text + (Values.empty() ? "}" : " }");
+	}
+
+	inline void Fail(const char* File, int Line, const std::string& Message)
+	{
+		++GetFailures();
+		std::cerr << File << ":" << Line << ": " << Message << "\n";
+	}
+}
+
+#define GRAPH_TEST(Name) \
+	static void Name(); \
+	static const GraphCoreTest::FRegistrar Name##Registrar(#Name, &Name); \
+	static void Name()
+
+#define CHECK(Expression) \
+	do \
+	{ \
+		if (!(Expression)) \
+		{ \
+			GraphCoreTest::Fail(__FILE__, __LINE__, "CHECK(" #Expression ") failed"); \
+		} \
+	} while (false)
+
+#define CHECK_EQUAL(Actual, Expected) \
+	do \
+	{ \
+		const auto& ActualValue = (Actual); \
+		const auto& ExpectedValue = (Expected); \
+		if (!(ActualValue == ExpectedValue)) \
+		{ \
+			GraphCoreTest::Fail(__FILE__, __LINE__, "CHECK_EQUAL(" #Actual ", " #Expected ") failed: got " \
+				+ GraphCoreTest::ToString(ActualValue) + ", expected " + GraphCoreTest::ToString(ExpectedValue)); \
+		} \
+	} while (false)
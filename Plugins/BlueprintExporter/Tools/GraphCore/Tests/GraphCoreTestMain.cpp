@@ -0,0 +1,36 @@
+// GraphCoreTestMain.cpp
+// Runs every registered graph core test, or those whose name contains the first argument
+//
+//   BlueprintGraphCoreTests [<NameFilter>]
+
+#include "GraphCoreTest.h"
+
+#include <cstring>
+
+int main(int ArgCount, char** Args)
+{
+	const char* Filter = ArgCount > 1 ? Args[1] : "";
+
+	int NumRun = 0;
+	int NumFailed = 0;
+	for (const GraphCoreTest::FTest& Test : GraphCoreTest::GetTests())
+	{
+		if (!std::strstr(Test.Name, Filter))
+		{
+			continue;
+		}
+
+		GraphCoreTest::GetFailures() = 0;
+		Test.Function();
+		++NumRun;
+
+		if (GraphCoreTest::GetFailures() > 0)
+		{
+			++NumFailed;
+			std::cerr << "FAILED " << Test.Name << "\n";
+		}
+	}
+
+	std::cout << NumRun - NumFailed << " of " << NumRun << " tests passed\n";
+	return NumFailed == 0 && NumRun > 0 ? 0 : 1;
+}
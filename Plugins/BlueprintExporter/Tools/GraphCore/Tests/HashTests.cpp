@@ -0,0 +1,57 @@
+// HashTests.cpp
+
+#include "BlueprintGraphHash.h"
+#include "GraphCoreTest.h"
+
+using namespace BlueprintGraph;
+
+GRAPH_TEST(Hash_KnownValues)
+{
+	// Exported hashes must never change for the same fields; these pin the encoding
+	CHECK_EQUAL(FormatHash(FStructuralHash().Finish()), std::string("efd01f60ba992926"));
+
+	FStructuralHash Hash;
+	Hash.AddString("CallFunction");
+	Hash.AddInteger(2);
+	Hash.AddBool(true);
+	CHECK_EQUAL(FormatHash(Hash.Finish()), std::string("f0b068669117ac73"));
+}
+
+GRAPH_TEST(Hash_FieldBoundariesAndOrder)
+{
+	auto HashStrings = [](std::string_view A, std::string_view B)
+	{
+		FStructuralHash Hash;
+		Hash.AddString(A);
+		Hash.AddString(B);
+		return Hash.Finish();
+	};
+
+	CHECK(HashStrings("ab", "c") != HashStrings("a", "bc"));
+	CHECK(HashStrings("a", "b") != HashStrings("b", "a"));
+	CHECK(HashStrings("", "x") != HashStrings("x", ""));
+	CHECK_EQUAL(HashStrings("a", "b"), HashStrings("a", "b"));
+
+	FStructuralHash True;
+	True.AddBool(true);
+	FStructuralHash False;
+	False.AddBool(false);
+	CHECK(True.Finish() != False.Finish());
+}
+
+GRAPH_TEST(Hash_FormatAndParse)
+{
+	const uint64_t Value = 0x0123456789abcdefull;
+	CHECK_EQUAL(FormatHash(Value), std::string("0123456789abcdef"));
+	CHECK_EQUAL(FormatHash(0), std::string("0000000000000000"));
+
+	uint64_t Parsed = 0;
+	CHECK(ParseHash("0123456789ABCDEF", Parsed));
+	CHECK_EQUAL(Parsed, Value);
+	CHECK(ParseHash(FormatHash(~0ull), Parsed));
+	CHECK_EQUAL(Parsed, ~0ull);
+
+	CHECK(!ParseHash("0123456789abcde", Parsed));
+	CHECK(!ParseHash("0123456789abcdeg", Parsed));
+	CHECK(!ParseHash("", Parsed));
+}
@@ -0,0 +1,133 @@
+// KnotTests.cpp
+
+#include "BlueprintGraphKnots.h"
+#include "GraphCoreTest.h"
+#include "TestGraphs.h"
+
+using namespace BlueprintGraph;
+using namespace GraphCoreTest;
+
+using FNames = std::vector<std::string>;
+
+GRAPH_TEST(Knots_PinWithoutKnotsKeepsItsLinks)
+{
+	FGraph Graph;
+	const FExecNode A = AddExecNode(Graph, "A");
+	const FExecNode B = AddExecNode(Graph, "B");
+	const FExecNode C = AddExecNode(Graph, "C");
+	Graph.Link(A.Out, C.In);
+	Graph.Link(A.Out, B.In);
+
+	const FKnotMap Knots(Graph);
+	CHECK_EQUAL(PinNames(Graph, Knots.GetLinkedPins(A.Out)), (FNames{ "C.execute", "B.execute" }));
+	CHECK(&Knots.GetLinkedPins(A.Out) == &Graph.GetPin(A.Out).Links);
+}
+
+GRAPH_TEST(Knots_ChainCollapsesBothWays)
+{
+	FGraph Graph;
+	const FExecNode A = AddExecNode(Graph, "A");
+	const FKnot K1 = AddKnot(Graph, "K1");
+	const FKnot K2 = AddKnot(Graph, "K2");
+	const FExecNode B = AddExecNode(Graph, "B");
+	Graph.Link(A.Out, K1.In);
+	Graph.Link(K1.Out, K2.In);
+	Graph.Link(K2.Out, B.In);
+
+	const FKnotMap Knots(Graph);
+	CHECK_EQUAL(PinNames(Graph, Knots.GetLinkedPins(A.Out)), (FNames{ "B.execute" }));
+	CHECK_EQUAL(PinNames(Graph, Knots.GetLinkedPins(B.In)), (FNames{ "A.then" }));
+}
+
+GRAPH_TEST(Knots_FanOutKeepsLinkOrder)
+{
+	FGraph Graph;
+	const int32_t Source = Graph.AddNode("Source");
+	const FPinRef Value = Graph.AddPin(Source, "ReturnValue", false);
+	const FKnot Knot = AddKnot(Graph, "Knot");
+	const int32_t Direct = Graph.AddNode("Direct");
+	const FPinRef DirectIn = Graph.AddPin(Direct, "Value", true);
+
+	std::vector<FPinRef> Targets;
+	for (const char* Name : { "Z", "A", "M" })
+	{
+		const int32_t Node = Graph.AddNode(Name);
+		Targets.push_back(Graph.AddPin(Node, "Value", true));
+		Graph.Link(Knot.Out, Targets.back());
+	}
+
+	Graph.Link(Value, DirectIn);
+	Graph.Link(Value, Knot.In);
+
+	const FKnotMap Knots(Graph);
+	CHECK_EQUAL(PinNames(Graph, Knots.GetLinkedPins(Value)), (FNames{ "Direct.Value", "Z.Value", "A.Value", "M.Value" }));
+	CHECK_EQUAL(PinNames(Graph, Knots.GetLinkedPins(Targets[1])), (FNames{ "Source.ReturnValue" }));
+}
+
+GRAPH_TEST(Knots_SharedKnotResolvedOnce)
+{
+	// Two sources reach the same knot chain; both see the same endpoints
+	FGraph Graph;
+	const FExecNode A = AddExecNode(Graph, "A");
+	const FExecNode B = AddExecNode(Graph, "B");
+	const FKnot K1 = AddKnot(Graph, "K1");
+	const FKnot K2 = AddKnot(Graph, "K2");
+	const FExecNode C = AddExecNode(Graph, "C");
+	Graph.Link(A.Out, K1.In);
+	Graph.Link(B.Out, K1.In);
+	Graph.Link(K1.Out, K2.In);
+	Graph.Link(K2.Out, C.In);
+
+	const FKnotMap Knots(Graph);
+	CHECK_EQUAL(PinNames(Graph, Knots.GetLinkedPins(A.Out)), (FNames{ "C.execute" }));
+	CHECK_EQUAL(PinNames(Graph, Knots.GetLinkedPins(B.Out)), (FNames{ "C.execute" }));
+	CHECK_EQUAL(PinNames(Graph, Knots.GetLinkedPins(C.In)), (FNames{ "A.then", "B.then" }));
+}
+
+GRAPH_TEST(Knots_DeadEndCollapsesToNothing)
+{
+	FGraph Graph;
+	const FExecNode A = AddExecNode(Graph, "A");
+	const FKnot Knot = AddKnot(Graph, "Knot");
+	Graph.Link(A.Out, Knot.In);
+
+	const FKnotMap Knots(Graph);
+	CHECK(Knots.GetLinkedPins(A.Out).empty());
+	CHECK(!Graph.GetPin(A.Out).Links.empty());
+}
+
+GRAPH_TEST(Knots_LoopIsCut)
+{
+	// A -> K1 -> K2 -> K1 (loop), K2 -> B
+	FGraph Graph;
+	const FExecNode A = AddExecNode(Graph, "A");
+	const FKnot K1 = AddKnot(Graph, "K1");
+	const FKnot K2 = AddKnot(Graph, "K2");
+	const FExecNode B = AddExecNode(Graph, "B");
+	Graph.Link(A.Out, K1.In);
+	Graph.Link(K1.Out, K2.In);
+	Graph.Link(K2.Out, K1.In);
+	Graph.Link(K2.Out, B.In);
+
+	const FKnotMap Knots(Graph);
+	CHECK_EQUAL(PinNames(Graph, Knots.GetLinkedPins(A.Out)), (FNames{ "B.execute" }));
+}
+
+GRAPH_TEST(Knots_LongChainNeedsNoRecursion)
+{
+	FGraph Graph;
+	const FExecNode A = AddExecNode(Graph, "A");
+	FPinRef Previous = A.Out;
+	for (int Index = 0; Index < 200000; ++Index)
+	{
+		const FKnot Knot = AddKnot(Graph, "K" + std::to_string(Index));
+		Graph.Link(Previous, Knot.In);
+		Previous = Knot.Out;
+	}
+	const FExecNode B = AddExecNode(Graph, "B");
+	Graph.Link(Previous, B.In);
+
+	const FKnotMap Knots(Graph);
+	CHECK_EQUAL(PinNames(Graph, Knots.GetLinkedPins(A.Out)), (FNames{ "B.execute" }));
+	CHECK_EQUAL(PinNames(Graph, Knots.GetLinkedPins(B.In)), (FNames{ "A.then" }));
+}
@@ -0,0 +1,62 @@
+// ModelTests.cpp
+
+#include "GraphCoreTest.h"
+#include "TestGraphs.h"
+
+using namespace BlueprintGraph;
+using namespace GraphCoreTest;
+
+GRAPH_TEST(Model_LinkIsTwoWay)
+{
+	FGraph Graph;
+	const FExecNode A = AddExecNode(Graph, "A");
+	const FExecNode B = AddExecNode(Graph, "B");
+	Graph.Link(A.Out, B.In);
+
+	CHECK(Graph.GetPin(A.Out).Links.size() == 1 && Graph.GetPin(A.Out).Links[0] == B.In);
+	CHECK(Graph.GetPin(B.In).Links.size() == 1 && Graph.GetPin(B.In).Links[0] == A.Out);
+	CHECK(Graph.GetPin(A.In).Links.empty());
+	CHECK_EQUAL(Graph.GetPin(A.Out).Type, std::string("exec"));
+}
+
+GRAPH_TEST(Model_PinOffsets)
+{
+	FGraph Graph;
+	AddExecNode(Graph, "A");
+	Graph.AddNode("Empty");
+	AddKnot(Graph, "Knot");
+
+	CHECK_EQUAL(Graph.MakePinOffsets(), (std::vector<int32_t>{ 0, 2, 2, 4 }));
+}
+
+GRAPH_TEST(Model_IsValid)
+{
+	FGraph Graph;
+	const FExecNode A = AddExecNode(Graph, "A");
+
+	CHECK(Graph.IsValid(A.In));
+	CHECK(!Graph.IsValid({ A.Node, 2 }));
+	CHECK(!Graph.IsValid({ 1, 0 }));
+	CHECK(!Graph.IsValid(FPinRef()));
+}
+
+GRAPH_TEST(Model_CompareNamesIgnoresAsciiCase)
+{
+	CHECK(CompareNames("Branch", "branch") == 0);
+	CHECK(CompareNames("a", "B") < 0);
+	CHECK(CompareNames("B", "a") > 0);
+	CHECK(CompareNames("Node", "Node_1") < 0);
+	CHECK(CompareNames("", "A") < 0);
+	// Letters are compared lowercased, so '_' sorts before them, as with FString
+	CHECK(CompareNames("Node_A", "NodeA") < 0);
+	CHECK(CompareNames("Z", "\xC3\x84") < 0);
+}
+
+GRAPH_TEST(Model_LessPathIsTotal)
+{
+	CHECK(LessPath("/Game/a", "/Game/B"));
+	CHECK(!LessPath("/Game/B", "/Game/a"));
+	CHECK(LessPath("/Game/A", "/Game/a"));
+	CHECK(!LessPath("/Game/a", "/Game/A"));
+	CHECK(!LessPath("/Game/A", "/Game/A"));
+}
@@ -0,0 +1,174 @@
+// OrderingTests.cpp
+
+#include "BlueprintGraphKnots.h"
+#include "BlueprintGraphOrdering.h"
+#include "GraphCoreTest.h"
+#include "TestGraphs.h"
+
+#include <algorithm>
+
+using namespace BlueprintGraph;
+using namespace GraphCoreTest;
+
+using FNames = std::vector<std::string>;
+
+static FNames Order(const FGraph& Graph)
+{
+	const FKnotMap Knots(Graph);
+	const FNodeOrdering Ordering(Graph, Knots);
+	return NodeNames(Graph, Ordering.GetOrderedNodes());
+}
+
+GRAPH_TEST(Ordering_EmptyGraph)
+{
+	CHECK(Order(FGraph()).empty());
+}
+
+GRAPH_TEST(Ordering_EntryPointsByNameThenExecChain)
+{
+	FGraph Graph;
+	const FExecNode Tick = AddExecNode(Graph, "ReceiveTick", true);
+	const FExecNode Print = AddExecNode(Graph, "PrintString");
+	const FExecNode Begin = AddExecNode(Graph, "ReceiveBeginPlay", true);
+	const FExecNode Delay = AddExecNode(Graph, "Delay");
+	Graph.Link(Tick.Out, Print.In);
+	Graph.Link(Begin.Out, Delay.In);
+
+	CHECK_EQUAL(Order(Graph), (FNames{ "ReceiveBeginPlay", "Delay", "ReceiveTick", "PrintString" }));
+}
+
+GRAPH_TEST(Ordering_InputDependenciesComeFirst)
+{
+	// Event -> Print, whose "InString" input comes from a pure node fed by another pure node
+	FGraph Graph;
+	const FExecNode Event = AddExecNode(Graph, "Event", true);
+	const FExecNode Print = AddExecNode(Graph, "Print");
+	const FPinRef InString = Graph.AddPin(Print.Node, "InString", true);
+
+	const int32_t Format = Graph.AddNode("Format");
+	const FPinRef FormatOut = Graph.AddPin(Format, "ReturnValue", false);
+	const FPinRef FormatIn = Graph.AddPin(Format, "Value", true);
+	const int32_t Get = Graph.AddNode("GetHealth");
+	const FPinRef GetOut = Graph.AddPin(Get, "Health", false);
+
+	Graph.Link(Event.Out, Print.In);
+	Graph.Link(InString, FormatOut);
+	Graph.Link(FormatIn, GetOut);
+
+	CHECK_EQUAL(Order(Graph), (FNames{ "Event", "GetHealth", "Format", "Print" }));
+}
+
+GRAPH_TEST(Ordering_ExecOutputsByPinName)
+{
+	// Branch's "then" pins are visited by name whatever their pin order
+	FGraph Graph;
+	const FExecNode Event = AddExecNode(Graph, "Event", true);
+	const int32_t Branch = Graph.AddNode("Branch");
+	const FPinRef BranchIn = Graph.AddPin(Branch, "execute", true, true);
+	const FPinRef Then2 = Graph.AddPin(Branch, "then_2", false, true);
+	const FPinRef Then0 = Graph.AddPin(Branch, "Then_0", false, true);
+	const FPinRef Then1 = Graph.AddPin(Branch, "then_1", false, true);
+	const FExecNode A = AddExecNode(Graph, "A");
+	const FExecNode B = AddExecNode(Graph, "B");
+	const FExecNode C = AddExecNode(Graph, "C");
+
+	Graph.Link(Event.Out, BranchIn);
+	Graph.Link(Then2, A.In);
+	Graph.Link(Then0, B.In);
+	Graph.Link(Then1, C.In);
+
+	CHECK_EQUAL(Order(Graph), (FNames{ "Event", "Branch", "B", "C", "A" }));
+}
+
+GRAPH_TEST(Ordering_LinksSortedByNodeThenPin)
+{
+	// One exec output linked to several nodes: visited by node name, not link order
+	FGraph Graph;
+	const FExecNode Event = AddExecNode(Graph, "Event", true);
+	const FExecNode Zed = AddExecNode(Graph, "Zed");
+	const FExecNode Alpha = AddExecNode(Graph, "alpha");
+	const FExecNode Mid = AddExecNode(Graph, "Mid");
+	Graph.Link(Event.Out, Zed.In);
+	Graph.Link(Event.Out, Alpha.In);
+	Graph.Link(Event.Out, Mid.In);
+
+	CHECK_EQUAL(Order(Graph), (FNames{ "Event", "alpha", "Mid", "Zed" }));
+}
+
+GRAPH_TEST(Ordering_UnreachedNodesLastByName)
+{
+	FGraph Graph;
+	AddExecNode(Graph, "Orphan_B");
+	const FExecNode Event = AddExecNode(Graph, "Event", true);
+	AddExecNode(Graph, "Orphan_A");
+	const FExecNode Next = AddExecNode(Graph, "Next");
+	Graph.Link(Event.Out, Next.In);
+
+	CHECK_EQUAL(Order(Graph), (FNames{ "Event", "Next", "Orphan_A", "Orphan_B" }));
+}
+
+GRAPH_TEST(Ordering_KnotsAreSkippedAndFollowed)
+{
+	FGraph Graph;
+	const FExecNode Event = AddExecNode(Graph, "Event", true);
+	const FKnot Knot = AddKnot(Graph, "Knot");
+	const FExecNode Next = AddExecNode(Graph, "Next");
+	Graph.Link(Event.Out, Knot.In);
+	Graph.Link(Knot.Out, Next.In);
+
+	CHECK_EQUAL(Order(Graph), (FNames{ "Event", "Next" }));
+}
+
+GRAPH_TEST(Ordering_CyclesTerminate)
+{
+	// Event -> A -> B -> A, and A's input comes from B as well
+	FGraph Graph;
+	const FExecNode Event = AddExecNode(Graph, "Event", true);
+	const FExecNode A = AddExecNode(Graph, "A");
+	const FExecNode B = AddExecNode(Graph, "B");
+	const FPinRef AValue = Graph.AddPin(A.Node, "Value", true);
+	const FPinRef BValue = Graph.AddPin(B.Node, "Result", false);
+	Graph.Link(Event.Out, A.In);
+	Graph.Link(A.Out, B.In);
+	Graph.Link(B.Out, A.In);
+	Graph.Link(AValue, BValue);
+
+	// Everything linked to an input of A counts as its dependency, exec inputs included, so B comes first
+	CHECK_EQUAL(Order(Graph), (FNames{ "Event", "B", "A" }));
+}
+
+GRAPH_TEST(Ordering_EveryNodeOnce)
+{
+	FGraph Graph;
+	std::vector<FExecNode> Nodes;
+	for (int Index = 0; Index < 50; ++Index)
+	{
+		Nodes.push_back(AddExecNode(Graph, "N" + std::to_string(Index), Index % 10 == 0));
+	}
+	for (int Index = 0; Index < 50; ++Index)
+	{
+		Graph.Link(Nodes[Index].Out, Nodes[(Index * 7 + 3) % 50].In);
+	}
+
+	FNames Ordered = Order(Graph);
+	CHECK_EQUAL(Ordered.size(), size_t(50));
+	std::sort(Ordered.begin(), Ordered.end());
+	CHECK(std::unique(Ordered.begin(), Ordered.end()) == Ordered.end());
+}
+
+GRAPH_TEST(Ordering_LongExecChainNeedsNoRecursion)
+{
+	FGraph Graph;
+	FExecNode Previous = AddExecNode(Graph, "Event", true);
+	for (int Index = 0; Index < 200000; ++Index)
+	{
+		const FExecNode Node = AddExecNode(Graph, "Step" + std::to_string(Index));
+		Graph.Link(Previous.Out, Node.In);
+		Previous = Node;
+	}
+
+	const FNames Ordered = Order(Graph);
+	CHECK_EQUAL(Ordered.size(), size_t(200001));
+	CHECK_EQUAL(Ordered[1], std::string("Step0"));
+	CHECK_EQUAL(Ordered.back(), std::string("Step199999"));
+}
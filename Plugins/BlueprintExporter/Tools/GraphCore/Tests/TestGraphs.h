@@ -0,0 +1,69 @@
+// TestGraphs.h
+// Small graph-building helpers shared by the graph core tests
+
+#pragma once
+
+#include "BlueprintGraphModel.h"
+
+#include <string>
+#include <vector>
+
+namespace GraphCoreTest
+{
+	/** A node with one exec input ("execute") and one exec output ("then") */
+	struct FExecNode
+	{
+		int32_t Node;
+		BlueprintGraph::FPinRef In;
+		BlueprintGraph::FPinRef Out;
+	};
+
+	inline FExecNode AddExecNode(BlueprintGraph::FGraph& Graph, const std::string& Name, bool bIsEntryPoint = false)
+	{
+		FExecNode Result;
+		Result.Node = Graph.AddNode(Name, bIsEntryPoint ? BlueprintGraph::ENodeKind::Event : BlueprintGraph::ENodeKind::Other);
+		Graph.Nodes[Result.Node].bIsEntryPoint = bIsEntryPoint;
+		Result.In = Graph.AddPin(Result.Node, "execute", true, true);
+		Result.Out = Graph.AddPin(Result.Node, "then", false, true);
+		return Result;
+	}
+
+	/** A reroute node: one input, one output */
+	struct FKnot
+	{
+		int32_t Node;
+		BlueprintGraph::FPinRef In;
+		BlueprintGraph::FPinRef Out;
+	};
+
+	inline FKnot AddKnot(BlueprintGraph::FGraph& Graph, const std::string& Name)
+	{
+		FKnot Result;
+		Result.Node = Graph.AddNode(Name);
+		Graph.Nodes[Result.Node].bIsKnot = true;
+		Result.In = Graph.AddPin(Result.Node, "InputPin", true);
+		Result.Out = Graph.AddPin(Result.Node, "OutputPin", false);
+		return Result;
+	}
+
+	inline std::vector<std::string> NodeNames(const BlueprintGraph::FGraph& Graph, const std::vector<int32_t>& Nodes)
+	{
+		std::vector<std::string> Names;
+		for (const int32_t Node : Nodes)
+		{
+			Names.push_back(Graph.Nodes[Node].Name);
+		}
+		return Names;
+	}
+
+	/** "Node.Pin" for each pin */
+	inline std::vector<std::string> PinNames(const BlueprintGraph::FGraph& Graph, const std::vector<BlueprintGraph::FPinRef>& Pins)
+	{
+		std::vector<std::string> Names;
+		for (const BlueprintGraph::FPinRef& Pin : Pins)
+		{
+			Names.push_back(Graph.GetNode(Pin).Name + "." + Graph.GetPin(Pin).Name);
+		}
+		return Names;
+	}
+}
@@ -0,0 +1,291 @@
+// BlueprintMsgPackReader.h
+// Standalone reader for the .msgpack files written by Blueprint Exporter (C++17, no dependencies)
+//
+// The files hold the same schema as the JSON export (see JSON-SCHEMA.md): objects are
+// maps with string keys, in the same order as the JSON fields.
+//
+//   BlueprintMsgPack::FDocument Document = BlueprintMsgPack::ParseFile("BP_Player.msgpack");
+//   for (const BlueprintMsgPack::FValue& Graph : Document.Root["graphs"].Array)
+//   {
+//       std::cout << Graph["name"].String << "\n";
+//   }
+//
+// Strings are views into the document's buffer: keep the FDocument alive while using them.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace BlueprintMsgPack
+{
+	enum class EType
+	{
+		Nil,
+		Bool,
+		Int,
+		UInt,
+		Float,
+		String,
+		Binary,
+		Array,
+		Map
+	};
+
+	struct FValue
+	{
+		EType Type = EType::Nil;
+		bool Bool = false;
+		int64_t Int = 0;
+		uint64_t UInt = 0;
+		double Float = 0.0;
+		/** String and Binary contents */
+		std::string_view String;
+		std::vector<FValue> Array;
+		std::vector<std::pair<std::string_view, FValue>> Map;
+
+		bool IsNil() const { return Type == EType::Nil; }
+
+		/** Map entry with this key, or nullptr */
+		const FValue* Find(std::string_view Key) const
+		{
+			for (const std::pair<std::string_view, FValue>& Entry : Map)
+			{
+				if (Entry.first == Key)
+				{
+					return &Entry.second;
+				}
+			}
+			return nullptr;
+		}
+
+		/** Map entry with this key, or a nil value */
+		const FValue& operator[](std::string_view Key) const
+		{
+			static const FValue Nil;
+			const FValue* Value = Find(Key);
+			return Value ? *Value : Nil;
+		}
+	};
+
+	/** A parsed file: the root value and the bytes its strings point into */
+	struct FDocument
+	{
+		std::vector<uint8_t> Bytes;
+		FValue Root;
+	};
+
+	class FParser
+	{
+	public:
+		FParser(const uint8_t* InData, size_t InSize)
+			: Data(InData)
+			, Size(InSize)
+		{
+		}
+
+		/** Parse one value covering the whole buffer; throws std::runtime_error on malformed input */
+		FValue ParseDocument()
+		{
+			FValue Value = ParseValue(0);
+			if (Offset != Size)
+			{
+				Fail("trailing data after value");
+			}
+			return Value;
+		}
+
+	private:
+		// Deeper nesting than any export has; stops malicious input from exhausting the stack
+		static constexpr int MaxDepth = 512;
+
+		[[noreturn]] void Fail(const char* Message) const
+		{
+			throw std::runtime_error("Invalid MessagePack at byte " + std::to_string(Offset) + ": " + Message);
+		}
+
+		const uint8_t* Take(size_t Count)
+		{
+			if (Size - Offset < Count)
+			{
+				Fail("unexpected end of data");
+			}
+			const uint8_t* Bytes = Data + Offset;
+			Offset += Count;
+			return Bytes;
+		}
+
+		uint64_t ReadBigEndian(size_t NumBytes)
+		{
+			const uint8_t* Bytes = Take(NumBytes);
+			uint64_t Value = 0;
+			for (size_t Index = 0; Index < NumBytes; ++Index)
+			{
+				Value = (Value << 8) | Bytes[Index];
+			}
+			return Value;
+		}
+
+		int64_t ReadSigned(size_t NumBytes)
+		{
+			const uint64_t Raw = ReadBigEndian(NumBytes);
+			const unsigned Shift = static_cast<unsigned>(64 - NumBytes * 8);
+			// Sign-extend from NumBytes * 8 bits
+			return static_cast<int64_t>(Raw << Shift) >> Shift;
+		}
+
+		std::string_view ReadString(size_t Length)
+		{
+			return std::string_view(reinterpret_cast<const char*>(Take(Length)), Length);
+		}
+
+		FValue ParseValue(int Depth)
+		{
+			if (Depth > MaxDepth)
+			{
+				Fail("nesting too deep");
+			}
+
+			const uint8_t Tag = *Take(1);
+			FValue Value;
+
+			if (Tag <= 0x7f)
+			{
+				Value.Type = EType::Int;
+				Value.Int = Tag;
+			}
+			else if (Tag >= 0xe0)
+			{
+				Value.Type = EType::Int;
+				Value.Int = static_cast<int8_t>(Tag);
+			}
+			else if (Tag >= 0xa0 && Tag <= 0xbf)
+			{
+				Value.Type = EType::String;
+				Value.String = ReadString(Tag & 0x1f);
+			}
+			else if (Tag >= 0x90 && Tag <= 0x9f)
+			{
+				ParseArray(Value, Tag & 0x0f, Depth);
+			}
+			else if (Tag >= 0x80 && Tag <= 0x8f)
+			{
+				ParseMap(Value, Tag & 0x0f, Depth);
+			}
+			else
+			{
+				switch (Tag)
+				{
+				case 0xc0: break;
+				case 0xc2: Value.Type = EType::Bool; Value.Bool = false; break;
+				case 0xc3: Value.Type = EType::Bool; Value.Bool = true; break;
+				case 0xc4: Value.Type = EType::Binary; Value.String = ReadString(ReadBigEndian(1)); break;
+				case 0xc5: Value.Type = EType::Binary; Value.String = ReadString(ReadBigEndian(2)); break;
+				case 0xc6: Value.Type = EType::Binary; Value.String = ReadString(ReadBigEndian(4)); break;
+				case 0xca:
+				{
+					const uint32_t Bits = static_cast<uint32_t>(ReadBigEndian(4));
+					float Float;
+					std::memcpy(&Float, &Bits, sizeof(Float));
+					Value.Type = EType::Float;
+					Value.Float = Float;
+					break;
+				}
+				case 0xcb:
+				{
+					const uint64_t Bits = ReadBigEndian(8);
+					Value.Type = EType::Float;
+					std::memcpy(&Value.Float, &Bits, sizeof(Value.Float));
+					break;
+				}
+				case 0xcc: Value.Type = EType::Int; Value.Int = static_cast<int64_t>(ReadBigEndian(1)); break;
+				case 0xcd: Value.Type = EType::Int; Value.Int = static_cast<int64_t>(ReadBigEndian(2)); break;
+				case 0xce: Value.Type = EType::Int; Value.Int = static_cast<int64_t>(ReadBigEndian(4)); break;
+				case 0xcf: Value.Type = EType::UInt; Value.UInt = ReadBigEndian(8); break;
+				case 0xd0: Value.Type = EType::Int; Value.Int = ReadSigned(1); break;
+				case 0xd1: Value.Type = EType::Int; Value.Int = ReadSigned(2); break;
+				case 0xd2: Value.Type = EType::Int; Value.Int = ReadSigned(4); break;
+				case 0xd3: Value.Type = EType::Int; Value.Int = ReadSigned(8); break;
+				case 0xd9: Value.Type = EType::String; Value.String = ReadString(ReadBigEndian(1)); break;
+				case 0xda: Value.Type = EType::String; Value.String = ReadString(ReadBigEndian(2)); break;
+				case 0xdb: Value.Type = EType::String; Value.String = ReadString(ReadBigEndian(4)); break;
+				case 0xdc: ParseArray(Value, ReadBigEndian(2), Depth); break;
+				case 0xdd: ParseArray(Value, ReadBigEndian(4), Depth); break;
+				case 0xde: ParseMap(Value, ReadBigEndian(2), Depth); break;
+				case 0xdf: ParseMap(Value, ReadBigEndian(4), Depth); break;
+				default: Fail("unsupported type");
+				}
+			}
+
+			return Value;
+		}
+
+		void ParseArray(FValue& Value, uint64_t Count, int Depth)
+		{
+			// Every element takes at least one byte
+			if (Count > Size - Offset)
+			{
+				Fail("array longer than the data");
+			}
+
+			Value.Type = EType::Array;
+			Value.Array.reserve(static_cast<size_t>(Count));
+			for (uint64_t Index = 0; Index < Count; ++Index)
+			{
+				Value.Array.push_back(ParseValue(Depth + 1));
+			}
+		}
+
+		void ParseMap(FValue& Value, uint64_t Count, int Depth)
+		{
+			if (Count > (Size - Offset) / 2)
+			{
+				Fail("map longer than the data");
+			}
+
+			Value.Type = EType::Map;
+			Value.Map.reserve(static_cast<size_t>(Count));
+			for (uint64_t Index = 0; Index < Count; ++Index)
+			{
+				FValue Key = ParseValue(Depth + 1);
+				if (Key.Type != EType::String)
+				{
+					Fail("map key is not a string");
+				}
+				Value.Map.emplace_back(Key.String, ParseValue(Depth + 1));
+			}
+		}
+
+		const uint8_t* Data;
+		size_t Size;
+		size_t Offset = 0;
+	};
+
+	/** Parse a buffer; the returned strings point into Data */
+	inline FValue Parse(const uint8_t* Data, size_t Size)
+	{
+		return FParser(Data, Size).ParseDocument();
+	}
+
+	/** Read and parse a .msgpack file; throws std::runtime_error on failure */
+	inline FDocument ParseFile(const std::string& Path)
+	{
+		std::ifstream File(Path, std::ios::binary);
+		if (!File)
+		{
+			throw std::runtime_error("Cannot open " + Path);
+		}
+
+		FDocument Document;
+		Document.Bytes.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+		Document.Root = Parse(Document.Bytes.data(), Document.Bytes.size());
+		return Document;
+	}
+}
@@ -0,0 +1,144 @@
+// BlueprintMsgPackToJson.cpp
+// Prints a .msgpack export as JSON, or times how long it takes to parse
+//
+//   c++ -std=c++17 -O2 BlueprintMsgPackToJson.cpp -o blueprint_msgpack_to_json
+//   blueprint_msgpack_to_json BP_Player.msgpack > BP_Player.json
+//   blueprint_msgpack_to_json --time 100 BP_Player.msgpack
+
+#include "BlueprintMsgPackReader.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+static void WriteJsonString(std::ostream& Out, std::string_view String)
+{
+	Out << '"';
+	for (const char Char : String)
+	{
+		switch (Char)
+		{
+		case '"': Out << "\\\""; break;
+		case '\\': Out << "\\\\"; break;
+		case '\n': Out << "\\n"; break;
+		case '\r': Out << "\\r"; break;
+		case '\t': Out << "\\t"; break;
+		default:
+			if (static_cast<unsigned char>(Char) < 0x20)
+			{
+				char Escaped[8];
+				std::snprintf(Escaped, sizeof(Escaped), "\\u%04x", Char);
+				Out << Escaped;
+			}
+			else
+			{
+				Out << Char;
+			}
+		}
+	}
+	Out << '"';
+}
+
+static void WriteJson(std::ostream& Out, const BlueprintMsgPack::FValue& Value, int Indent)
+{
+	using BlueprintMsgPack::EType;
+
+	const std::string Padding(static_cast<size_t>(Indent + 1), '\t');
+	const std::string ClosingPadding(static_cast<size_t>(Indent), '\t');
+
+	switch (Value.Type)
+	{
+	case EType::Nil: Out << "null"; break;
+	case EType::Bool: Out << (Value.Bool ? "true" : "false"); break;
+	case EType::Int: Out << Value.Int; break;
+	case EType::UInt: Out << Value.UInt; break;
+	case EType::Float: Out << Value.Float; break;
+	case EType::String:
+	case EType::Binary: WriteJsonString(Out, Value.String); break;
+	case EType::Array:
+		if (Value.Array.empty())
+		{
+			Out << "[]";
+			break;
+		}
+		Out << "[\n";
+		for (size_t Index = 0; Index < Value.Array.size(); ++Index)
+		{
+			Out << Padding;
+			WriteJson(Out, Value.Array[Index], Indent + 1);
+			Out << (Index + 1 < Value.Array.size() ? ",\n" : "\n");
+		}
+		Out << ClosingPadding << ']';
+		break;
+	case EType::Map:
+		if (Value.Map.empty())
+		{
+			Out << "{}";
+			break;
+		}
+		Out << "{\n";
+		for (size_t Index = 0; Index < Value.Map.size(); ++Index)
+		{
+			Out << Padding;
+			WriteJsonString(Out, Value.Map[Index].first);
+			Out << ": ";
+			WriteJson(Out, Value.Map[Index].second, Indent + 1);
+			Out << (Index + 1 < Value.Map.size() ? ",\n" : "\n");
+		}
+		Out << ClosingPadding << '}';
+		break;
+	}
+}
+
+int main(int ArgCount, char** Args)
+{
+	int Iterations = 0;
+	int ArgIndex = 1;
+	if (ArgCount > 2 && std::string_view(Args[1]) == "--time")
+	{
+		Iterations = std::atoi(Args[2]);
+		ArgIndex = 3;
+	}
+
+	if (ArgIndex >= ArgCount)
+	{
+		std::cerr << "Usage: " << Args[0] << " [--time <iterations>] <file.msgpack>...\n";
+		return 2;
+	}
+
+	for (; ArgIndex < ArgCount; ++ArgIndex)
+	{
+		try
+		{
+			BlueprintMsgPack::FDocument Document = BlueprintMsgPack::ParseFile(Args[ArgIndex]);
+
+			if (Iterations <= 0)
+			{
+				WriteJson(std::cout, Document.Root, 0);
+				std::cout << '\n';
+				continue;
+			}
+
+			const auto StartTime = std::chrono::steady_clock::now();
+			for (int Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				BlueprintMsgPack::FValue Root = BlueprintMsgPack::Parse(Document.Bytes.data(), Document.Bytes.size());
+				if (Root.IsNil())
+				{
+					return 1;
+				}
+			}
+			const std::chrono::duration<double, std::milli> Elapsed = std::chrono::steady_clock::now() - StartTime;
+			std::cout << Args[ArgIndex] << ": " << Document.Bytes.size() << " bytes, "
+				<< Elapsed.count() / Iterations << " ms per parse\n";
+		}
+		catch (const std::exception& Error)
+		{
+			std::cerr << Args[ArgIndex] << ": " << Error.what() << '\n';
+			return 1;
+		}
+	}
+
+	return 0;
+}